@@ -9,6 +9,79 @@ console.log('📦 [WORKER] Script imported. AbsorbChessEngine available:', typeo
 let engine = null;
 let isInitialized = false;
 
+// --- Warm-start snapshot persistence (IndexedDB) ---
+// The engine can serialize its warm search state (compacted transposition
+// table + history tables) as one binary blob. We keep the latest blob in
+// IndexedDB so a fresh page load restores the previous session's search
+// effort instead of starting cold. See saveSnapshot()/loadSnapshot() in
+// absorb_chess_wasm.cpp for the blob itself.
+const SNAPSHOT_DB = 'absorb-engine-state';
+const SNAPSHOT_STORE = 'snapshots';
+const SNAPSHOT_KEY = 'warm';
+
+function openSnapshotDB() {
+    return new Promise((resolve, reject) => {
+        const req = indexedDB.open(SNAPSHOT_DB, 1);
+        req.onupgradeneeded = () => req.result.createObjectStore(SNAPSHOT_STORE);
+        req.onsuccess = () => resolve(req.result);
+        req.onerror = () => reject(req.error);
+    });
+}
+
+async function snapshotGet() {
+    const db = await openSnapshotDB();
+    try {
+        return await new Promise((resolve, reject) => {
+            const req = db.transaction(SNAPSHOT_STORE)
+                          .objectStore(SNAPSHOT_STORE).get(SNAPSHOT_KEY);
+            req.onsuccess = () => resolve(req.result || null);
+            req.onerror = () => reject(req.error);
+        });
+    } finally {
+        db.close();
+    }
+}
+
+async function snapshotPut(bytes) {
+    const db = await openSnapshotDB();
+    try {
+        await new Promise((resolve, reject) => {
+            const tx = db.transaction(SNAPSHOT_STORE, 'readwrite');
+            tx.objectStore(SNAPSHOT_STORE).put(bytes, SNAPSHOT_KEY);
+            tx.oncomplete = resolve;
+            tx.onerror = () => reject(tx.error);
+        });
+    } finally {
+        db.close();
+    }
+}
+
+// Serialize the engine state and persist it. The returned view aliases the
+// WASM heap and goes stale on the next engine call, so copy it first.
+async function persistSnapshot(minDepth) {
+    const view = engine.saveSnapshot(minDepth || 5);
+    if (!view) return 0;
+    const bytes = new Uint8Array(view); // copy out of the heap
+    await snapshotPut(bytes);
+    return bytes.length;
+}
+
+// Restore the persisted state, if any. Failure is never fatal: the engine
+// just starts cold, exactly as before snapshots existed.
+async function restoreSnapshot() {
+    try {
+        const bytes = await snapshotGet();
+        if (!bytes || !bytes.length) return false;
+        const ok = engine.loadSnapshot(bytes); // embind copies the Uint8Array
+        console.log(ok ? '♻️ [WORKER] Warm-start snapshot restored (' + bytes.length + ' bytes)'
+                       : '⚠️ [WORKER] Stored snapshot rejected (different build or hash size?)');
+        return ok;
+    } catch (err) {
+        console.warn('⚠️ [WORKER] Snapshot restore failed:', err);
+        return false;
+    }
+}
+
 // Initialize the engine
 async function initializeEngine() {
     try {
@@ -87,6 +160,13 @@ async function initializeEngine() {
         }
         isInitialized = true;
         console.log('✅ [WORKER] Chess engine initialized successfully');
+
+        // Warm-start from the previous session before reporting ready, so the
+        // first search already benefits from the restored tables
+        if (engine.loadSnapshot) {
+            await restoreSnapshot();
+        }
+
         postMessage({ type: 'initialized', success: true });
     } catch (error) {
         console.error('❌ [WORKER] Engine initialization failed:', error);
@@ -388,6 +468,19 @@ self.onmessage = async function(e) {
                 postMessage({ type: 'checkResult', id, data: inCheck });
                 break;
                 
+            case 'saveSnapshot':
+                // The app sends this at natural pauses (game over, page
+                // hide); the next page load picks the state up in initialize
+                if (!isInitialized) {
+                    postMessage({ type: 'error', id, error: 'Engine not initialized' });
+                    return;
+                }
+
+                const savedBytes = await persistSnapshot(data && data.minDepth);
+                console.log('💾 [WORKER] Snapshot persisted (' + savedBytes + ' bytes)');
+                postMessage({ type: 'snapshotSaved', id, data: { bytes: savedBytes } });
+                break;
+
             default:
                 postMessage({ type: 'error', id, error: 'Unknown message type: ' + type });
         }
@@ -79,6 +79,14 @@ static const int QUEEN_PST[64] = {
    -20,-10,-10, -5, -5,-10,-10,-20
 };
 bool ChessEngine::tables_initialized = false;
+
+// Zobrist key tables (filled once by init_zobrist_tables)
+uint64_t ChessEngine::zobrist_piece[2][6][64];
+uint64_t ChessEngine::zobrist_ability[2][6][64];
+uint64_t ChessEngine::zobrist_has_moved[2][64];
+uint64_t ChessEngine::zobrist_castled[2];
+uint64_t ChessEngine::zobrist_ep_col[8];
+uint64_t ChessEngine::zobrist_side;
 MagicTable ChessEngine::rook_table;
 MagicTable ChessEngine::bishop_table;
 // ========== CONSTRUCTOR ==========
@@ -102,8 +110,13 @@ ChessEngine::ChessEngine() {
     white_to_move = true;
     white_king_castled = black_king_castled = false;
     en_passant_col = en_passant_row = -1;
-    eval_cache_valid = false;
+    incremental_eval = 0; // Empty board
     nodes_searched = quiescence_nodes = 0;
+
+    tt.assign(TT_ENTRIES, TTEntryBB{0, 0, 0, 0, Move()});
+    search_has_deadline = false;
+    search_aborted = false;
+    completed_depth = 0;
 }
 
 // ========== LOOKUP TABLE INITIALIZATION ==========
@@ -178,6 +191,53 @@ void ChessEngine::init_lookup_tables() {
         for (int rr = r - 1, cc = c - 1; rr >= 1 && cc >= 1; --rr, --cc) bm |= square_bb(rr, cc);
         bishop_masks[sq] = bm;
     }
+
+    init_zobrist_tables();
+}
+
+// ========== ZOBRIST KEYS ==========
+void ChessEngine::init_zobrist_tables() {
+    // splitmix64: small, deterministic and well distributed; no need to drag
+    // in <random> for table initialization
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    auto next = [&seed]() {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    };
+
+    for (int color = 0; color < 2; ++color) {
+        for (int sq = 0; sq < 64; ++sq) {
+            for (int p = 0; p < 6; ++p) {
+                zobrist_piece[color][p][sq] = next();
+                zobrist_ability[color][p][sq] = next();
+            }
+            zobrist_has_moved[color][sq] = next();
+        }
+        zobrist_castled[color] = next();
+    }
+    for (int c = 0; c < 8; ++c) zobrist_ep_col[c] = next();
+    zobrist_side = next();
+}
+
+uint64_t ChessEngine::compute_zobrist_key() const {
+    uint64_t key = 0;
+    for (int color = 0; color < 2; ++color) {
+        for (int p = 0; p < 6; ++p) {
+            uint64_t bb = piece_bb[color][p];
+            while (bb) { key ^= zobrist_piece[color][p][bitscan_forward(bb)]; bb &= bb - 1; }
+            bb = ability_bb[color][p];
+            while (bb) { key ^= zobrist_ability[color][p][bitscan_forward(bb)]; bb &= bb - 1; }
+        }
+        uint64_t bb = has_moved_bb[color];
+        while (bb) { key ^= zobrist_has_moved[color][bitscan_forward(bb)]; bb &= bb - 1; }
+    }
+    if (white_king_castled) key ^= zobrist_castled[0];
+    if (black_king_castled) key ^= zobrist_castled[1];
+    if (en_passant_col >= 0) key ^= zobrist_ep_col[en_passant_col];
+    if (white_to_move) key ^= zobrist_side;
+    return key;
 }
 
 // ========== MAGIC BITBOARD INITIALIZATION (STUB SAFE) ==========
@@ -410,7 +470,7 @@ bool ChessEngine::is_in_check(bool white_king) const {
 }
 
 // ========== MOVE GENERATION HELPERS ==========
-void ChessEngine::add_moves_from_bitboard(int from_square, uint64_t targets, std::vector<Move>& moves, uint32_t flags) const {
+void ChessEngine::add_moves_from_bitboard(int from_square, uint64_t targets, MoveList& moves, uint32_t flags) const {
     while (targets) {
         int to = bitscan_forward(targets);
         targets = clear_lsb(targets);
@@ -418,7 +478,7 @@ void ChessEngine::add_moves_from_bitboard(int from_square, uint64_t targets, std
     }
 }
 
-void ChessEngine::add_pawn_moves(int from_square, uint64_t targets, bool white, std::vector<Move>& moves) const {
+void ChessEngine::add_pawn_moves(int from_square, uint64_t targets, bool white, MoveList& moves) const {
     int promotion_rank = white ? 7 : 0; // white promotes to rank 7 (row 7), black to rank 0 (row 0)
     while (targets) {
         int to = bitscan_forward(targets);
@@ -437,7 +497,7 @@ void ChessEngine::add_pawn_moves(int from_square, uint64_t targets, bool white,
 }
 
 // ========== MOVE GENERATION ==========
-void ChessEngine::generate_pawn_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_pawn_moves_bb(bool white, MoveList& moves) const {
     int color = white ? 0 : 1;
     int dir = white ? -1 : 1;
     int start_rank = white ? 6 : 1;
@@ -480,7 +540,7 @@ void ChessEngine::generate_pawn_moves_bb(bool white, std::vector<Move>& moves) c
     
 }
 
-void ChessEngine::generate_knight_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_knight_moves_bb(bool white, MoveList& moves) const {
     int color = white ? 0 : 1;
     // uint64_t knights = piece_bb[color][1];
     // while (knights) {
@@ -501,7 +561,7 @@ void ChessEngine::generate_knight_moves_bb(bool white, std::vector<Move>& moves)
     }
 }
 
-void ChessEngine::generate_bishop_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_bishop_moves_bb(bool white, MoveList& moves) const {
     int color = white ? 0 : 1;
     // uint64_t bishops = piece_bb[color][2];
     // while (bishops) {
@@ -525,7 +585,7 @@ void ChessEngine::generate_bishop_moves_bb(bool white, std::vector<Move>& moves)
     }
 }
 
-void ChessEngine::generate_rook_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_rook_moves_bb(bool white, MoveList& moves) const {
     int color = white ? 0 : 1;
     // uint64_t rooks = piece_bb[color][3];
     // while (rooks) {
@@ -548,7 +608,7 @@ void ChessEngine::generate_rook_moves_bb(bool white, std::vector<Move>& moves) c
     }
 }
 
-void ChessEngine::generate_queen_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_queen_moves_bb(bool white, MoveList& moves) const {
     int color = white ? 0 : 1;
     // uint64_t queens = piece_bb[color][4];
     // while (queens) {
@@ -569,7 +629,7 @@ void ChessEngine::generate_queen_moves_bb(bool white, std::vector<Move>& moves)
     }
 }
 
-void ChessEngine::generate_king_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_king_moves_bb(bool white, MoveList& moves) const {
     int color = white ? 0 : 1;
     uint64_t kings = piece_bb[color][5];
     while (kings) {
@@ -592,7 +652,7 @@ void ChessEngine::generate_king_moves_bb(bool white, std::vector<Move>& moves) c
     generate_castling_moves_bb(white, moves);
 }
 
-void ChessEngine::generate_castling_moves_bb(bool white, std::vector<Move>& moves) const {
+void ChessEngine::generate_castling_moves_bb(bool white, MoveList& moves) const {
     // Check castling rights and occupancy / attacked squares
     if (white) {
         if (white_king_castled) return;
@@ -727,8 +787,8 @@ bool ChessEngine::is_in_check_fast(bool white_king) const {
 }
 
 // ========== OPTIMIZED LEGAL MOVE GENERATION ==========
-std::vector<Move> ChessEngine::generate_legal_moves() {
-    std::vector<Move> moves;
+void ChessEngine::generate_legal_moves(MoveList& legal) {
+    MoveList moves;
     generate_pawn_moves_bb(white_to_move, moves);
     generate_knight_moves_bb(white_to_move, moves);
     generate_bishop_moves_bb(white_to_move, moves);
@@ -736,30 +796,31 @@ std::vector<Move> ChessEngine::generate_legal_moves() {
     generate_queen_moves_bb(white_to_move, moves);
     generate_king_moves_bb(white_to_move, moves);
     generate_castling_moves_bb(white_to_move, moves);
-    
-    // Fast legality filtering - avoid vector.erase by building new vector
-    std::vector<Move> legal;
-    legal.reserve(moves.size()); // Pre-allocate to avoid reallocations
-    
+
     int king_color = white_to_move ? 0 : 1;
     uint64_t king_bb = piece_bb[king_color][5];
-    if (!king_bb) return legal; // No king, no legal moves
-    
+    if (!king_bb) return; // No king, no legal moves
+
     int king_square = bitscan_forward(king_bb);
     bool in_check = is_in_check_fast(white_to_move);
-    
+
     // Get checkers and pins for optimized filtering
     uint64_t checkers = get_checkers(white_to_move);
     uint64_t pinned_pieces = get_pinned_pieces(white_to_move);
-    
+
     int num_checkers = popcount(checkers);
-    
+
     for (const Move& m : moves) {
         if (is_legal_move_fast(m, king_square, in_check, num_checkers, checkers, pinned_pieces)) {
             legal.push_back(m);
         }
     }
-    return legal;
+}
+
+std::vector<Move> ChessEngine::generate_legal_moves() {
+    MoveList legal;
+    generate_legal_moves(legal);
+    return std::vector<Move>(legal.begin(), legal.end());
 }
 
 bool ChessEngine::is_legal_move_fast(const Move& move, int king_square, bool in_check, 
@@ -901,17 +962,16 @@ std::vector<Move> ChessEngine::generate_legal_moves() const {
     return const_cast<ChessEngine*>(this)->generate_legal_moves();
 }
 
-std::vector<Move> ChessEngine::generate_capture_moves() {
-    std::vector<Move> moves;
+void ChessEngine::generate_capture_moves(MoveList& captures) {
+    MoveList moves;
     generate_pawn_moves_bb(white_to_move, moves);
     generate_knight_moves_bb(white_to_move, moves);
     generate_bishop_moves_bb(white_to_move, moves);
     generate_rook_moves_bb(white_to_move, moves);
     generate_queen_moves_bb(white_to_move, moves);
     generate_king_moves_bb(white_to_move, moves);
-    
+
     // Filter only capture moves
-    std::vector<Move> captures;
     for (const Move& m : moves) {
         if (get_piece_at_square(m.to_row, m.to_col) != EMPTY) {
             bool original_turn = white_to_move;
@@ -920,7 +980,12 @@ std::vector<Move> ChessEngine::generate_capture_moves() {
             undo_move_bb(m, undo);
         }
     }
-    return captures;
+}
+
+std::vector<Move> ChessEngine::generate_capture_moves() {
+    MoveList captures;
+    generate_capture_moves(captures);
+    return std::vector<Move>(captures.begin(), captures.end());
 }
 
 int ChessEngine::get_piece_value(int piece) const {
@@ -1204,15 +1269,48 @@ int ChessEngine::calculate_piece_ability_value_bb(int square, bool white) const
     return calculate_piece_ability_value(piece, abilities);
 }
 
-int ChessEngine::evaluate_material_bb() const {
-    int score = 0;
-    // iterate occupancy (both colors) and add/sub values
-    for (int sq = 0; sq < 64; ++sq) {
-        uint64_t bb = square_bb(sq);
-        if (occupancy_white & bb) score += calculate_piece_ability_value_bb(sq, true);
-        if (occupancy_black & bb) score -= calculate_piece_ability_value_bb(sq, false);
+// PSQT value of one piece type on one square, same tables and indexing as the
+// full rebuild below (both colors read the tables un-mirrored, as before)
+static int pst_value(int piece_index, int sq) {
+    switch (piece_index) {
+        case 0: return PAWN_PST[sq];
+        case 1: return KNIGHT_PST[sq];
+        case 2: return BISHOP_PST[sq];
+        case 4: return QUEEN_PST[sq];
+        default: return 0;
     }
-    return score;
+}
+
+// Signed (white-positive) material + PSQT contribution of one square, read
+// from the given boards rather than the members, so apply_move_bb can diff
+// the pre-move snapshot in its undo record against the updated state.
+int ChessEngine::square_eval_contrib(const uint64_t pieces[2][6],
+                                     const uint64_t abilities[2][6], int sq) const {
+    uint64_t sq_bb = square_bb(sq);
+    for (int color = 0; color < 2; ++color) {
+        uint32_t piece = 0, abil = 0;
+        int pst = 0;
+        for (int pt = 0; pt < 6; ++pt) {
+            if (pieces[color][pt] & sq_bb) {
+                piece |= 1u << pt;          // PIECE_PAWN..PIECE_KING are 1<<0..1<<5
+                pst = pst_value(pt, sq);
+            }
+            if (abilities[color][pt] & sq_bb)
+                abil |= 64u << pt;          // ABILITY_PAWN..ABILITY_KING are 64<<0..64<<5
+        }
+        if (!piece) continue;
+        int v = calculate_piece_ability_value(piece, abil) + pst;
+        return color == 0 ? v : -v;
+    }
+    return 0;
+}
+
+// Rebuild the incremental accumulator from scratch; called whenever the board
+// is set wholesale instead of being reached through make/unmake.
+void ChessEngine::rebuild_incremental_eval() {
+    incremental_eval = 0;
+    for (int sq = 0; sq < 64; ++sq)
+        incremental_eval += square_eval_contrib(piece_bb, ability_bb, sq);
 }
 
 int ChessEngine::evaluate_mobility_bb() const {
@@ -1346,34 +1444,10 @@ int ChessEngine::evaluate_king_safety_bb() const {
 }
 
 int ChessEngine::evaluate_position() const {
-    if (!eval_cache_valid) {
-        // Material + mobility + basic safety (as above)
-        cached_material_eval  = evaluate_material_bb();
-        cached_mobility_eval  = evaluate_mobility_bb();
-        cached_king_safety_eval = evaluate_king_safety_bb();
-        // Add PSQT contributions:
-        int pst_score = 0;
-        for (int color = 0; color < 2; ++color) {
-            bool isWhite = (color == 0);
-            for (int pt = 0; pt < 6; ++pt) {
-                uint64_t bb = piece_bb[color][pt];
-                while (bb) {
-                    int sq = bitscan_forward(bb);
-                    bb = clear_lsb(bb);
-                    int val = 0;
-                    if      (pt == 0) val = PAWN_PST[sq];
-                    else if (pt == 1) val = KNIGHT_PST[sq];
-                    else if (pt == 2) val = BISHOP_PST[sq];
-                    else if (pt == 4) val = QUEEN_PST[sq];
-                    pst_score += (isWhite ? val : -val);
-                }
-            }
-        }
-        cached_psqt_eval = pst_score;
-        eval_cache_valid = true;
-    }
-    return cached_material_eval + cached_mobility_eval 
-           + cached_king_safety_eval + cached_psqt_eval;
+    // Material and PSQT come from the accumulator maintained across
+    // apply_move_bb/undo_move_bb; only the genuinely global terms - mobility
+    // (whole-board attack sets) and king safety - are recomputed at the leaf.
+    return incremental_eval + evaluate_mobility_bb() + evaluate_king_safety_bb();
 }
 
 int ChessEngine::get_evaluation() {
@@ -1396,10 +1470,7 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
     undo.old_black_castled = black_king_castled;
     undo.old_en_passant_col = en_passant_col;
     undo.old_en_passant_row = en_passant_row;
-    undo.old_eval_cache_valid = eval_cache_valid;
-    undo.old_material_eval = cached_material_eval;
-    undo.old_king_safety_eval = cached_king_safety_eval;
-    undo.old_mobility_eval = cached_mobility_eval;
+    undo.old_incremental_eval = incremental_eval;
 
     // Local helpers/constants: piece indices 0..5 -> pawn, knight, bishop, rook, queen, king
     constexpr int IDX_PAWN   = 0;
@@ -1447,6 +1518,7 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
 
     // --- Handle en-passant capture (destination square empty but ep target present) ---
     bool ep_capture = false;
+    int ep_cap_sq = -1;
     if (!normal_capture) {
         // en_passant_row/col indicate where an en-passant capture is possible (as per your state)
         if (move.flags == /* you may have a dedicated EP flag; but if not, detect pawn move landing on enpassant */ 0) {
@@ -1464,6 +1536,7 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
                     if (undo.captured_piece_bb[enemy][pt] & cap_bb) {
                         ep_capture = true;
                         captured_pt = pt;
+                        ep_cap_sq = cap_sq;
                         piece_bb[enemy][pt] &= ~cap_bb; // remove captured pawn
                         break;
                     }
@@ -1504,33 +1577,9 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
     }
 
 
-    // --- Compute captured material value and update cached_material_eval incrementally ---
-    // Use moving_side to avoid bug with white_to_move flip at end
-    int moving_side = color; // 0=white, 1=black
-    if (normal_capture || ep_capture) {
-        uint32_t caps = 0;
-        uint64_t cap_loc_bb = normal_capture ? to_bb : square_bb(moving_side == 0 ? (move.to_row+1) : (move.to_row-1));
-        for (int at = 0; at < 6; ++at) {
-            if (undo.captured_ability_bb[enemy][at] & cap_loc_bb) {
-                switch (at) {
-                    case 0: caps |= ABILITY_PAWN; break;
-                    case 1: caps |= ABILITY_KNIGHT; break;
-                    case 2: caps |= ABILITY_BISHOP; break;
-                    case 3: caps |= ABILITY_ROOK; break;
-                    case 4: caps |= ABILITY_QUEEN; break;
-                    case 5: caps |= ABILITY_KING; break;
-                }
-            }
-        }
-        uint32_t piece_mask = (1u << captured_pt);
-        int captured_value = calculate_piece_ability_value(piece_mask, caps);
-        // Material eval is stored from White's perspective; white capturing is good (+), black capturing is bad (-)
-        if (moving_side == 0) cached_material_eval += captured_value;
-        else                  cached_material_eval -= captured_value;
-    }
-
     // --- Handle promotions: (flags >=4 per your convention) ---
-    // Promotion must: remove pawn bit and add promoted piece bit; adjust cached_material_eval accordingly.
+    // Promotion must: remove pawn bit and add promoted piece bit; the
+    // incremental eval diff at the end of this function picks up the change.
     if (move.flags >= 4) {
         int promo_index = -1;
         if (move.flags == 4) promo_index = IDX_QUEEN;
@@ -1550,16 +1599,6 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
                     ability_bb[color][at] |= placed_bb; // keep abilities as-is
                 }
             }
-
-            // Material adjustment
-            int pawn_val = PIECE_VALUES[1];
-            int promo_val = (promo_index == IDX_QUEEN)  ? PIECE_VALUES[5] :
-                            (promo_index == IDX_ROOK)   ? PIECE_VALUES[4] :
-                            (promo_index == IDX_BISHOP) ? PIECE_VALUES[3] :
-                            (promo_index == IDX_KNIGHT) ? PIECE_VALUES[2] : 0;
-            int delta = promo_val - pawn_val;
-            if (moving_side == 0) cached_material_eval += delta;
-            else                  cached_material_eval -= delta;
         }
     }
 
@@ -1569,7 +1608,6 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
         // Identify color and which side castled by king destination squares (or flags)
         if (color == 0) { // white
             white_king_castled = true;
-            cached_king_safety_eval += 50; // example bonus
             // short castle (O-O): rook h1 -> f1
             if (move.flags == 2) {
                 uint64_t rook_from = square_bb(7,7);
@@ -1597,7 +1635,6 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
             }
         } else { // black
             black_king_castled = true;
-            cached_king_safety_eval -= 50; // good for white is negative for black castling
             if (move.flags == 2) { // black short? depends on your flags mapping; adjust if reversed
                 uint64_t rook_from = square_bb(0,7);
                 uint64_t rook_to   = square_bb(0,5);
@@ -1644,12 +1681,29 @@ ChessEngine::MoveUndoBB ChessEngine::apply_move_bb(const Move& move) {
         }
     }
 
-    // --- Finish: flip side to move, update occupancy, set eval cache valid ---
+    // --- Incremental eval: diff the contributions of the touched squares
+    // against the pre-move snapshot already saved in 'undo'. One uniform pass
+    // covers quiet moves, captures (including the ability the capturer just
+    // absorbed), en passant, promotions and the castling rook.
+    int touched[5];
+    int num_touched = 0;
+    touched[num_touched++] = from_sq;
+    touched[num_touched++] = to_sq;
+    if (ep_capture)
+        touched[num_touched++] = ep_cap_sq;
+    if (move.flags == 2 || move.flags == 3) {
+        int rook_row = color == 0 ? 7 : 0;
+        touched[num_touched++] = square(rook_row, move.flags == 2 ? 7 : 0);
+        touched[num_touched++] = square(rook_row, move.flags == 2 ? 5 : 3);
+    }
+    for (int i = 0; i < num_touched; ++i)
+        incremental_eval += square_eval_contrib(piece_bb, ability_bb, touched[i])
+                          - square_eval_contrib(undo.captured_piece_bb,
+                                                undo.captured_ability_bb, touched[i]);
+
+    // --- Finish: flip side to move and update occupancy ---
     white_to_move = !white_to_move;
     update_occupancy();
-    // Only set eval_cache_valid=true if ALL evals are updated incrementally (material, mobility, king safety, psqt)
-    // For now, only material is updated, so mark cache as invalid to force full recompute when needed
-    eval_cache_valid = false;
 
     return undo;
 }
@@ -1667,11 +1721,9 @@ void ChessEngine::undo_move_bb(const Move& move, const MoveUndoBB& undo) {
     black_king_castled = undo.old_black_castled;
     en_passant_col = undo.old_en_passant_col;
     en_passant_row = undo.old_en_passant_row;
-    eval_cache_valid = undo.old_eval_cache_valid;
-    cached_material_eval = undo.old_material_eval;
-    cached_king_safety_eval = undo.old_king_safety_eval;
-    cached_mobility_eval = undo.old_mobility_eval;
-    
+    incremental_eval = undo.old_incremental_eval;
+
+
     // toggle side back
     white_to_move = !white_to_move;
     update_occupancy();
@@ -1698,9 +1750,33 @@ void ChessEngine::undo_move(const Move& move, const MoveUndo& undo_info) {
 // ========== SEARCH ==========
 int ChessEngine::minimax_bb(int depth, int alpha, int beta, bool maximizing) {
     nodes_searched++;
+
+    // Poll the clock every couple thousand nodes; once the deadline passes
+    // the whole subtree unwinds immediately and its results are discarded
+    if (search_has_deadline && (nodes_searched & 2047) == 0 && time_up())
+        search_aborted = true;
+    if (search_aborted) return 0;
+
     if (depth == 0) return quiescence_search_bb(alpha, beta);
-    
-    std::vector<Move> moves = generate_legal_moves();
+
+    // Transposition table probe: a deep-enough entry can cut the node off
+    // right away, and a shallower one still supplies the best move to try first
+    const uint64_t key = compute_zobrist_key();
+    TTEntryBB& entry = tt[key & (TT_ENTRIES - 1)];
+    Move tt_move(255, 255, 255, 255, 0);
+    if (entry.key == key) {
+        tt_move = entry.best_move;
+        if (entry.depth >= depth) {
+            if (entry.flag == TT_EXACT) return entry.value;
+            if (entry.flag == TT_LOWERBOUND) alpha = std::max(alpha, entry.value);
+            else beta = std::min(beta, entry.value);
+            if (alpha >= beta) return entry.value;
+        }
+    }
+    const int alpha_orig = alpha, beta_orig = beta;
+
+    MoveList moves;
+    generate_legal_moves(moves);
     if (moves.empty()) {
         if (is_in_check(white_to_move)) {
             return maximizing ? -30000 + (5 - depth) : 30000 - (5 - depth);
@@ -1708,36 +1784,59 @@ int ChessEngine::minimax_bb(int depth, int alpha, int beta, bool maximizing) {
             return 0;
         }
     }
-    
-    int current_eval = evaluate_position();
-    
+
+    if (tt_move.from_row != 255) {
+        for (int i = 0; i < moves.size(); ++i) {
+            if (   moves[i].from_row == tt_move.from_row && moves[i].from_col == tt_move.from_col
+                && moves[i].to_row == tt_move.to_row && moves[i].to_col == tt_move.to_col
+                && moves[i].flags == tt_move.flags) {
+                std::swap(moves[0], moves[i]);
+                break;
+            }
+        }
+    }
+
+    Move best = moves[0];
+    int best_eval;
+
     if (maximizing) {
-        int max_eval = INT_MIN;
+        best_eval = INT_MIN;
         for (const Move& m : moves) {
             MoveUndoBB undo = apply_move_bb(m);
             int eval;
             if (depth > 1) eval = minimax_bb(depth - 1, alpha, beta, false);
             else eval = evaluate_position();
             undo_move_bb(m, undo);
-            max_eval = std::max(max_eval, eval);
+            if (eval > best_eval) { best_eval = eval; best = m; }
             alpha = std::max(alpha, eval);
             if (beta <= alpha) break;
         }
-        return max_eval;
     } else {
-        int min_eval = INT_MAX;
+        best_eval = INT_MAX;
         for (const Move& m : moves) {
             MoveUndoBB undo = apply_move_bb(m);
             int eval;
             if (depth > 1) eval = minimax_bb(depth - 1, alpha, beta, true);
             else eval = evaluate_position();
             undo_move_bb(m, undo);
-            min_eval = std::min(min_eval, eval);
+            if (eval < best_eval) { best_eval = eval; best = m; }
             beta = std::min(beta, eval);
             if (beta <= alpha) break;
         }
-        return min_eval;
     }
+
+    // Don't pollute the table with partially searched nodes
+    if (search_aborted) return 0;
+
+    entry.key = key;
+    entry.value = best_eval;
+    entry.depth = (int16_t)depth;
+    entry.flag = best_eval <= alpha_orig ? TT_UPPERBOUND
+               : best_eval >= beta_orig  ? TT_LOWERBOUND
+                                         : TT_EXACT;
+    entry.best_move = best;
+
+    return best_eval;
 }
 
 int ChessEngine::quiescence_search_bb(int alpha, int beta) {
@@ -1751,8 +1850,9 @@ int ChessEngine::quiescence_search_bb(int alpha, int beta) {
     if (alpha < stand_pat) alpha = stand_pat;
 
     // Generate only capture moves for quiescence search
-    std::vector<Move> captures = generate_capture_moves();
-    
+    MoveList captures;
+    generate_capture_moves(captures);
+
     for (const Move& cap : captures) {
         // Delta pruning: if even capturing the most valuable piece won't improve alpha enough
         int captured_value = get_piece_value(get_piece_at_square(cap.to_row, cap.to_col));
@@ -1769,21 +1869,119 @@ int ChessEngine::quiescence_search_bb(int alpha, int beta) {
     return alpha;
 }
 
-std::pair<Move,int> ChessEngine::get_best_move(int depth) {
+std::pair<Move,int> ChessEngine::search_root(int depth, int alpha, int beta) {
     Move invalid(255,255,255,255,0);
-    int best_score = white_to_move ? INT_MIN : INT_MAX;
-    std::vector<Move> moves = generate_legal_moves();
-    if (moves.empty()) return {invalid, best_score};
+    MoveList moves;
+    generate_legal_moves(moves);
+    if (moves.empty()) return {invalid, white_to_move ? INT_MIN : INT_MAX};
+
+    // Try last iteration's best move first, same as the interior nodes
+    const uint64_t key = compute_zobrist_key();
+    TTEntryBB& entry = tt[key & (TT_ENTRIES - 1)];
+    if (entry.key == key && entry.best_move.from_row != 255) {
+        for (int i = 0; i < moves.size(); ++i) {
+            if (   moves[i].from_row == entry.best_move.from_row && moves[i].from_col == entry.best_move.from_col
+                && moves[i].to_row == entry.best_move.to_row && moves[i].to_col == entry.best_move.to_col
+                && moves[i].flags == entry.best_move.flags) {
+                std::swap(moves[0], moves[i]);
+                break;
+            }
+        }
+    }
+
+    const bool root_white = white_to_move;
+    const int alpha_orig = alpha, beta_orig = beta;
     Move best = moves[0];
+    int best_score = root_white ? INT_MIN : INT_MAX;
+
     for (const Move& m : moves) {
         MoveUndoBB undo = apply_move_bb(m);
-        int score = minimax_bb(depth - 1, INT_MIN, INT_MAX, white_to_move);
+        int score = minimax_bb(depth - 1, alpha, beta, white_to_move);
         undo_move_bb(m, undo);
-        if ((white_to_move && score > best_score) || (!white_to_move && score < best_score)) {
-            best_score = score; 
-            best = m; // Keep original flags including promotion
+        if (search_aborted) break;
+        if (root_white) {
+            if (score > best_score) { best_score = score; best = m; } // Keep original flags including promotion
+            alpha = std::max(alpha, best_score);
+        } else {
+            if (score < best_score) { best_score = score; best = m; }
+            beta = std::min(beta, best_score);
         }
+        if (beta <= alpha) break;
+    }
+
+    if (!search_aborted) {
+        entry.key = key;
+        entry.value = best_score;
+        entry.depth = (int16_t)depth;
+        entry.flag = best_score <= alpha_orig ? TT_UPPERBOUND
+                   : best_score >= beta_orig  ? TT_LOWERBOUND
+                                              : TT_EXACT;
+        entry.best_move = best;
     }
+
+    return {best, best_score};
+}
+
+std::pair<Move,int> ChessEngine::get_best_move(int depth) {
+    return get_best_move_timed(depth, 0);
+}
+
+std::pair<Move,int> ChessEngine::get_best_move_timed(int max_depth, int time_budget_ms) {
+    search_has_deadline = time_budget_ms > 0;
+    search_aborted = false;
+    completed_depth = 0;
+    auto start = std::chrono::steady_clock::now();
+    if (search_has_deadline)
+        search_deadline = start + std::chrono::milliseconds(time_budget_ms);
+
+    Move best(255,255,255,255,0);
+    int best_score = white_to_move ? INT_MIN : INT_MAX;
+    int prev_score = 0;
+
+    for (int depth = 1; depth <= max_depth; ++depth) {
+        // Aspiration: search with a narrow window around the previous
+        // iteration's score and widen it on a fail until the score fits.
+        // Depth 1 has no previous score, so it gets the full window.
+        int delta = 50;
+        int alpha = depth == 1 ? INT_MIN : prev_score - delta;
+        int beta  = depth == 1 ? INT_MAX : prev_score + delta;
+        std::pair<Move,int> result;
+        while (true) {
+            result = search_root(depth, alpha, beta);
+            if (search_aborted) break;
+            if (result.first.from_row == 255) return result; // no legal moves
+            if (result.second <= alpha)
+                { delta *= 4; alpha = delta > 600 ? INT_MIN : prev_score - delta; }
+            else if (result.second >= beta)
+                { delta *= 4; beta = delta > 600 ? INT_MAX : prev_score + delta; }
+            else
+                break;
+        }
+        if (search_aborted) break; // keep the last fully completed iteration
+
+        best = result.first;
+        best_score = result.second;
+        prev_score = best_score;
+        completed_depth = depth;
+
+        // No point starting an iteration that is very unlikely to finish:
+        // each depth typically costs several times the previous one
+        if (search_has_deadline) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed * 2 >= std::chrono::milliseconds(time_budget_ms))
+                break;
+        }
+    }
+
+    // Deadline hit before depth 1 completed: fall back to any legal move
+    if (best.from_row == 255) {
+        MoveList moves;
+        generate_legal_moves(moves);
+        if (moves.empty()) return {best, best_score};
+        best = moves[0];
+        best_score = evaluate_position();
+    }
+
     return {best, best_score};
 }
 
@@ -1872,9 +2070,7 @@ void ChessEngine::set_board_state(const std::vector<std::vector<uint32_t>>& boar
     en_passant_col = en_passant_col_in;
     en_passant_row = en_passant_row_in;
     update_occupancy();
-    eval_cache_valid = false;
-    
-    
+    rebuild_incremental_eval();
 }
 
 std::string ChessEngine::bitboard_to_string(uint64_t bb) {
@@ -1888,6 +2084,58 @@ std::string ChessEngine::bitboard_to_string(uint64_t bb) {
     }
     return out;
 }
+// Debug/testing: random playout with full make/unmake from the current
+// position, cross-checking the incremental material+PSQT accumulator against
+// a from-scratch rebuild at every node. Random lines exercise captures (with
+// ability absorption), promotions, castling and en passant; the unwind then
+// verifies undo_move_bb restores the accumulator exactly.
+bool ChessEngine::verify_incremental_eval(int plies, uint64_t seed) {
+
+    auto scratch = [&]() {
+        int s = 0;
+        for (int sq = 0; sq < 64; ++sq)
+            s += square_eval_contrib(piece_bb, ability_bb, sq);
+        return s;
+    };
+
+    std::vector<Move> line;
+    std::vector<MoveUndoBB> undos;
+    bool ok = true;
+
+    for (int ply = 0; ply < plies; ++ply) {
+        MoveList moves;
+        generate_legal_moves(moves);
+        if (moves.empty()) break;
+
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const Move& m = moves[(seed >> 33) % moves.size()];
+        undos.push_back(apply_move_bb(m));
+        line.push_back(m);
+
+        if (incremental_eval != scratch()) {
+            std::cerr << "incremental eval mismatch after apply at ply " << ply
+                      << ": incremental " << incremental_eval
+                      << " scratch " << scratch() << "\n";
+            ok = false;
+        }
+    }
+
+    while (!line.empty()) {
+        undo_move_bb(line.back(), undos.back());
+        line.pop_back();
+        undos.pop_back();
+
+        if (incremental_eval != scratch()) {
+            std::cerr << "incremental eval mismatch after undo at depth "
+                      << line.size() << ": incremental " << incremental_eval
+                      << " scratch " << scratch() << "\n";
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
 void ChessEngine::verify_magic_tables() {
     init_magic_bitboards(); // make sure tables are built
 
@@ -2041,6 +2289,38 @@ bool ChessEngine::is_stalemate() const {
 bool ChessEngine::is_game_over() const { return is_checkmate() || is_stalemate(); }
 
 
+#ifdef TEST_INCREMENTAL_EVAL
+#include <cstdlib>
+// Build with -DTEST_INCREMENTAL_EVAL to cross-check the incremental
+// evaluation over random playouts from the starting position. Note that the
+// engine generates moves from the ability bitboards, so every piece carries
+// its base-type ability bit (PIECE_X << 6 == ABILITY_X).
+int main() {
+    init_chess_engine__tables();
+
+    std::vector<std::vector<uint32_t>> board(8, std::vector<uint32_t>(8, 0));
+    uint32_t back[8] = {PIECE_ROOK, PIECE_KNIGHT, PIECE_BISHOP, PIECE_QUEEN,
+                        PIECE_KING, PIECE_BISHOP, PIECE_KNIGHT, PIECE_ROOK};
+    for (int c = 0; c < 8; ++c) {
+        board[0][c] = back[c] | (back[c] << 6);
+        board[1][c] = PIECE_PAWN | ABILITY_PAWN;
+        board[6][c] = PIECE_PAWN | ABILITY_PAWN | IS_WHITE;
+        board[7][c] = back[c] | (back[c] << 6) | IS_WHITE;
+    }
+
+    bool ok = true;
+    for (int game = 0; game < 200; ++game) {
+        ChessEngine engine;
+        engine.set_board_state(board, true, false, false, -1, -1);
+        ok &= engine.verify_incremental_eval(240, 0x9E3779B97F4A7C15ULL * (game + 1));
+    }
+
+    std::cout << (ok ? "[PASS] Incremental eval verification succeeded\n"
+                     : "[FAIL] Incremental eval verification failed\n");
+    return ok ? 0 : 1;
+}
+#endif
+
 #ifdef TEST_MAGIC_VERIFY
 #include <cstdlib>
 int main() {
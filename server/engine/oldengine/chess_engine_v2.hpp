@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <tuple>
 #include <string>
+#include <chrono>
 
 // Basic piece and ability flags (same semantics as your current code)
 constexpr uint32_t PIECE_PAWN   = 1;
@@ -49,6 +50,31 @@ struct Move {
         : from_row(fr), from_col(fc), to_row(tr), to_col(tc), flags(f) {}
 };
 
+// Fixed-capacity move buffer, same idea as Stockfish's ExtMove array in
+// movegen.h: it lives in the frame of the search node on the stack, so move
+// generation performs no heap allocation. 256 slots is plenty even with
+// multi-ability pieces; push_back drops moves beyond that rather than
+// overflowing.
+constexpr int MAX_MOVES = 256;
+
+struct MoveList {
+    Move list[MAX_MOVES];
+    int count = 0;
+
+    void push_back(const Move& m) { if (count < MAX_MOVES) list[count++] = m; }
+    void emplace_back(uint8_t fr, uint8_t fc, uint8_t tr, uint8_t tc, uint32_t f = 0) {
+        push_back(Move(fr, fc, tr, tc, f));
+    }
+    Move* begin() { return list; }
+    Move* end() { return list + count; }
+    const Move* begin() const { return list; }
+    const Move* end() const { return list + count; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    Move& operator[](int i) { return list[i]; }
+    const Move& operator[](int i) const { return list[i]; }
+};
+
 struct GameState {
     std::array<std::array<uint32_t, 8>, 8> board;
     bool white_to_move;
@@ -128,14 +154,14 @@ private:
     static MagicTable rook_table;
     static MagicTable bishop_table;
     
-    // -------- Evaluation cache --------
+    // -------- Evaluation state --------
     mutable uint64_t nodes_searched;
     mutable uint64_t quiescence_nodes;
-    mutable int cached_material_eval;
-    mutable int cached_king_safety_eval;
-    mutable int cached_mobility_eval;
-    mutable bool eval_cache_valid;
-    mutable int cached_psqt_eval;
+    // Material + PSQT from White's point of view, maintained incrementally by
+    // apply_move_bb/undo_move_bb and rebuilt from scratch only when the board
+    // is set wholesale (rebuild_incremental_eval). The genuinely global terms
+    // (mobility, king safety) are recomputed at each leaf instead.
+    int incremental_eval;
     
     static constexpr int PIECE_VALUES[7] = {0, 100, 320, 330, 500, 900, 20000};
     
@@ -161,17 +187,22 @@ private:
     bool is_square_attacked_fast(int square, bool by_white) const;
     bool is_in_check_fast(bool white_king) const;
     
-    // Bitboard move generation
-    void generate_pawn_moves_bb(bool white, std::vector<Move>& moves) const;
-    void generate_knight_moves_bb(bool white, std::vector<Move>& moves) const;
-    void generate_bishop_moves_bb(bool white, std::vector<Move>& moves) const;
-    void generate_rook_moves_bb(bool white, std::vector<Move>& moves) const;
-    void generate_queen_moves_bb(bool white, std::vector<Move>& moves) const;
-    void generate_king_moves_bb(bool white, std::vector<Move>& moves) const;
-    void generate_castling_moves_bb(bool white, std::vector<Move>& moves) const;
-    
-    void add_moves_from_bitboard(int from_square, uint64_t targets, std::vector<Move>& moves, uint32_t flags = 0) const;
-    void add_pawn_moves(int from_square, uint64_t targets, bool white, std::vector<Move>& moves) const;
+    // Bitboard move generation (appends into a caller-owned fixed buffer)
+    void generate_pawn_moves_bb(bool white, MoveList& moves) const;
+    void generate_knight_moves_bb(bool white, MoveList& moves) const;
+    void generate_bishop_moves_bb(bool white, MoveList& moves) const;
+    void generate_rook_moves_bb(bool white, MoveList& moves) const;
+    void generate_queen_moves_bb(bool white, MoveList& moves) const;
+    void generate_king_moves_bb(bool white, MoveList& moves) const;
+    void generate_castling_moves_bb(bool white, MoveList& moves) const;
+
+    void add_moves_from_bitboard(int from_square, uint64_t targets, MoveList& moves, uint32_t flags = 0) const;
+    void add_pawn_moves(int from_square, uint64_t targets, bool white, MoveList& moves) const;
+
+    // Allocation-free variants used by the search hot loop; the public
+    // std::vector API below wraps these for external callers
+    void generate_legal_moves(MoveList& legal);
+    void generate_capture_moves(MoveList& captures);
     
     // Move application
     struct MoveUndoBB {
@@ -180,20 +211,57 @@ private:
         uint64_t old_has_moved[2];
         bool old_white_castled, old_black_castled;
         int old_en_passant_col, old_en_passant_row;
-        bool old_eval_cache_valid;
-        int old_material_eval, old_king_safety_eval, old_mobility_eval;
+        int old_incremental_eval;
     };
     MoveUndoBB apply_move_bb(const Move& move);
     void undo_move_bb(const Move& move, const MoveUndoBB& undo);
     
     // Evaluation (bitboard-optimized)
-    int evaluate_material_bb() const;
     int evaluate_mobility_bb() const;
     int evaluate_king_safety_bb() const;
     int calculate_piece_ability_value_bb(int square, bool white) const;
     int calculate_piece_ability_value(uint32_t piece, uint32_t abilities) const;
+
+    // Incremental material + PSQT maintenance (see incremental_eval above)
+    int square_eval_contrib(const uint64_t pieces[2][6],
+                            const uint64_t abilities[2][6], int sq) const;
+    void rebuild_incremental_eval();
     
     
+    // -------- Transposition table (Zobrist-keyed) --------
+    struct TTEntryBB {
+        uint64_t key;    // full key for verification (0 = empty slot)
+        int32_t value;
+        int16_t depth;
+        uint8_t flag;    // TT_EXACT / TT_LOWERBOUND / TT_UPPERBOUND
+        Move best_move;
+    };
+    static constexpr uint8_t TT_EXACT = 0;
+    static constexpr uint8_t TT_LOWERBOUND = 1;
+    static constexpr uint8_t TT_UPPERBOUND = 2;
+    static constexpr size_t TT_ENTRIES = 1 << 19;  // power of two, ~12 MB
+    std::vector<TTEntryBB> tt;
+
+    // Zobrist keys cover everything move generation depends on: piece and
+    // ability boards, has-moved bits (castling / double-push rights), the
+    // castled flags used by king safety, en passant file and side to move.
+    static uint64_t zobrist_piece[2][6][64];
+    static uint64_t zobrist_ability[2][6][64];
+    static uint64_t zobrist_has_moved[2][64];
+    static uint64_t zobrist_castled[2];
+    static uint64_t zobrist_ep_col[8];
+    static uint64_t zobrist_side;
+    static void init_zobrist_tables();
+    uint64_t compute_zobrist_key() const;
+
+    // -------- Timed search --------
+    std::chrono::steady_clock::time_point search_deadline;
+    bool search_has_deadline;
+    bool search_aborted;   // deadline hit mid-search; partial results discarded
+    int completed_depth;   // deepest fully searched iteration of the last call
+    bool time_up() const { return std::chrono::steady_clock::now() >= search_deadline; }
+    std::pair<Move, int> search_root(int depth, int alpha, int beta);
+
     // Search
     int minimax_bb(int depth, int alpha, int beta, bool maximizing);
     int quiescence_search_bb(int alpha, int beta);
@@ -245,6 +313,11 @@ public:
 
     // New helpers
     std::pair<Move, int> get_best_move(int depth);
+    // Iterative deepening with aspiration windows; searches depths 1..max_depth
+    // until the budget runs out (time_budget_ms <= 0 means no time limit) and
+    // returns the deepest fully completed iteration's move.
+    std::pair<Move, int> get_best_move_timed(int max_depth, int time_budget_ms);
+    int last_search_depth() const { return completed_depth; }
     std::vector<Move> get_legal_moves();
     std::tuple<std::vector<std::vector<uint32_t>>, bool, bool, bool, int, int> get_board_state();
     bool is_valid_move(int from_row, int from_col, int to_row, int to_col);
@@ -285,6 +358,7 @@ public:
     void print_bitboards() const;
     uint64_t perft(int depth);
     void verify_magic_tables();
+    bool verify_incremental_eval(int plies, uint64_t seed);
     std::string bitboard_to_string(uint64_t bb);
     void dump_square_indices();
     void quick_mapping_test();
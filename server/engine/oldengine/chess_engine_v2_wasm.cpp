@@ -63,14 +63,16 @@ public:
     val findBestMove(int depth, int time_limit_ms) {
         auto start_time = std::chrono::high_resolution_clock::now();
         
-        auto [best_move, score] = engine.get_best_move(depth);
-        
+        // Iterative deepening: depth is the ceiling, time_limit_ms the budget
+        // (<= 0 searches the full depth with no time limit)
+        auto [best_move, score] = engine.get_best_move_timed(depth, time_limit_ms);
+
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        
+
         // Get evaluation for the current position
         int evaluation = engine.evaluate_position();
-        
+
         // Create JavaScript object to return
         val result = val::object();
         result.set("from_row", best_move.from_row);
@@ -80,7 +82,7 @@ public:
         result.set("flags", best_move.flags);  // Always include flags
         result.set("evaluation", evaluation);
         result.set("time_taken_ms", (int)duration.count());
-        result.set("depth_reached", depth);
+        result.set("depth_reached", engine.last_search_depth());
         
         // Check for promotion
         if (best_move.flags >= 4 && best_move.flags <= 7) {
@@ -0,0 +1,54 @@
+#!/bin/bash
+# Build the native offline game-analysis pipeline (src/analyze.cpp).
+#
+# Usage:
+#   ./build_analyze.sh
+#   ./analyze <games.txt> <out.bin> [depth] [threads] [hash_mb]
+#
+# Ingests an archive of finished games (one per line, extended fen plus
+# move list), fans the games out across the engine thread pool as
+# independent fixed-depth workers and streams per-move scores and best
+# moves to a binary file for the post-game review feature. See the header
+# of src/analyze.cpp for the input and output formats. Native-only, not
+# part of the WASM module (see build_wasm.sh for that).
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+cd "$SCRIPT_DIR"
+
+g++ -O3 -std=c++17 \
+  -DNDEBUG \
+  -DUSE_POPCNT \
+  -DNO_PREFETCH \
+  -DIS_64BIT \
+  -I src \
+  src/analyze.cpp \
+  src/benchmark.cpp \
+  src/absorb_tables.cpp \
+  src/bitbase.cpp \
+  src/bitboard.cpp \
+  src/book.cpp \
+  src/endgame.cpp \
+  src/evaluate.cpp \
+  src/material.cpp \
+  src/misc.cpp \
+  src/movegen.cpp \
+  src/movepick.cpp \
+  src/pawns.cpp \
+  src/position.cpp \
+  src/psqt.cpp \
+  src/search.cpp \
+  src/thread.cpp \
+  src/timeman.cpp \
+  src/tt.cpp \
+  src/uci.cpp \
+  src/ucioption.cpp \
+  src/tune.cpp \
+  -o analyze \
+  -lpthread
+
+if [ $? -eq 0 ]; then
+    echo "✅ analyze build successful: $SCRIPT_DIR/analyze"
+else
+    echo "❌ analyze build failed!"
+    exit 1
+fi
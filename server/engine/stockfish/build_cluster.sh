@@ -0,0 +1,55 @@
+#!/bin/bash
+# Build the cluster analysis coordinator (src/cluster.cpp).
+#
+# Usage:
+#   ./build_cluster.sh
+#   ./cluster <hosts.txt> "<fen> [moves <uci>...]" [depth] [node_threads] [node_hash_mb]
+#
+# Splits the root moves of one deep search across worker engine processes
+# listed in the hosts file (any shell command speaking UCI on stdin/stdout,
+# e.g. "ssh node3 /opt/absorb/stockfish"), shares the best score between
+# nodes through the "go rootbound" extension and merges the PVs. For the
+# analysis jobs that stay wall-clock-bound after Lazy SMP fills one box.
+# See the header of src/cluster.cpp for the protocol and the trade-offs.
+# Native-only, not part of the WASM module (see build_wasm.sh for that).
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+cd "$SCRIPT_DIR"
+
+g++ -O3 -std=c++17 \
+  -DNDEBUG \
+  -DUSE_POPCNT \
+  -DNO_PREFETCH \
+  -DIS_64BIT \
+  -I src \
+  src/cluster.cpp \
+  src/benchmark.cpp \
+  src/absorb_tables.cpp \
+  src/bitbase.cpp \
+  src/bitboard.cpp \
+  src/book.cpp \
+  src/endgame.cpp \
+  src/evaluate.cpp \
+  src/material.cpp \
+  src/misc.cpp \
+  src/movegen.cpp \
+  src/movepick.cpp \
+  src/pawns.cpp \
+  src/position.cpp \
+  src/psqt.cpp \
+  src/search.cpp \
+  src/thread.cpp \
+  src/timeman.cpp \
+  src/tt.cpp \
+  src/uci.cpp \
+  src/ucioption.cpp \
+  src/tune.cpp \
+  -o cluster \
+  -lpthread
+
+if [ $? -eq 0 ]; then
+    echo "✅ cluster build successful: $SCRIPT_DIR/cluster"
+else
+    echo "❌ cluster build failed!"
+    exit 1
+fi
@@ -0,0 +1,55 @@
+#!/bin/bash
+# Build the native self-play match harness (src/match.cpp).
+#
+# Usage:
+#   ./build_match.sh
+#   ./match <engineA> <engineB> [pairs] [threads] [tc_ms] [inc_ms] \
+#           [elo0] [elo1] [absorb | default | "<fen>"]
+#
+# The harness plays two UCI engine binaries against each other over a
+# position corpus with per-game clocks, game pairs spread across worker
+# threads, and reports the Elo difference with SPRT early stopping plus
+# node/time statistics. It is the strength gate behind the performance
+# work: bench proves a change is faster, match proves it is not weaker.
+# Native-only, not part of the WASM module (see build_wasm.sh for that).
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+cd "$SCRIPT_DIR"
+
+g++ -O3 -std=c++17 \
+  -DNDEBUG \
+  -DUSE_POPCNT \
+  -DNO_PREFETCH \
+  -DIS_64BIT \
+  -I src \
+  src/match.cpp \
+  src/benchmark.cpp \
+  src/absorb_tables.cpp \
+  src/bitbase.cpp \
+  src/bitboard.cpp \
+  src/book.cpp \
+  src/endgame.cpp \
+  src/evaluate.cpp \
+  src/material.cpp \
+  src/misc.cpp \
+  src/movegen.cpp \
+  src/movepick.cpp \
+  src/pawns.cpp \
+  src/position.cpp \
+  src/psqt.cpp \
+  src/search.cpp \
+  src/thread.cpp \
+  src/timeman.cpp \
+  src/tt.cpp \
+  src/uci.cpp \
+  src/ucioption.cpp \
+  src/tune.cpp \
+  -o match \
+  -lpthread
+
+if [ $? -eq 0 ]; then
+    echo "✅ match build successful: $SCRIPT_DIR/match"
+else
+    echo "❌ match build failed!"
+    exit 1
+fi
@@ -0,0 +1,51 @@
+#!/bin/bash
+# Build the native parallel perft tool (src/perft.cpp).
+#
+# Usage:
+#   ./build_perft.sh
+#   ./perft [depth] [threads] ["<fen> [moves ...]" | absorb | default]
+#
+# The tool is native-only: it is the movegen correctness gate and the
+# microbenchmark for move generation + do/undo throughput, and is not part
+# of the WASM module (see build_wasm.sh for that).
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+cd "$SCRIPT_DIR"
+
+g++ -O3 -std=c++17 \
+  -DNDEBUG \
+  -DUSE_POPCNT \
+  -DNO_PREFETCH \
+  -DIS_64BIT \
+  -I src \
+  src/perft.cpp \
+  src/benchmark.cpp \
+  src/absorb_tables.cpp \
+  src/bitbase.cpp \
+  src/bitboard.cpp \
+  src/book.cpp \
+  src/endgame.cpp \
+  src/evaluate.cpp \
+  src/material.cpp \
+  src/misc.cpp \
+  src/movegen.cpp \
+  src/movepick.cpp \
+  src/pawns.cpp \
+  src/position.cpp \
+  src/psqt.cpp \
+  src/search.cpp \
+  src/thread.cpp \
+  src/timeman.cpp \
+  src/tt.cpp \
+  src/uci.cpp \
+  src/ucioption.cpp \
+  src/tune.cpp \
+  -o perft \
+  -lpthread
+
+if [ $? -eq 0 ]; then
+    echo "✅ perft build successful: $SCRIPT_DIR/perft"
+else
+    echo "❌ perft build failed!"
+    exit 1
+fi
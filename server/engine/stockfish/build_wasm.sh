@@ -1,5 +1,48 @@
 #!/bin/bash
 # Build script for Absorb Chess WASM in WSL/Linux
+#
+# Usage:
+#   ./build_wasm.sh            Single-threaded build (default)
+#   ./build_wasm.sh --threads  Multithreaded build (pthreads + SharedArrayBuffer)
+#   ./build_wasm.sh --simd     WASM SIMD128 build (-msimd128): the compiler
+#                              vectorizes the bitboard OR/AND chains and the
+#                              hand-written kernels in bitboard.h/position.cpp
+#                              use wasm_simd128 intrinsics (USE_WASM_SIMD).
+#   ./build_wasm.sh --trace    Re-enable the verbose console/stdout logging
+#                              (compiled out by default; see ABSORB_TRACE in
+#                              src/absorb_chess_wasm.cpp). Combinable with
+#                              --threads.
+#   ./build_wasm.sh --fixed-heap[=MB]
+#                              Fixed-heap memory plan for a hash budget of MB
+#                              megabytes (default 64): the linear memory is
+#                              sized once at link time and never grows, so no
+#                              mid-search allocation can trigger the growth
+#                              stall that ALLOW_MEMORY_GROWTH risks. Pairs
+#                              with the per-search arena (Arena in misc.h)
+#                              that the wrapper feeds the root-move and PV
+#                              structures from; setHashSize() clamps to the
+#                              budget in this configuration.
+#   ./build_wasm.sh --pgo      Two-stage profile-guided build, the WASM
+#                              counterpart of the Makefile's profile-build
+#                              target: compile instrumented, run the absorb
+#                              bench corpus (pgo_bench.js) under node, then
+#                              rebuild with the profile, -O3 and LTO.
+#                              Requires node and the emsdk LLVM tools.
+# Options are combinable; --threads and --simd each add a suffix to the output
+# module name (_mt, _simd).
+#
+# The threaded build produces absorb_chess_engine_mt.js/.wasm and requires the
+# page to be served with COOP/COEP headers so SharedArrayBuffer is available:
+#   Cross-Origin-Opener-Policy: same-origin
+#   Cross-Origin-Embedder-Policy: require-corp
+# When SharedArrayBuffer is unavailable the frontend should fall back to the
+# single-threaded module; the engine API is identical (setThreadCount() just
+# reports 1 there).
+#
+# The SIMD build requires wasm SIMD support in the browser (all evergreen
+# browsers since ~2021). The frontend should feature-detect it, e.g. with
+# WebAssembly.validate() on a module using a v128 instruction (the wasm-feature-
+# detect npm package does exactly this), and fall back to the plain module.
 
 echo "🔧 Building Absorb Chess WASM Engine..."
 
@@ -18,85 +61,184 @@ fi
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 cd "$SCRIPT_DIR"
 
+THREAD_FLAGS=""
+SIMD_FLAGS=""
+TRACE_FLAGS=""
+# Default memory plan: grow on demand up to 256 MB. Growth can reallocate
+# the linear memory, which on some browsers stalls the worker for tens of
+# milliseconds at an unpredictable moment mid-search; --fixed-heap trades
+# the flexibility away for a memory size that never changes.
+MEM_FLAGS="-s ALLOW_MEMORY_GROWTH=1 -s MAXIMUM_MEMORY=268435456"
+PGO=""
+SUFFIX=""
+
+for arg in "$@"; do
+    case "$arg" in
+        --threads)
+            echo "🧵 Multithreaded build (pthreads + SharedArrayBuffer)"
+            # PTHREAD_POOL_SIZE pre-spawns the workers so Threads.set() never has to
+            # yield to the browser to create one (see note (B) in thread.cpp).
+            THREAD_FLAGS="-pthread -s PTHREAD_POOL_SIZE=8"
+            SUFFIX="${SUFFIX}_mt"
+            ;;
+        --simd)
+            echo "⚡ SIMD build (wasm SIMD128)"
+            SIMD_FLAGS="-msimd128 -DUSE_WASM_SIMD"
+            ;;
+        --trace)
+            echo "🔍 Trace build (verbose console logging enabled)"
+            TRACE_FLAGS="-DABSORB_TRACE"
+            ;;
+        --pgo)
+            echo "📊 Profile-guided build (instrument, train, rebuild)"
+            PGO=1
+            ;;
+        --fixed-heap|--fixed-heap=*)
+            # Fixed-heap memory plan, sized from the hash budget: the linear
+            # memory is allocated once at the final size and never grows, so
+            # move latency stays predictable for the blitz time manager. The
+            # base of 64 MB covers code, engine statics, the per-thread
+            # tables of the 8-thread build, the 4 MB search arena and slack
+            # for the remaining malloc traffic (setHashSize() clamps to the
+            # budget, so nothing can outgrow the plan).
+            TT_MB="${arg#--fixed-heap}"
+            TT_MB="${TT_MB#=}"
+            TT_MB="${TT_MB:-64}"
+            HEAP_BYTES=$(( (TT_MB + 64) * 1048576 ))
+            MEM_FLAGS="-s ALLOW_MEMORY_GROWTH=0 -s INITIAL_MEMORY=$HEAP_BYTES -s MAXIMUM_MEMORY=$HEAP_BYTES -DABSORB_FIXED_HEAP_MB=$TT_MB"
+            echo "📐 Fixed-heap build: $((TT_MB + 64)) MB linear memory for a $TT_MB MB hash"
+            ;;
+        *)
+            echo "❌ Unknown option: $arg"
+            exit 1
+            ;;
+    esac
+done
+
+# Append _simd after _mt so the module names are stable regardless of the
+# order the options were given in.
+[ -n "$SIMD_FLAGS" ] && SUFFIX="${SUFFIX}_simd"
+OUTPUT="../../frontend/engine/absorb_chess_engine${SUFFIX}.js"
+
 echo "✅ Emscripten found, compiling..."
 
-# Compile with Emscripten
-emcc -O2 \
-  -std=c++17 \
-  -DNDEBUG \
-  -DUSE_POPCNT \
-  -DNO_PREFETCH \
-  -I src \
-  -s EXPORTED_FUNCTIONS="['_malloc','_free']" \
-  -s EXPORTED_RUNTIME_METHODS="['ccall','cwrap']" \
-  -s MODULARIZE=1 \
-  -s EXPORT_NAME="AbsorbChessModule" \
-  -s ALLOW_MEMORY_GROWTH=1 \
-  -s MAXIMUM_MEMORY=268435456 \
-  -s STACK_SIZE=8388608 \
-  -s DISABLE_EXCEPTION_CATCHING=0 \
-  -s ASSERTIONS=0 \
-  --bind \
-  src/absorb_chess_wasm.cpp \
+SRCS="src/absorb_chess_wasm.cpp \
   src/absorb_tables.cpp \
+  src/benchmark.cpp \
+  src/bitbase.cpp \
   src/bitboard.cpp \
+  src/book.cpp \
   src/endgame.cpp \
   src/evaluate.cpp \
   src/material.cpp \
+  src/misc.cpp \
   src/movegen.cpp \
   src/movepick.cpp \
+  src/pawns.cpp \
   src/position.cpp \
   src/psqt.cpp \
   src/search.cpp \
   src/thread.cpp \
+  src/timeman.cpp \
   src/tt.cpp \
   src/uci.cpp \
   src/ucioption.cpp \
-  src/tune.cpp \
-  src/syzygy/tbprobe.cpp \
-  -o "../../frontend/engine/absorb_chess_engine.js"
-
-if [ $? -eq 0 ]; then
-    echo "✅ WASM build successful!"
-    echo "📁 Output files:"
-    echo "   ../../frontend/engine/absorb_chess_engine.js"
-    echo "   ../../frontend/engine/absorb_chess_engine.wasm"
-    echo ""
-    echo "🎯 Next steps:"
-    echo "   1. Update frontend/engine/engine.js to use AbsorbChessModule"
-    echo "   2. Test the absorb chess functionality"
+  src/tune.cpp"
+
+# One emcc invocation shared by the plain and the PGO builds. The first
+# argument is the output module, everything after it is extra flags
+# (optimization level, profile instrumentation, LTO, ...).
+# IS_64BIT: wasm has native 64-bit integers, and the precomputed magics in
+# src/magics.h are only valid for the 64-bit index scheme.
+compile_wasm() {
+    local out="$1"
+    shift
+    emcc "$@" \
+      -std=c++17 \
+      -DNDEBUG \
+      -DUSE_POPCNT \
+      -DIS_64BIT \
+      -DNO_PREFETCH \
+      -I src \
+      $THREAD_FLAGS \
+      $SIMD_FLAGS \
+      $TRACE_FLAGS \
+      -s EXPORTED_FUNCTIONS="['_malloc','_free']" \
+      -s EXPORTED_RUNTIME_METHODS="['ccall','cwrap']" \
+      -s MODULARIZE=1 \
+      -s EXPORT_NAME="AbsorbChessModule" \
+      $MEM_FLAGS \
+      -s STACK_SIZE=8388608 \
+      -s DISABLE_EXCEPTION_CATCHING=0 \
+      -s ASSERTIONS=0 \
+      --bind \
+      $SRCS \
+      -o "$out"
+}
+
+if [ -n "$PGO" ]; then
+    # Two-stage profile-guided build, the WASM counterpart of the Makefile's
+    # profile-build target. Stage 1 compiles with instrumentation and runs
+    # the absorb bench corpus under node (NODERAWFS so the profile lands on
+    # the real filesystem); stage 2 recompiles with the merged profile, -O3
+    # and LTO. The branch-heavy ability dispatch in absorb_tables.cpp and
+    # the staged movepicker are where the profile pays.
+    if ! command -v node &> /dev/null; then
+        echo "❌ node is required for the PGO training run"
+        exit 1
+    fi
+
+    LLVM_PROFDATA="llvm-profdata"
+    if ! command -v "$LLVM_PROFDATA" &> /dev/null; then
+        # emsdk does not put its LLVM tools on the PATH
+        LLVM_PROFDATA="$(dirname "$(command -v emcc)")/../bin/llvm-profdata"
+        if [ ! -x "$LLVM_PROFDATA" ]; then
+            echo "❌ llvm-profdata not found (checked PATH and the emsdk upstream bin)"
+            exit 1
+        fi
+    fi
+
+    PROFILE_DIR="$SCRIPT_DIR/pgo_profile"
+    rm -rf "$PROFILE_DIR"
+    mkdir -p "$PROFILE_DIR"
+
+    echo "📊 Stage 1/2: instrumented build..."
+    compile_wasm "$PROFILE_DIR/instrumented.js" -O2 \
+        -fprofile-instr-generate="$PROFILE_DIR/absorb-%p.profraw" \
+        -s NODERAWFS=1 || { echo "❌ Instrumented build failed!"; exit 1; }
+
+    echo "🏃 Training run: absorb bench corpus under node..."
+    node pgo_bench.js "$PROFILE_DIR/instrumented.js" \
+        || { echo "❌ Training run failed!"; exit 1; }
+
+    "$LLVM_PROFDATA" merge -output="$PROFILE_DIR/absorb.profdata" \
+        "$PROFILE_DIR"/absorb-*.profraw \
+        || { echo "❌ Profile merge failed!"; exit 1; }
+
+    echo "🚀 Stage 2/2: optimized build with profile + LTO..."
+    compile_wasm "$OUTPUT" -O3 -flto \
+        -fprofile-instr-use="$PROFILE_DIR/absorb.profdata" \
+        || { echo "❌ PGO build failed!"; exit 1; }
+
+    # emcc already runs wasm-opt as part of -O3; an extra converging pass
+    # squeezes out the last few percent when the binaryen tools are around
+    if command -v wasm-opt &> /dev/null; then
+        echo "🔩 Extra wasm-opt pass..."
+        wasm-opt -O3 --converge "${OUTPUT%.js}.wasm" -o "${OUTPUT%.js}.wasm"
+    fi
 else
-    echo "❌ WASM build failed!"
-    echo "💡 Check that all source files exist and dependencies are met"
-    exit 1
+    compile_wasm "$OUTPUT" -O2 || {
+        echo "❌ WASM build failed!"
+        echo "💡 Check that all source files exist and dependencies are met"
+        exit 1
+    }
 fi
-movegen.cpp
-movepick.cpp
-pawns.cpp
-position.cpp
-psqt.cpp
-search.cpp
-thread.cpp
-timeman.cpp
-tt.cpp
-tune.cpp
-uci.cpp
-ucioption.cpp
-"
-
-# Build command
-echo "Building Absorb Chess Stockfish WASM..."
-
-emcc $CXXFLAGS $WASM_FLAGS $BIND_FLAGS \
-    -I. \
-    $SOURCES \
-    -o absorb_chess_stockfish.js
-
-if [ $? -eq 0 ]; then
-    echo "Build successful! Files generated:"
-    echo "  - absorb_chess_stockfish.js"
-    echo "  - absorb_chess_stockfish.wasm"
-else
-    echo "Build failed!"
-    exit 1
-fi
\ No newline at end of file
+
+echo "✅ WASM build successful!"
+echo "📁 Output files:"
+echo "   $OUTPUT"
+echo "   ${OUTPUT%.js}.wasm"
+echo ""
+echo "🎯 Next steps:"
+echo "   1. Update frontend/engine/engine.js to use AbsorbChessModule"
+echo "   2. Test the absorb chess functionality"
@@ -1,14 +1,35 @@
-// gen_magics.cpp
-// Generates rook and bishop magic numbers compatible with:
-// index = unsigned(((occupied & mask) * magic) >> shift);
-// Assumes 64-bit Bitboard, no PEXT (HasPext=false)
+// generate_magics.cpp
+// Offline generator for the shared magic attack table (src/magics.h).
+//
+// For every rook and bishop square it searches a verified magic number for
+// index = unsigned(((occupied & mask) * magic) >> shift), then packs all 128
+// per-square attack ranges into ONE shared table: each square's range is
+// slid to the lowest offset where every populated slot is either free or
+// already holds the same attack bitboard (magic collisions map equal
+// attacks, so overlaps between squares are legal whenever the values agree),
+// and trailing holes are trimmed. Several candidate magics are tried per
+// square and the one that packs tightest wins. With conventional random
+// magics the images are dense and usable overlap is essentially nil, so the
+// layout comes out close to concatenation; the offset indirection is what
+// lets better (solver-found) constants drop in later without touching the
+// engine.
+//
+// The result is emitted as src/magics.h: a magic and a table offset per
+// square plus the total table size. The engine (bitboard.cpp) fills the
+// shared table at startup from these constants; no magic search happens at
+// init and the table is smaller than the separate rook + bishop tables.
+//
+// Assumes the 64-bit index scheme (IS_64BIT), which both the native and the
+// WASM build use. Every magic is verified here before being emitted, and the
+// packed table is verified once more as a whole; the generator aborts rather
+// than emit anything unverified.
+//
+// Usage: g++ -O2 -std=c++17 generate_magics.cpp -o generate_magics
+//        ./generate_magics > src/magics.h
 #include <bits/stdc++.h>
 using namespace std;
 using U64 = unsigned long long;
 int popcount64(U64 x){ return __builtin_popcountll(x); }
-static std::mt19937_64 rng((unsigned)chrono::high_resolution_clock::now().time_since_epoch().count());
-U64 rnd64(){ return rng(); }
-U64 rnd64_fewbits(){ return rnd64() & rnd64() & rnd64(); }
 inline int rank_of(int s){ return s/8; }
 inline int file_of(int s){ return s%8; }
 inline U64 square_bb(int s){ return 1ULL << s; }
@@ -35,13 +56,9 @@ U64 bishop_mask(int sq) {
     return m;
 }
 
-
 // Sliding attack logic adapted from the engine implementation. The generator
 // uses plain ints/U64 for compatibility while keeping the same stepping
 // behaviour (prevents wrap-around across files).
-// Re-implement sliding attack behaviour using the exact stepping logic
-// used by the engine: use Direction arrays and the "while(safe_destination(s,d) && !(occupied & s)) attacks |= (s += d);"
-// This keeps variable names and loop structure similar to the engine implementation.
 static inline bool is_ok_sq(int s) { return (s >= 0 && s < 64); }
 static inline int sq_distance(int s1, int s2) {
     int f1 = file_of(s1), r1 = rank_of(s1);
@@ -64,7 +81,6 @@ static inline U64 sliding_attack_on_the_fly(bool rook, int sq, U64 occupied) {
     for (int i = 0; i < 4; ++i) {
         int d = dirs[i];
         int s = sq;
-        // Mirror engine loop: while(safe_destination(s, d) && !(occupied & s)) attacks |= (s += d);
         while (safe_destination_int(s, d) && !(occupied & (1ULL << s))) {
             s += d;
             attacks |= (1ULL << s);
@@ -74,15 +90,6 @@ static inline U64 sliding_attack_on_the_fly(bool rook, int sq, U64 occupied) {
     return attacks;
 }
 
-// Generator helper wrappers expected by the rest of this program
-static inline U64 rook_attacks_on_the_fly(int sq, U64 occupied) {
-    return sliding_attack_on_the_fly(true, sq, occupied);
-}
-
-static inline U64 bishop_attacks_on_the_fly(int sq, U64 occupied) {
-    return sliding_attack_on_the_fly(false, sq, occupied);
-}
-
 vector<int> mask_bits(U64 mask){
     vector<int> bits;
     U64 m = mask;
@@ -102,86 +109,228 @@ unsigned transform_idx(U64 occ, U64 magic, unsigned shift){
     return unsigned((occ * magic) >> shift);
 }
 
-U64 find_magic_for_square(int sq, bool rook){
-    U64 mask = rook ? rook_mask(sq) : bishop_mask(sq);
-    auto bits = mask_bits(mask);
-    int B = (int)bits.size();
-    int subsets = 1<<B;
-
-    // Precompute occupancies and reference attacks
-    vector<U64> occupancy(subsets), reference(subsets);
-    for (int i=0;i<subsets;++i){
-        occupancy[i] = index_to_occ(i, bits);
-        reference[i] = rook ? rook_attacks_on_the_fly(sq, occupancy[i])
-                            : bishop_attacks_on_the_fly(sq, occupancy[i]);
-    }
-
-    unsigned shift = 64 - B;
+// One square's worth of work: the reference attacks for every occupancy
+// subset, and after the search the chosen magic plus its table image.
+struct SquareJob {
+    bool rook;
+    int sq;
+    U64 mask;
+    int maskBits;             // popcount(mask)
+    int bits;                 // index width actually used (<= maskBits)
+    int tableSize;            // 1 << bits
+    vector<U64> occupancy;    // all mask subsets
+    vector<U64> reference;    // attack set per subset
+    U64 magic = 0;
+    unsigned offset = 0;      // into the shared table
+};
 
-    // Engine-like epoch verification to avoid clearing table each attempt
-    const int tableSize = 1 << B;
-    vector<int> epoch(tableSize, 0);
-    vector<U64> table(tableSize, 0ULL);
+// Search a verified magic mapping every subset into 1 << bits slots, where
+// collisions are allowed only between equal attack sets. Deterministic:
+// seeded per square so reruns reproduce src/magics.h bit for bit. Returns 0
+// when the attempt budget runs out; a fallback "approximate" magic would
+// silently corrupt move generation.
+U64 find_magic(const SquareJob& job, int bits, long attemptCap, U64 seed){
 
-    // Seeded RNG to mirror engine behaviour (per-rank seed could be used)
-    std::mt19937_64 local_rng((unsigned)chrono::high_resolution_clock::now().time_since_epoch().count());
+    std::mt19937_64 rng(seed);
+    auto rnd_fewbits = [&]{ return rng() & rng() & rng(); };
 
-    const int MAX_ATTEMPTS = 20000000; // hard cap to avoid infinite loops
-    int attempts = 0;
-    int counter = 1;
+    unsigned shift = 64 - bits;
+    int subsets = 1 << job.maskBits;
+    vector<int> epoch(size_t(1) << bits, 0);
+    vector<U64> table(size_t(1) << bits, 0ULL);
+    int counter = 0;
 
-    while (attempts < MAX_ATTEMPTS) {
-        ++attempts;
-        U64 magic = local_rng();
-
-        if (popcount64((mask * magic) & 0xFF00000000000000ULL) < 4) continue;
+    for (long attempts = 0; attempts < attemptCap; ++attempts) {
+        U64 magic = rnd_fewbits();
+        if (popcount64((job.mask * magic) >> 56) < 6) continue;
 
         ++counter;
         bool fail = false;
-
         for (int i = 0; i < subsets; ++i) {
-            unsigned idx = transform_idx(occupancy[i], magic, shift);
+            unsigned idx = transform_idx(job.occupancy[i], magic, shift);
             if (epoch[idx] < counter) {
                 epoch[idx] = counter;
-                table[idx] = reference[i];
-            } else if (table[idx] != reference[i]) {
+                table[idx] = job.reference[i];
+            } else if (table[idx] != job.reference[i]) {
                 fail = true;
                 break;
             }
         }
-
         if (!fail) return magic;
     }
 
-    // Fallback: warn and return a pseudo-random magic so generation can continue
-    cerr << "Warning: failed to find perfect magic for square " << sq << " (rook=" << rook
-         << ") after " << attempts << " attempts; returning fallback magic.\n";
-    return local_rng();
+    return 0;
+}
+
+// Build the (index -> attack) image of one magic, with a 'used' flag per
+// slot: a magic rarely touches every slot of its 2^bits range, and the holes
+// are exactly what lets other squares overlap it in the shared table.
+void build_image(const SquareJob& job, U64 magic,
+                 vector<U64>& values, vector<char>& used){
+
+    values.assign(job.tableSize, 0ULL);
+    used.assign(job.tableSize, 0);
+    unsigned shift = 64 - job.bits;
+    for (size_t i = 0; i < job.occupancy.size(); ++i) {
+        unsigned idx = transform_idx(job.occupancy[i], magic, shift);
+        values[idx] = job.reference[i];
+        used[idx] = 1;
+    }
+}
+
+// Lowest offset in the shared table where the image fits: every used slot of
+// the image must be free or already equal. Equal-value overlap is the whole
+// compression: identical attack sets (empty-board lines, near-empty boards)
+// recur constantly between neighbouring squares.
+unsigned find_offset(const vector<U64>& shared, const vector<char>& sharedUsed,
+                     const vector<U64>& values, const vector<char>& used){
+
+    for (unsigned o = 0; ; ++o) {
+        bool ok = true;
+        for (size_t i = 0; i < values.size(); ++i)
+            if (used[i] && o + i < shared.size()
+                && sharedUsed[o + i] && shared[o + i] != values[i]) {
+                ok = false;
+                break;
+            }
+        if (ok) return o;
+    }
 }
 
 int main(){
-    ios::fmtflags f = cout.flags();
-    cout << hex;
-    cout << "const uint64_t RookMagicNumbers[64] = {\n";
-    for (int s=0;s<64;++s){
-        U64 m = find_magic_for_square(s, true);
-        if (m == 0ULL){ cerr << "Failed rook " << s << "\n"; return 1; }
-        cout << "  0x" << m << "ULL,\n";
+
+    // Enumerate all 128 jobs
+    vector<SquareJob> jobs;
+    for (int rook = 1; rook >= 0; --rook)
+        for (int sq = 0; sq < 64; ++sq) {
+            SquareJob job;
+            job.rook = rook;
+            job.sq = sq;
+            job.mask = rook ? rook_mask(sq) : bishop_mask(sq);
+            job.maskBits = popcount64(job.mask);
+
+            int subsets = 1 << job.maskBits;
+            auto bits = mask_bits(job.mask);
+            job.occupancy.resize(subsets);
+            job.reference.resize(subsets);
+            for (int i = 0; i < subsets; ++i) {
+                job.occupancy[i] = index_to_occ(i, bits);
+                job.reference[i] = sliding_attack_on_the_fly(rook, sq, job.occupancy[i]);
+            }
+            jobs.push_back(std::move(job));
+        }
+
+    auto seed_for = [](const SquareJob& job, int variant){
+        return 0x9E3779B97F4A7C15ULL * (job.sq + 64 * job.rook + 128 * variant + 1);
+    };
+
+    // Pack dense ranges first: the conventional-width images are nearly
+    // solid and define the table skeleton, then the sparse oversized images
+    // interleave into whatever they left free.
+    vector<SquareJob*> order;
+    for (auto& j : jobs) order.push_back(&j);
+    stable_sort(order.begin(), order.end(),
+                [](const SquareJob* a, const SquareJob* b){
+                    return a->maskBits != b->maskBits ? a->maskBits > b->maskBits
+                                                     : a->sq < b->sq; });
+
+    vector<U64> shared;
+    vector<char> sharedUsed;
+    const int Candidates = 6; // magics tried per square and width; best packer wins
+
+    for (SquareJob* job : order) {
+
+        U64 bestMagic = 0;
+        unsigned bestOffset = 0, bestEnd = UINT_MAX, bestGrowth = UINT_MAX;
+        vector<U64> values, bestValues;
+        vector<char> used, bestUsed;
+
+        job->bits = job->maskBits;
+        job->tableSize = 1 << job->bits;
+
+        for (int c = 0; c < Candidates; ++c) {
+            U64 magic = find_magic(*job, job->bits, 100000000, seed_for(*job, c));
+            if (!magic)
+                continue;
+            build_image(*job, magic, values, used);
+
+            // The image's trailing holes need no table space
+            unsigned last = unsigned(used.size()) - 1;
+            while (last && !used[last]) --last;
+
+            unsigned offset = find_offset(shared, sharedUsed, values, used);
+            unsigned end = offset + last + 1;
+            unsigned growth = end > shared.size() ? end - unsigned(shared.size()) : 0;
+            if (growth < bestGrowth || (growth == bestGrowth && end < bestEnd)) {
+                bestGrowth = growth;
+                bestEnd = end;
+                bestMagic = magic;
+                bestOffset = offset;
+                bestValues = values;
+                bestUsed = used;
+            }
+        }
+
+        if (!bestMagic) {
+            cerr << "Failed to find magic for square " << job->sq
+                 << " (rook=" << job->rook << ")\n";
+            return 1;
+        }
+
+        job->magic = bestMagic;
+        job->offset = bestOffset;
+
+        if (shared.size() < bestEnd) {
+            shared.resize(bestEnd, 0ULL);
+            sharedUsed.resize(bestEnd, 0);
+        }
+        for (size_t i = 0; i < bestValues.size(); ++i)
+            if (bestUsed[i]) {
+                shared[bestOffset + i] = bestValues[i];
+                sharedUsed[bestOffset + i] = 1;
+            }
     }
-    cout << "};\n\n";
-    cout << "const uint64_t BishopMagicNumbers[64] = {\n";
-    for (int s=0;s<64;++s){
-        U64 m = find_magic_for_square(s, false);
-        if (m == 0ULL){ cerr << "Failed bishop " << s << "\n"; return 1; }
-        cout << "  0x" << m << "ULL,\n";
+
+    // Full verification of the packed result before emitting anything
+    for (const auto& job : jobs)
+        for (size_t i = 0; i < job.occupancy.size(); ++i) {
+            unsigned idx = transform_idx(job.occupancy[i], job.magic, 64 - job.bits);
+            if (shared[job.offset + idx] != job.reference[i]) {
+                cerr << "Verification failed: square " << job.sq
+                     << " (rook=" << job.rook << ")\n";
+                return 1;
+            }
+        }
+
+    size_t separate = 0x19000 + 0x1480; // the old split rook + bishop tables
+    cerr << "Shared table: " << shared.size() << " entries ("
+         << shared.size() * 8 << " bytes), was " << separate << " ("
+         << separate * 8 << ") split: "
+         << 100.0 * (separate - shared.size()) / separate << "% smaller\n";
+
+    // Emit src/magics.h
+    cout << "// Generated by generate_magics.cpp; do not edit by hand.\n";
+    cout << "//\n";
+    cout << "// Verified magic numbers and offsets into the shared sliding-attack table\n";
+    cout << "// (see bitboard.cpp). The shared table holds " << shared.size()
+         << " entries (" << shared.size() * 8 << " bytes)\n";
+    cout << "// against " << separate << " (" << separate * 8
+         << ") for the separate rook and bishop tables.\n\n";
+    cout << "#ifndef MAGICS_H_INCLUDED\n#define MAGICS_H_INCLUDED\n\n";
+    cout << "#include <cstdint>\n\n";
+    cout << "namespace MagicInit {\n\n";
+    cout << "constexpr unsigned SharedTableSize = " << shared.size() << ";\n\n";
+    cout << "struct Entry {\n  uint64_t magic;\n  unsigned offset;\n  unsigned shift;\n};\n";
+
+    for (int rook = 1; rook >= 0; --rook) {
+        cout << "\nconstexpr Entry " << (rook ? "Rook" : "Bishop") << "[64] = {\n";
+        for (const auto& job : jobs)
+            if (job.rook == bool(rook))
+                cout << "  { 0x" << hex << job.magic << "ULL, 0x" << job.offset
+                     << dec << ", " << (64 - job.bits) << " },\n";
+        cout << "};\n";
     }
-    cout << "};\n";
-    cout.flags(f);
-
-    // for(int x=0; x<64; x++){
-    //     cout << "Square " << x << " mask = 0x" << hex << rook_mask(x) << dec << " (" << popcount64(rook_mask(x)) << " bits)\n";
-    // }
-    // for(int x=0; x<64; x++)
-    // cout << "Square " << x << " mask = 0x" << hex << bishop_mask(x) << dec << " (" << popcount64(bishop_mask(x)) << " bits)\n";
+
+    cout << "\n} // namespace MagicInit\n\n#endif // #ifndef MAGICS_H_INCLUDED\n";
     return 0;
 }
@@ -0,0 +1,67 @@
+#!/usr/bin/env node
+// PGO training workload for build_wasm.sh --pgo.
+//
+// Drives the instrumented module through the code the shipped engine spends
+// its time in: scripted absorb games full of captures (so the ability
+// dispatch tables and the ability-aware movegen/eval paths run hot), plus
+// fixed-depth searches, a clock-driven search and a MultiPV analysis after
+// every few plies. Depths stay modest: the goal is branch coverage at
+// realistic frequencies, not deep lines, and the run has to stay under a
+// minute so the two-stage build remains pleasant to use.
+//
+// Usage: node pgo_bench.js path/to/instrumented.js
+
+'use strict';
+
+const path = require('path');
+
+const moduleJs = process.argv[2];
+if (!moduleJs) {
+    console.error('usage: node pgo_bench.js <instrumented-module.js>');
+    process.exit(1);
+}
+
+// Opening lines chosen so pieces absorb abilities early; every game mixes
+// quiet moves, captures and recaptures like real absorb games do.
+const GAMES = [
+    ['e2e4', 'd7d5', 'e4d5', 'd8d5', 'b1c3', 'd5a5', 'd2d4', 'g8f6',
+     'g1f3', 'c8f5', 'f3e5', 'b8d7', 'e5d7', 'f6d7'],
+    ['d2d4', 'd7d5', 'c2c4', 'd5c4', 'g1f3', 'g8f6', 'e2e3', 'c8g4',
+     'f1c4', 'e7e6', 'd1c2', 'g4f3', 'g2f3', 'b8d7'],
+    ['e2e4', 'e7e5', 'g1f3', 'b8c6', 'f1b5', 'a7a6', 'b5c6', 'd7c6',
+     'e1g1', 'f7f6', 'd2d4', 'e5d4', 'f3d4', 'c6c5'],
+];
+
+const SEARCH_EVERY = 4;  // plies between searches
+const DEPTH = 9;
+
+const AbsorbChessModule = require(path.resolve(moduleJs));
+
+AbsorbChessModule().then(Module => {
+    for (const game of GAMES) {
+        const engine = new Module.WasmChessEngine();
+
+        for (let ply = 0; ply < game.length; ply++) {
+            if (!engine.pushMove(game[ply])) {
+                console.error(`illegal scripted move ${game[ply]} at ply ${ply}`);
+                process.exit(1);
+            }
+
+            if ((ply + 1) % SEARCH_EVERY === 0) {
+                engine.findBestMove(DEPTH, 0);
+                engine.analyze(DEPTH - 2, 3);
+            }
+        }
+
+        // Clock-driven search exercises the time-management paths
+        engine.setMoveOverhead(50);
+        engine.findBestMoveTimed(30000, 30000, 300, 300, DEPTH + 1);
+
+        engine.delete();
+    }
+
+    console.log('pgo_bench: training run complete');
+}).catch(err => {
+    console.error('pgo_bench failed:', err);
+    process.exit(1);
+});
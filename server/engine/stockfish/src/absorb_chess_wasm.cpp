@@ -6,6 +6,7 @@
 
 #include <emscripten/emscripten.h>
 #include <emscripten/bind.h>
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -13,6 +14,8 @@
 #include <chrono>
 #include <functional>
 
+#include "book.h"
+#include "endgame.h"
 #include "position.h"
 #include "search.h"
 #include "thread.h"
@@ -23,13 +26,66 @@
 
 using namespace emscripten;
 
+// Verbose tracing stalls the WASM worker on every console/stdout crossing,
+// so it is compiled out unless the module is built with -DABSORB_TRACE
+// (./build_wasm.sh --trace). Error reporting on exception paths stays
+// unconditional; everyday observability comes from the cheap counters
+// exposed through getSearchStats() instead.
+#ifdef ABSORB_TRACE
+#define TRACE(...) do { __VA_ARGS__; } while (0)
+#else
+#define TRACE(...) do {} while (0)
+#endif
+
 class WasmChessEngine {
 private:
     Position pos;
     StateListPtr states;
+    std::vector<Move> moveHistory; // moves played via makeMove(), for popMove()
     Thread* mainThread;
     bool initialized;
-    
+
+    // Counters from the most recent findBestMove() call, read back through
+    // getSearchStats() in a single embind crossing
+    struct SearchStats {
+        uint64_t nodes = 0;          // nodes searched
+        uint64_t evalCalls = 0;      // static evaluations performed
+        int ttHitPermille = 0;       // running TT hit rate, per-mille
+        int evalCacheHitPermille = 0; // eval cache hit rate, per-mille
+        int abilityRootMoves = 0;    // root moves using an absorbed ability
+        int searchTimeMs = 0;        // time inside the search itself
+        int totalTimeMs = 0;         // including root staging and conversion
+        int depthReached = 0;
+        int hashfull = 0;            // TT occupancy after the search, per-mille
+    };
+    SearchStats lastSearch;
+
+    // Preallocated result buffers for the packed return path; the typed-array
+    // views handed to JS point straight at these (see getLegalMovesPacked())
+    int32_t legalMovesBuffer[MAX_MOVES];
+    int32_t bestMoveBuffer[9];
+    std::string snapshotBuffer; // backs the view returned by saveSnapshot()
+
+    // State of the cooperative search driven by startSearch()/stepSearch()
+    struct AsyncSearch {
+        bool active = false;
+        bool finished = false;
+        int targetDepth = 0;   // stop once this depth has completed
+        int budgetMs = 0;      // total time budget, 0 = none
+        int elapsedMs = 0;     // time consumed by the steps so far
+        int nextDepth = 1;     // depth the next stepSearch() will complete
+        Move bestMove = MOVE_NONE;
+        Value bestScore = VALUE_ZERO;
+        int bestDepth = 0;     // deepest fully completed iteration
+        bool ponder = false;   // search runs on a speculative opponent reply
+        Move ponderMove = MOVE_NONE; // the reply played into pos by startPonder()
+    };
+    AsyncSearch async;
+
+    // Opponent reply predicted by the last search (second PV move), the seed
+    // for startPonder(). MOVE_NONE when the PV ended after our move.
+    Move predictedReply = MOVE_NONE;
+
     // Convert frontend coordinates (0-7, top-left origin) to Stockfish squares
     Square frontendToSquare(int row, int col) {
         // Frontend: row 0 is top (rank 8), col 0 is left (file a)
@@ -94,52 +150,67 @@ private:
 public:
     WasmChessEngine() : initialized(false) {
         try {
-            EM_ASM(console.log("🚀 [WASM] Starting WasmChessEngine constructor..."));
+            TRACE(EM_ASM(console.log("🚀 [WASM] Starting WasmChessEngine constructor...")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 1: UCI::init(Options)..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 1: UCI::init(Options)...")));
             UCI::init(Options);
-            EM_ASM(console.log("✅ [WASM] Step 1 completed: UCI::init"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 1 completed: UCI::init")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 2: AbsorbChess::init_tables()..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 2: AbsorbChess::init_tables()...")));
             AbsorbChess::init_tables();  // Initialize our lookup tables
-            EM_ASM(console.log("✅ [WASM] Step 2 completed: AbsorbChess::init_tables"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 2 completed: AbsorbChess::init_tables")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 3: Bitboards::init()..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 3: Bitboards::init()...")));
             Bitboards::init();
-            EM_ASM(console.log("✅ [WASM] Step 3 completed: Bitboards::init"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 3 completed: Bitboards::init")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 4: Position::init()..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 4: Position::init()...")));
             Position::init();
-            EM_ASM(console.log("✅ [WASM] Step 4 completed: Position::init"));
-            
-            EM_ASM(console.log("⏳ [WASM] Step 5: Threads (disabled in WASM single-thread)..."));
-            // Threads are disabled in this WASM build; we'll run searches synchronously
-            EM_ASM(console.log("✅ [WASM] Step 5 completed: Threads disabled"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 4 completed: Position::init")));
+
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 5: Endgames::init()...")));
+            // Without this the endgame map stayed empty and every endgame
+            // node fell through to the generic evaluation
+            Endgames::init();
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 5 completed: Endgames::init")));
+
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 6: Threads.set_synchronous()...")));
+            // No workers in this WASM build; searches run on the caller's stack
+            Threads.set_synchronous();
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 6 completed: Threads.set_synchronous")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 6: Search::clear()..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 7: Search::clear()...")));
             Search::clear();
-            EM_ASM(console.log("✅ [WASM] Step 6 completed: Search::clear"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 7 completed: Search::clear")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 7: TT.resize(16)..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 8: TT.resize(16)...")));
             TT.resize(16);  // Small hash table for WASM
-            EM_ASM(console.log("✅ [WASM] Step 7 completed: TT.resize"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 8 completed: TT.resize")));
+
+            // Per-search structures (root moves and their PVs) draw from
+            // this arena from now on, so a running search never touches the
+            // system allocator and - in the fixed-heap build - never grows
+            // the linear memory mid-search. 4 MB is two orders of magnitude
+            // above what a search actually uses; overflows fall back to
+            // malloc and are reported in getSearchStats().
+            Arena::init(4 * 1024 * 1024);
             
-            EM_ASM(console.log("⏳ [WASM] Step 8: Threads.main() (skipped in WASM single-thread)..."));
-            mainThread = nullptr;
-            EM_ASM(console.log("✅ [WASM] Step 8 completed: mainThread set to nullptr"));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 9: Threads.main()...")));
+            mainThread = Threads.main();
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 9 completed: mainThread set")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 9: Creating states..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 10: Creating states...")));
             states = StateListPtr(new std::deque<StateInfo>(1));
-            EM_ASM(console.log("✅ [WASM] Step 9 completed: states created"));
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 10 completed: states created")));
             
-            EM_ASM(console.log("⏳ [WASM] Step 10: Setting position..."));
+            TRACE(EM_ASM(console.log("⏳ [WASM] Step 11: Setting position...")));
             // Use standard starting position FEN
             const std::string startingFEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
-            pos.set(startingFEN, false, &states->back(), nullptr);
-            EM_ASM(console.log("✅ [WASM] Step 10 completed: position set"));
+            pos.set(startingFEN, false, &states->back(), mainThread);
+            TRACE(EM_ASM(console.log("✅ [WASM] Step 11 completed: position set")));
             
             initialized = true;
-            EM_ASM(console.log("🎉 [WASM] Constructor completed successfully!"));
+            TRACE(EM_ASM(console.log("🎉 [WASM] Constructor completed successfully!")));
         } catch (const std::exception& e) {
             EM_ASM({
                 console.error("❌ [WASM] Constructor failed with exception: " + UTF8ToString($0));
@@ -168,24 +239,120 @@ public:
         if (!initialized) return false;
         
         try {
-            // Create FEN string from the board
-            std::string fen = createFENFromBoard(js_board, white_to_move, 
+            // Create FEN string from the board. The '[...]' ability suffixes
+            // are parsed natively by Position::set(), so one pass sets up the
+            // whole position, abilities included.
+            std::string fen = createFENFromBoard(js_board, white_to_move,
                                                white_king_castled, black_king_castled,
                                                en_passant_col, en_passant_row);
-            
+
             // Create new state and set position
             states = StateListPtr(new std::deque<StateInfo>(1));
-            pos.set(fen, false, &states->back(), nullptr);
-            
-            // Apply absorbed abilities after setting position
-            applyAbilitiesFromBoard(js_board);
-            
+            moveHistory.clear();
+            pos.set(fen, false, &states->back(), mainThread);
+
             return true;
         } catch (...) {
             return false;
         }
     }
-    
+
+    // Zero-copy variant of setBoardState(): reads the 64-word frontend board
+    // (row-major, row 0 = rank 8, same bit layout as frontendPieceToStockfish)
+    // straight from linear memory in a single pass, instead of 64 embind
+    // property lookups plus a second traversal for the abilities. The caller
+    // allocates 256 bytes with Module._malloc, fills a Uint32Array view of
+    // the heap and passes the pointer.
+    bool setBoardStateBinary(uintptr_t board_ptr, bool white_to_move,
+                             bool white_king_castled, bool black_king_castled,
+                             int en_passant_col, int en_passant_row) {
+        if (!initialized || !board_ptr) return false;
+
+        const uint32_t* words = reinterpret_cast<const uint32_t*>(board_ptr);
+
+        try {
+            // Build the fen locally from the already-read words; this stays
+            // inside linear memory and costs nothing compared to the embind
+            // crossings it replaces
+            std::ostringstream fen;
+            for (int row = 0; row < 8; row++) {
+                int empty_count = 0;
+                for (int col = 0; col < 8; col++) {
+                    uint32_t frontend_piece = words[row * 8 + col];
+                    if (frontend_piece == 0) {
+                        empty_count++;
+                        continue;
+                    }
+                    if (empty_count > 0) {
+                        fen << empty_count;
+                        empty_count = 0;
+                    }
+                    appendFENPiece(fen, frontend_piece);
+                }
+                if (empty_count > 0) fen << empty_count;
+                if (row < 7) fen << "/";
+            }
+
+            fen << (white_to_move ? " w " : " b ");
+
+            std::string castling = "";
+            if (!white_king_castled) castling += "KQ";
+            if (!black_king_castled) castling += "kq";
+            if (castling.empty()) castling = "-";
+            fen << castling << " ";
+
+            if (en_passant_col >= 0 && en_passant_row >= 0) {
+                fen << char('a' + en_passant_col) << char('1' + (7 - en_passant_row));
+            } else {
+                fen << "-";
+            }
+            fen << " 0 1";
+
+            states = StateListPtr(new std::deque<StateInfo>(1));
+            moveHistory.clear();
+            pos.set(fen.str(), false, &states->back(), mainThread);
+
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // Set the position directly from a FEN string in the engine's extended
+    // dialect ('[...]' ability suffixes, see Position::set()); plain FEN works
+    // too. Together with getFEN() this round-trips any absorb position, so a
+    // caller that keeps the position as a FEN never needs the board array.
+    bool setFEN(const std::string& fen) {
+        if (!initialized) return false;
+
+        // Position::set() assumes a structurally sane fen (it indexes the
+        // board by the kings' squares), so unlike the generated-fen paths
+        // this one screens its input: exactly one king per side in the board
+        // field, not counting ability letters inside '[...]' suffixes.
+        int wk = 0, bk = 0;
+        bool inSuffix = false;
+        for (char c : fen) {
+            if (c == ' ') break;
+            if (c == '[') inSuffix = true;
+            else if (c == ']') inSuffix = false;
+            else if (!inSuffix) {
+                wk += c == 'K';
+                bk += c == 'k';
+            }
+        }
+        if (wk != 1 || bk != 1) return false;
+
+        try {
+            states = StateListPtr(new std::deque<StateInfo>(1));
+            moveHistory.clear();
+            pos.set(fen, false, &states->back(), mainThread);
+
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
 private:
     // Helper function to create FEN string from frontend board
     std::string createFENFromBoard(const val& js_board, bool white_to_move,
@@ -209,9 +376,7 @@ private:
                         empty_count = 0;
                     }
                     
-                    // Convert to FEN piece character
-                    char piece_char = frontendPieceToFENChar(frontend_piece);
-                    fen << piece_char;
+                    appendFENPiece(fen, frontend_piece);
                 }
             }
             
@@ -261,142 +426,155 @@ private:
         
         return isWhite ? toupper(piece) : piece;
     }
-    
-    // Apply absorbed abilities after position is set
-    void applyAbilitiesFromBoard(const val& js_board) {
-        for (int row = 0; row < 8; row++) {
-            val js_row = js_board[row];
-            for (int col = 0; col < 8; col++) {
-                uint32_t frontend_piece = js_row[col].as<uint32_t>();
-                
-                if (frontend_piece != 0) {
-                    Abilities abilities = frontendPieceToAbilities(frontend_piece);
-                    Square sq = frontendToSquare(row, col);
-                    
-                    // Set abilities for this piece
-                    pos.set_abilities(sq, abilities);
-                    
-                    // Debug: Log abilities being set
-                    if (abilities != 0) {
-                        std::cout << "[DEBUG] Setting abilities for square " << sq 
-                                  << " (row=" << row << ", col=" << col << ") "
-                                  << "abilities=" << abilities << std::endl;
-                    }
-                }
-            }
+
+    // Write a frontend piece as its FEN character plus the '[...]' ability
+    // suffix Position::set() parses natively. Frontend base-type bits 0-5 use
+    // the same ordering as the ability flags, so the absorbed set is just the
+    // ability mask with the base bit stripped.
+    void appendFENPiece(std::ostringstream& fen, uint32_t frontend_piece) {
+        fen << frontendPieceToFENChar(frontend_piece);
+
+        Abilities absorbed = Abilities(  frontendPieceToAbilities(frontend_piece)
+                                       & ~(frontend_piece & 63));
+        if (absorbed) {
+            static const char AbilityChars[] = "pnbrqk";
+            fen << '[';
+            for (int i = 0; i < 6; i++)
+                if (absorbed & (1 << i))
+                    fen << AbilityChars[i];
+            fen << ']';
         }
     }
-    
-public:
-    
-    // Find best move (matching original API)
-    val findBestMove(int depth, int time_limit_ms) {
-        if (!initialized) {
-            val result = val::object();
-            result.set("from_row", -1);
-            result.set("from_col", -1);
-            result.set("to_row", -1);
-            result.set("to_col", -1);
-            result.set("flags", 0);
-            result.set("evaluation", 0);
-            result.set("time_taken_ms", 0);
-            result.set("depth_reached", 0);
-            return result;
-        }
-        
+
+
+    // Shared search driver behind findBestMove()/findBestMovePacked()/
+    // findBestMoveTimed(): runs the real iterative-deepening search
+    // (aspiration windows, TT, quiescence) synchronously on this thread under
+    // the given limits and reports the result through the out parameters.
+    // Returns false when the engine is not ready, the position is invalid or
+    // the search threw; a legal but moveless position (mate/stalemate) returns
+    // true with best_move == MOVE_NONE.
+    bool runSearch(Search::LimitsType& limits, Move& best_move, Value& best_score,
+                   int& depth_reached, int& time_taken_ms) {
+        best_move = MOVE_NONE;
+        best_score = VALUE_ZERO;
+        depth_reached = 0;
+        time_taken_ms = 0;
+
+        if (!initialized)
+            return false;
+
         auto start_time = std::chrono::high_resolution_clock::now();
-        
+
         try {
             // Debug: Log position and limits
-            std::cout << "[DEBUG] Starting search with position: " << pos.fen() << std::endl;
-            std::cout << "[DEBUG] Search limits: depth=" << depth << ", time_limit_ms=" << time_limit_ms << std::endl;
-            
+            TRACE(std::cout << "[DEBUG] Starting search with position: " << pos.fen() << std::endl);
+            TRACE(std::cout << "[DEBUG] Search limits: depth=" << limits.depth << ", movetime=" << limits.movetime
+                            << ", time=" << limits.time[WHITE] << "/" << limits.time[BLACK] << std::endl);
+
             // Validate position before search
             if (!pos.pos_is_ok()) {
                 std::cout << "[ERROR] Position is invalid, cannot search" << std::endl;
-                val result = val::object();
-                result.set("from_row", -1);
-                result.set("from_col", -1);
-                result.set("to_row", -1);
-                result.set("to_col", -1);
-                result.set("flags", 0);
-                result.set("evaluation", 0);
-                result.set("time_taken_ms", 0);
-                result.set("depth_reached", 0);
-                return result;
+                return false;
             }
-            // Single-threaded fallback: simple evaluation
-            Move best_move = MOVE_NONE;
-            Value best_score = -VALUE_INFINITE;
-            Color us = pos.side_to_move();
-            int considered = 0;
-            
-            // Debug: Check if any pieces have abilities (but limit output)
-            std::cout << "[DEBUG] Checking for pieces with abilities..." << std::endl;
-            int ability_count = 0;
-            for (Square sq = SQ_A1; sq <= SQ_H8 && ability_count < 5; ++sq) {
-                if (pos.piece_on(sq) != NO_PIECE) {
-                    for (PieceType pt = PAWN; pt <= KING; ++pt) {
-                        if (pos.has_ability(sq, pt)) {
-                            std::cout << "[DEBUG] Square " << sq << " has " << pt << " ability" << std::endl;
-                            ability_count++;
-                            if (ability_count >= 5) break;
-                        }
-                    }
-                }
+            // A book hit answers without searching; there is no PV behind
+            // it, so the ponder seed is cleared rather than left stale.
+            // MultiPV analysis wants real lines, not a single book reply,
+            // so the book only answers single-PV searches
+            if (Move bookMove = size_t(Options["MultiPV"]) == 1 ? OpeningBook.probe(pos) : MOVE_NONE;
+                bookMove != MOVE_NONE) {
+                best_move = bookMove;
+                predictedReply = MOVE_NONE;
+                lastSearch = SearchStats();
+                return true;
             }
-            
-            // Simple 1-ply evaluation
-            for (const ExtMove& em : MoveList<LEGAL>(pos)) {
-                StateInfo st;
-                pos.do_move(em.move, st);
-                Value sc = Eval::evaluate(pos);
-                // Flip score if it's the opponent's turn after the move
-                if (pos.side_to_move() != us)
-                    sc = -sc;
-                pos.undo_move(em.move);
-                
-                if (sc > best_score) {
-                    best_score = sc;
-                    best_move = em.move;
-                }
-                ++considered;
+
+            // Count root moves that rely on an absorbed ability; the list is
+            // regenerated inside start_thinking_sync() anyway, so this adds
+            // one movegen pass per search, not per node
+            lastSearch = SearchStats();
+            for (const ExtMove& em : MoveList<LEGAL>(pos))
+                if (pos.absorbed_abilities(from_sq(em.move)))
+                    lastSearch.abilityRootMoves++;
+
+            auto setup_end = std::chrono::high_resolution_clock::now();
+            auto setup_duration = std::chrono::duration_cast<std::chrono::milliseconds>(setup_end - start_time);
+
+            Threads.start_thinking_sync(pos, states, limits);
+
+            if (!mainThread->rootMoves.empty() && mainThread->rootMoves[0].pv[0] != MOVE_NONE) {
+                best_move = mainThread->rootMoves[0].pv[0];
+                best_score = mainThread->rootMoves[0].score;
+                depth_reached = int(mainThread->completedDepth);
+                predictedReply = mainThread->rootMoves[0].pv.size() > 1
+                               ? mainThread->rootMoves[0].pv[1] : MOVE_NONE;
             }
-            
-            std::cout << "[DEBUG] Considered " << considered << " moves, best_score: " << best_score << std::endl;
-            
+
+            TRACE(std::cout << "[DEBUG] Search finished: nodes=" << Threads.nodes_searched()
+                      << " depth=" << depth_reached << " score=" << best_score << std::endl);
+
             auto end_time = std::chrono::high_resolution_clock::now();
             auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-            
-            val result = val::object();
-            
-            if (best_move != MOVE_NONE) {
-                // Convert move to frontend coordinates
-                int from_row, from_col, to_row, to_col;
-                squareToFrontend(from_sq(best_move), from_row, from_col);
-                squareToFrontend(to_sq(best_move), to_row, to_col);
-                
-                result.set("from_row", from_row);
-                result.set("from_col", from_col);
-                result.set("to_row", to_row);
-                result.set("to_col", to_col);
-                result.set("flags", type_of(best_move));
-                result.set("evaluation", int(best_score));
-                result.set("time_taken_ms", int(duration.count()));
-                result.set("depth_reached", 1);
-            } else {
-                result.set("from_row", -1);
-                result.set("from_col", -1);
-                result.set("to_row", -1);
-                result.set("to_col", -1);
-                result.set("flags", 0);
-                result.set("evaluation", 0);
-                result.set("time_taken_ms", int(duration.count()));
-                result.set("depth_reached", 0);
-            }
-            
+            time_taken_ms = int(duration.count());
+
+            // Fill the stats surface for getSearchStats(). ttHitAverage is a
+            // running average scaled by TtHitAverageWindow *
+            // TtHitAverageResolution (4096 * 1024, see search.cpp)
+            lastSearch.nodes = Threads.nodes_searched();
+            lastSearch.evalCalls = Threads.eval_calls();
+            lastSearch.ttHitPermille = int(1000 * mainThread->ttHitAverage / (4096ULL * 1024));
+            lastSearch.evalCacheHitPermille = lastSearch.evalCalls
+                ? int(1000 * Threads.eval_cache_hits() / lastSearch.evalCalls) : 0;
+            lastSearch.searchTimeMs = int(duration.count() - setup_duration.count());
+            lastSearch.totalTimeMs = int(duration.count());
+            lastSearch.depthReached = depth_reached;
+            lastSearch.hashfull = TT.hashfull();
+
+            return true;
+
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // Depth/movetime convenience overload used by the original API
+    bool runSearch(int depth, int time_limit_ms, Move& best_move, Value& best_score,
+                   int& depth_reached, int& time_taken_ms) {
+
+        Search::LimitsType limits;
+        if (depth > 0)
+            limits.depth = std::min(depth, MAX_PLY - 1);
+        if (time_limit_ms > 0)
+            limits.movetime = time_limit_ms;
+        if (!limits.depth && !limits.movetime)
+            limits.depth = 1; // Never search unbounded
+
+        return runSearch(limits, best_move, best_score, depth_reached, time_taken_ms);
+    }
+
+    // Result object shared by findBestMove() and findBestMoveTimed()
+    val bestMoveResult(bool ok, Move best_move, Value best_score,
+                       int depth_reached, int time_taken_ms) {
+
+        val result = val::object();
+
+        if (ok && best_move != MOVE_NONE) {
+            // Convert move to frontend coordinates
+            int from_row, from_col, to_row, to_col;
+            squareToFrontend(from_sq(best_move), from_row, from_col);
+            squareToFrontend(to_sq(best_move), to_row, to_col);
+
+            result.set("from_row", from_row);
+            result.set("from_col", from_col);
+            result.set("to_row", to_row);
+            result.set("to_col", to_col);
+            result.set("flags", type_of(best_move));
+            result.set("evaluation", int(best_score));
+            result.set("time_taken_ms", time_taken_ms);
+            result.set("depth_reached", depth_reached);
+
             // Handle promotion
-            if (best_move != MOVE_NONE && type_of(best_move) == PROMOTION) {
+            if (type_of(best_move) == PROMOTION) {
                 PieceType promotion_piece = promotion_type(best_move);
                 std::string promotion_str;
                 switch (promotion_piece) {
@@ -408,26 +586,173 @@ public:
                 }
                 result.set("promotion_piece", promotion_str);
             }
-            
-            return result;
-            
-        } catch (...) {
-            val result = val::object();
+        } else {
             result.set("from_row", -1);
             result.set("from_col", -1);
             result.set("to_row", -1);
             result.set("to_col", -1);
             result.set("flags", 0);
             result.set("evaluation", 0);
-            result.set("time_taken_ms", 0);
+            result.set("time_taken_ms", time_taken_ms);
             result.set("depth_reached", 0);
+        }
+
+        return result;
+    }
+
+public:
+
+    // Find best move (matching original API)
+    val findBestMove(int depth, int time_limit_ms) {
+        Move best_move;
+        Value best_score;
+        int depth_reached, time_taken_ms;
+        bool ok = runSearch(depth, time_limit_ms, best_move, best_score, depth_reached, time_taken_ms);
+        return bestMoveResult(ok, best_move, best_score, depth_reached, time_taken_ms);
+    }
+
+    // Clock-aware variant of findBestMove(): hands the real game clocks to
+    // TimeManagement instead of a hard depth/movetime cap, so the engine
+    // budgets each move itself, including the Move Overhead reserve for the
+    // WebSocket round trip (see setMoveOverhead()). max_depth > 0 still
+    // bounds the iteration as a safety net; pass 0 to let the clock decide.
+    val findBestMoveTimed(int wtime_ms, int btime_ms, int winc_ms, int binc_ms,
+                          int max_depth) {
+        Move best_move;
+        Value best_score;
+        int depth_reached, time_taken_ms;
+
+        Search::LimitsType limits;
+        limits.time[WHITE] = std::max(wtime_ms, 0);
+        limits.time[BLACK] = std::max(btime_ms, 0);
+        limits.inc[WHITE]  = std::max(winc_ms, 0);
+        limits.inc[BLACK]  = std::max(binc_ms, 0);
+        if (max_depth > 0)
+            limits.depth = std::min(max_depth, MAX_PLY - 1);
+
+        // Without a clock for the side to move, time management never
+        // engages and the search would run unbounded
+        if (!limits.time[pos.side_to_move()] && !limits.depth)
+            limits.depth = 1;
+
+        bool ok = runSearch(limits, best_move, best_score, depth_reached, time_taken_ms);
+        return bestMoveResult(ok, best_move, best_score, depth_reached, time_taken_ms);
+    }
+
+    // MultiPV analysis for the analysis board: one search shares the tree
+    // and the TT across all requested lines instead of the five exclusion
+    // searches the UI used to run from JavaScript. Returns an object with
+    // "lines", an array ordered best-first of { move, moves, evaluation,
+    // seldepth }, plus the shared depth_reached/time_taken_ms. evaluation
+    // is from the side to move, in the same internal units findBestMove()
+    // reports. num_lines is clamped to the legal move count.
+    val analyze(int depth, int num_lines) {
+
+        val result = val::object();
+        result.set("ok", false);
+
+        if (!initialized)
+            return result;
+
+        int requested = std::max(1, std::min(num_lines, 500));
+        int prevMultiPV = int(Options["MultiPV"]);
+        Options["MultiPV"] = std::to_string(requested);
+
+        Move best_move;
+        Value best_score;
+        int depth_reached, time_taken_ms;
+        bool ok = runSearch(depth > 0 ? depth : 1, 0, best_move, best_score,
+                            depth_reached, time_taken_ms);
+
+        Options["MultiPV"] = std::to_string(prevMultiPV);
+
+        if (!ok)
             return result;
+
+        val lines = val::array();
+        size_t count = std::min(size_t(requested), mainThread->rootMoves.size());
+
+        for (size_t i = 0; i < count; ++i) {
+            const Search::RootMove& rm = mainThread->rootMoves[i];
+            if (rm.pv.empty() || rm.pv[0] == MOVE_NONE)
+                break;
+
+            std::string pvStr;
+            for (Move m : rm.pv) {
+                if (!pvStr.empty())
+                    pvStr += ' ';
+                pvStr += UCI::move(m, pos.is_chess960());
+            }
+
+            val line = val::object();
+            line.set("move", UCI::move(rm.pv[0], pos.is_chess960()));
+            line.set("moves", pvStr);
+            line.set("evaluation", int(rm.score));
+            line.set("seldepth", rm.selDepth);
+            lines.set(i, line);
         }
+
+        result.set("ok", true);
+        result.set("lines", lines);
+        result.set("depth_reached", depth_reached);
+        result.set("time_taken_ms", time_taken_ms);
+        return result;
     }
-        
-    
-    
-    // Get current position as FEN
+
+    // Per-move latency reserve in milliseconds, deducted from the clock by
+    // time management on every move. Mirrors the UCI "Move Overhead" option;
+    // the server sets it to its measured WebSocket round trip.
+    void setMoveOverhead(int ms) {
+        Options["Move Overhead"] = std::to_string(std::max(0, std::min(ms, 5000)));
+    }
+
+    // --- Transposition table control ------------------------------------
+    // The constructor sizes the TT at a conservative 16 MB so the module
+    // loads everywhere; the host knows what it is running on
+    // (navigator.deviceMemory and friends) and should resize once at
+    // startup, e.g. keep 16 MB on phones and go to 128-256 MB on desktops.
+    // Resizing reallocates and zeroes the table, losing its contents, so do
+    // it between games rather than between moves.
+    bool setHashSize(int mb) {
+        if (!initialized) return false;
+        if (async.active && !async.finished) return false; // table is live
+
+#ifdef ABSORB_FIXED_HEAP_MB
+        // The fixed-heap build sized the linear memory for this much hash at
+        // link time (see build_wasm.sh --fixed-heap); anything larger would
+        // need the memory growth that build deliberately traded away.
+        mb = std::min(mb, int(ABSORB_FIXED_HEAP_MB));
+#endif
+
+        try {
+            Options["Hash"] = std::to_string(std::max(1, std::min(mb, 1024)));
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // Zero the next 'mb' megabytes of the TT and report whether the whole
+    // table is clear now. A ucinewgame-style clear of a desktop-sized table
+    // is one long memset that stalls the single WASM thread; calling this
+    // from requestIdleCallback() until it returns true spreads the cost
+    // over idle slices instead. Returns false too while a cooperative
+    // search is running (the table is in use; call again once it resolved).
+    bool clearHashChunk(int mb) {
+        if (!initialized || (async.active && !async.finished)) return false;
+        return TT.clear_chunk(size_t(std::max(1, std::min(mb, 64))));
+    }
+
+    // TT occupancy of the current search generation, per-mille (the UCI
+    // hashfull number); also reported per search in getSearchStats().
+    // Telemetry correlating this with strength tells us when a client's
+    // table is saturated and a bigger setHashSize() would pay.
+    int getHashfull() const {
+        return initialized ? TT.hashfull() : 0;
+    }
+
+    // Get current position as FEN, with absorbed abilities emitted as
+    // '[...]' suffixes so the string feeds straight back into setFEN()
     std::string getFEN() const {
         return pos.fen();
     }
@@ -438,11 +763,176 @@ public:
             if (UCI::move(move.move, pos.is_chess960()) == moveStr) {
                 states->emplace_back();
                 pos.do_move(move.move, states->back());
+                moveHistory.push_back(move.move);
                 return true;
             }
         }
         return false;
     }
+
+    // --- Incremental session API ---------------------------------------
+    // setBoardState() tears down 'states' and rebuilds the position from a
+    // fen, so every bot move used to start from a cold search: the
+    // transposition table is keyed by position hash and survives just fine,
+    // but the frontend had no way to confirm the engine was still in sync
+    // and so rebuilt defensively each turn. pushMove()/popMove() keep the
+    // internal position in lockstep with the game incrementally, and
+    // getPositionChecksum() lets the frontend detect drift (and only then
+    // fall back to a full setBoardState).
+
+    // Play a move in UCI format on top of the current position
+    bool pushMove(const std::string& moveStr) {
+        if (!initialized) return false;
+
+        try {
+            return makeMove(moveStr);
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // Coordinate variant for callers that work in frontend rows/cols; same
+    // conversion as applyMove()
+    bool pushMoveCoords(int from_row, int from_col, int to_row, int to_col) {
+        return applyMove(from_row, from_col, to_row, to_col, 0);
+    }
+
+    // Apply a whole move history in one call. On reconnect or spectator
+    // join the frontend used to replay N moves with N pushMove() crossings,
+    // each scanning a fresh MoveList and comparing UCI strings; here the
+    // caller packs the history into an int32 array in linear memory
+    // (_malloc + Int32Array fill, the setBoardStateBinary() pattern) using
+    // the same move word layout as getLegalMovesPacked(), and each entry is
+    // matched against a single legality pass per position by direct word
+    // comparison. The moves append to the existing 'states' deque like
+    // pushMove(), so popMove() walks back through them as usual.
+    //
+    // Returns the number of moves applied. Anything short of 'count' means
+    // the entry at that index matched no legal move and replay stopped
+    // there; the applied prefix stays on the board and the caller can
+    // compare getPositionChecksum() before falling back to setBoardState().
+    int pushMoves(uintptr_t moves_ptr, int count) {
+        if (!initialized || !moves_ptr || count < 0) return 0;
+
+        const int32_t* words = reinterpret_cast<const int32_t*>(moves_ptr);
+        int applied = 0;
+
+        try {
+            for (; applied < count; ++applied) {
+                Move matched = MOVE_NONE;
+
+                for (const ExtMove& move : MoveList<LEGAL>(pos))
+                    if (packMoveWord(move.move) == words[applied]) {
+                        matched = move.move;
+                        break;
+                    }
+
+                if (matched == MOVE_NONE)
+                    break;
+
+                states->emplace_back();
+                pos.do_move(matched, states->back());
+                moveHistory.push_back(matched);
+            }
+        } catch (...) {
+            // Keep the prefix applied so far; the count tells the caller
+        }
+
+        return applied;
+    }
+
+    // Take back the last pushed move (e.g. after an undo in the UI). Returns
+    // false once the session root is reached; the root itself can only be
+    // replaced via setBoardState().
+    bool popMove() {
+        if (!initialized || moveHistory.empty()) return false;
+
+        try {
+            pos.undo_move(moveHistory.back());
+            moveHistory.pop_back();
+            states->pop_back();
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // Ability-aware position hash as a hex string (JS numbers cannot hold
+    // 64 bits losslessly). Equal checksums mean frontend and engine agree
+    // on the position including every absorbed ability.
+    std::string getPositionChecksum() const {
+        if (!initialized) return "";
+
+        std::ostringstream oss;
+        oss << std::hex << pos.key();
+        return oss.str();
+    }
+
+    // --- Opening book ---------------------------------------------------
+    // The host fetches the book file as an ArrayBuffer, copies it into the
+    // module heap (_malloc + HEAPU8.set, the setBoardStateBinary() pattern)
+    // and hands over pointer and length. From then on findBestMove() and
+    // startSearch() answer book positions without searching.
+
+    bool loadBook(uintptr_t data_ptr, int length) {
+        if (!initialized || length <= 0) return false;
+        return OpeningBook.load_buffer(reinterpret_cast<const void*>(data_ptr),
+                                       size_t(length));
+    }
+
+    void clearBook() { OpeningBook.clear(); }
+
+    // Number of loaded book entries, for the frontend to sanity-check a fetch
+    int getBookSize() const { return int(OpeningBook.size()); }
+
+    // --- Warm-start snapshot --------------------------------------------
+    // The compacted TT plus history tables as one blob (Search::save_state()),
+    // so a fresh page load can pick up the search effort of the previous
+    // session instead of starting stone cold. The host persists the bytes in
+    // IndexedDB and feeds them back after init (see engine-worker.js).
+
+    // Returns a Uint8Array view over a member buffer - valid only until the
+    // next saveSnapshot() call, so the host copies it right away - or null
+    // when there is nothing to save.
+    val saveSnapshot(int minDepth) {
+        if (!initialized) return val::null();
+        std::ostringstream os;
+        if (!Search::save_state(os, Depth(minDepth)))
+            return val::null();
+        snapshotBuffer = os.str();
+        return val(typed_memory_view(snapshotBuffer.size(),
+                   reinterpret_cast<const uint8_t*>(snapshotBuffer.data())));
+    }
+
+    // Takes the bytes of a previous saveSnapshot(); embind copies a JS
+    // Uint8Array into the std::string parameter byte-for-byte. A snapshot
+    // saved under a different hash size restores the histories only (see
+    // TranspositionTable::load_compact()).
+    bool loadSnapshot(const std::string& blob) {
+        if (!initialized) return false;
+        std::istringstream is(blob);
+        return Search::load_state(is);
+    }
+
+    // Stats gathered during the last findBestMove(); replaces the per-search
+    // console logging that is now compiled out without ABSORB_TRACE
+    val getSearchStats() const {
+        val stats = val::object();
+        stats.set("nodes", double(lastSearch.nodes));
+        stats.set("eval_calls", double(lastSearch.evalCalls));
+        stats.set("tt_hit_permille", lastSearch.ttHitPermille);
+        stats.set("eval_cache_hit_permille", lastSearch.evalCacheHitPermille);
+        stats.set("ability_root_moves", lastSearch.abilityRootMoves);
+        stats.set("search_time_ms", lastSearch.searchTimeMs);
+        stats.set("total_time_ms", lastSearch.totalTimeMs);
+        stats.set("depth_reached", lastSearch.depthReached);
+        stats.set("hashfull", lastSearch.hashfull);
+        stats.set("arena_used", double(Arena::used()));
+        stats.set("arena_overflows", double(Arena::overflows()));
+        stats.set("nps", lastSearch.searchTimeMs > 0
+                         ? double(1000 * lastSearch.nodes / uint64_t(lastSearch.searchTimeMs)) : 0.0);
+        return stats;
+    }
     
     // Get the best move using search (WASM-safe single-threaded version)
     std::string getBestMove(int depth = 5) {
@@ -566,18 +1056,18 @@ public:
         
         try {
             // Debug: Print MoveType enum values
-            std::cout << "[DEBUG] MoveType enum values - NORMAL: " << static_cast<int>(NORMAL) 
-                      << ", PROMOTION: " << static_cast<int>(PROMOTION) 
-                      << ", ENPASSANT: " << static_cast<int>(ENPASSANT) 
-                      << ", CASTLING: " << static_cast<int>(CASTLING) << std::endl;
-            
+            TRACE(std::cout << "[DEBUG] MoveType enum values - NORMAL: " << static_cast<int>(NORMAL)
+                      << ", PROMOTION: " << static_cast<int>(PROMOTION)
+                      << ", ENPASSANT: " << static_cast<int>(ENPASSANT)
+                      << ", CASTLING: " << static_cast<int>(CASTLING) << std::endl);
+
             val js_moves = val::array();
             int index = 0;
 
             // Additional defensive logging: print FEN and basic position info before move generation
-            std::cout << "[DEBUG] getLegalMoves() starting. FEN=" << pos.fen()
+            TRACE(std::cout << "[DEBUG] getLegalMoves() starting. FEN=" << pos.fen()
                       << " sideToMove=" << (pos.side_to_move() == WHITE ? "WHITE" : "BLACK")
-                      << " checkers=" << (pos.checkers() ? 1 : 0) << std::endl;
+                      << " checkers=" << (pos.checkers() ? 1 : 0) << std::endl);
 
             try {
                 for (const ExtMove& move : MoveList<LEGAL>(pos)) {
@@ -594,8 +1084,8 @@ public:
 
                         // Validate squares
                         if (!is_ok(from_sq(m)) || !is_ok(to_sq(m))) {
-                            std::cout << "[WARN] getLegalMoves() encountered invalid move squares: raw_move=" << m
-                                      << " from=" << static_cast<int>(from_sq(m)) << " to=" << static_cast<int>(to_sq(m)) << std::endl;
+                            TRACE(std::cout << "[WARN] getLegalMoves() encountered invalid move squares: raw_move=" << m
+                                      << " from=" << static_cast<int>(from_sq(m)) << " to=" << static_cast<int>(to_sq(m)) << std::endl);
                         }
 
                         js_move.set("from_row", from_row);
@@ -608,9 +1098,9 @@ public:
 
                         // Debug: Log castling moves specifically
                         if (from_row == 7 && from_col == 4 && (to_col == 2 || to_col == 6)) {
-                            std::cout << "[DEBUG] Potential castling move: [" << from_row << "," << from_col
+                            TRACE(std::cout << "[DEBUG] Potential castling move: [" << from_row << "," << from_col
                                       << "] -> [" << to_row << "," << to_col << "] flags: " << move_flags
-                                      << " raw_move: " << m << std::endl;
+                                      << " raw_move: " << m << std::endl);
                         }
 
                         js_moves.set(index++, js_move);
@@ -641,6 +1131,308 @@ public:
         }
     }
     
+    // --- Packed binary return path --------------------------------------
+    // getLegalMovesPacked()/findBestMovePacked() write into preallocated
+    // int32 buffers in linear memory and return an Int32Array view over
+    // them: one embind crossing per query instead of a val::object() and
+    // five set() calls per move. The views alias the module's heap, so they
+    // are only valid until the next call on this engine (or heap growth);
+    // callers that keep the data must copy it out.
+    //
+    // Move word layout (low to high bits):
+    //   0-2   from_row     3-5   from_col
+    //   6-8   to_row       9-11  to_col
+    //   12-13 move type (0 normal, 1 promotion, 2 en passant, 3 castling)
+    //   14-16 promotion piece type (2 knight .. 5 queen, 0 if none)
+
+private:
+    int32_t packMoveWord(Move m) {
+        int from_row, from_col, to_row, to_col;
+        squareToFrontend(from_sq(m), from_row, from_col);
+        squareToFrontend(to_sq(m), to_row, to_col);
+
+        int mtype = int(type_of(m)) >> 14; // MoveType lives in bits 14-15
+        int promo = type_of(m) == PROMOTION ? int(promotion_type(m)) : 0;
+
+        return from_row | (from_col << 3)
+             | (to_row << 6) | (to_col << 9)
+             | (mtype << 12) | (promo << 14);
+    }
+
+public:
+    val getLegalMovesPacked() {
+        int count = 0;
+
+        if (initialized) {
+            try {
+                for (const ExtMove& move : MoveList<LEGAL>(pos))
+                    legalMovesBuffer[count++] = packMoveWord(move.move);
+            } catch (const std::exception& e) {
+                std::cout << "[FATAL] getLegalMovesPacked() aborted due to exception: " << e.what() << std::endl;
+                count = 0;
+            } catch (...) {
+                std::cout << "[FATAL] getLegalMovesPacked() aborted due to unknown exception." << std::endl;
+                count = 0;
+            }
+        }
+
+        return val(typed_memory_view(size_t(count), legalMovesBuffer));
+    }
+
+    // Result buffer layout: [0-3] from_row/from_col/to_row/to_col (-1 row on
+    // failure or no move), [4] move type, [5] promotion piece type,
+    // [6] evaluation, [7] time_taken_ms, [8] depth_reached
+    val findBestMovePacked(int depth, int time_limit_ms) {
+        Move best_move;
+        Value best_score;
+        int depth_reached, time_taken_ms;
+        bool ok = runSearch(depth, time_limit_ms, best_move, best_score, depth_reached, time_taken_ms);
+
+        if (ok && best_move != MOVE_NONE) {
+            int from_row, from_col, to_row, to_col;
+            squareToFrontend(from_sq(best_move), from_row, from_col);
+            squareToFrontend(to_sq(best_move), to_row, to_col);
+
+            bestMoveBuffer[0] = from_row;
+            bestMoveBuffer[1] = from_col;
+            bestMoveBuffer[2] = to_row;
+            bestMoveBuffer[3] = to_col;
+            bestMoveBuffer[4] = int(type_of(best_move)) >> 14;
+            bestMoveBuffer[5] = type_of(best_move) == PROMOTION ? int(promotion_type(best_move)) : 0;
+            bestMoveBuffer[6] = int(best_score);
+            bestMoveBuffer[7] = time_taken_ms;
+            bestMoveBuffer[8] = depth_reached;
+        } else {
+            bestMoveBuffer[0] = bestMoveBuffer[1] = bestMoveBuffer[2] = bestMoveBuffer[3] = -1;
+            bestMoveBuffer[4] = bestMoveBuffer[5] = bestMoveBuffer[6] = 0;
+            bestMoveBuffer[7] = time_taken_ms;
+            bestMoveBuffer[8] = 0;
+        }
+
+        return val(typed_memory_view(size_t(9), bestMoveBuffer));
+    }
+
+    // --- Interruptible search -------------------------------------------
+    // The pool in this build always runs the search on the caller's stack
+    // (see ThreadPool::start_thinking_sync), so a detached background search
+    // is not available; instead the search is driven cooperatively.
+    // startSearch() arms the limits, each stepSearch() completes one more
+    // depth (bounded by the remaining time budget) and says whether work
+    // remains, and pollSearch() returns the deepest completed result at any
+    // point. The worker hosting the module calls stepSearch() from its
+    // message loop, so stop requests and progress posts interleave between
+    // iterations: whenever the clock demands a move, the best-so-far result
+    // is already in hand. Re-walking depths 1..N each step is cheap because
+    // the transposition table persists across the calls.
+
+    bool startSearch(int depth, int time_limit_ms) {
+        if (!initialized || !pos.pos_is_ok())
+            return false;
+
+        async = AsyncSearch();
+        async.active = true;
+
+        // Same book short-circuit as the synchronous path: the first
+        // stepSearch() returns false and pollSearch() carries the book move
+        if (Move bookMove = OpeningBook.probe(pos); bookMove != MOVE_NONE) {
+            async.bestMove = bookMove;
+            async.finished = true;
+            predictedReply = MOVE_NONE;
+            return true;
+        }
+
+        async.targetDepth = depth > 0 ? std::min(depth, MAX_PLY - 1) : MAX_PLY - 1;
+        async.budgetMs = time_limit_ms > 0 ? time_limit_ms : 0;
+        if (depth <= 0 && time_limit_ms <= 0)
+            async.targetDepth = 1; // Never search unbounded
+        return true;
+    }
+
+    // Runs one more iteration; returns true while the search has work left
+    bool stepSearch() {
+        if (!initialized || !async.active || async.finished)
+            return false;
+
+        Search::LimitsType limits;
+        limits.depth = async.nextDepth;
+        if (async.budgetMs > 0) {
+            int remaining = async.budgetMs - async.elapsedMs;
+            if (remaining <= 0) {
+                async.finished = true;
+                return false;
+            }
+            limits.movetime = remaining;
+        }
+
+        auto step_start = std::chrono::high_resolution_clock::now();
+        try {
+            Threads.start_thinking_sync(pos, states, limits);
+        } catch (...) {
+            async.finished = true;
+            return false;
+        }
+        auto step_end = std::chrono::high_resolution_clock::now();
+        async.elapsedMs += int(std::chrono::duration_cast<std::chrono::milliseconds>(step_end - step_start).count());
+
+        if (mainThread->rootMoves.empty()) {
+            async.finished = true; // mate or stalemate, nothing to play
+            return false;
+        }
+
+        // A movetime abort can leave completedDepth below the request; keep
+        // the deepest fully completed result either way
+        if (   mainThread->rootMoves[0].pv[0] != MOVE_NONE
+            && int(mainThread->completedDepth) >= async.bestDepth) {
+            async.bestMove = mainThread->rootMoves[0].pv[0];
+            async.bestScore = mainThread->rootMoves[0].score;
+            async.bestDepth = int(mainThread->completedDepth);
+            predictedReply = mainThread->rootMoves[0].pv.size() > 1
+                           ? mainThread->rootMoves[0].pv[1] : MOVE_NONE;
+        }
+
+        async.nextDepth = std::max(async.nextDepth + 1, int(mainThread->completedDepth) + 1);
+        if (async.nextDepth > async.targetDepth)
+            async.finished = true;
+        if (async.budgetMs > 0 && async.elapsedMs >= async.budgetMs)
+            async.finished = true;
+
+        return !async.finished;
+    }
+
+    // Best-so-far snapshot; same field names as findBestMove() plus the
+    // running/finished flags so a worker can forward it as a progress event
+    val pollSearch() {
+        val result = val::object();
+        result.set("active", async.active);
+        result.set("finished", async.finished);
+        result.set("pondering", async.ponder);
+        result.set("time_taken_ms", async.elapsedMs);
+
+        if (async.bestMove != MOVE_NONE) {
+            int from_row, from_col, to_row, to_col;
+            squareToFrontend(from_sq(async.bestMove), from_row, from_col);
+            squareToFrontend(to_sq(async.bestMove), to_row, to_col);
+            result.set("from_row", from_row);
+            result.set("from_col", from_col);
+            result.set("to_row", to_row);
+            result.set("to_col", to_col);
+            result.set("flags", type_of(async.bestMove));
+            result.set("evaluation", int(async.bestScore));
+            result.set("depth_reached", async.bestDepth);
+
+            if (type_of(async.bestMove) == PROMOTION) {
+                std::string promotion_str;
+                switch (promotion_type(async.bestMove)) {
+                    case QUEEN: promotion_str = "Q"; break;
+                    case ROOK: promotion_str = "R"; break;
+                    case BISHOP: promotion_str = "B"; break;
+                    case KNIGHT: promotion_str = "N"; break;
+                    default: promotion_str = "Q"; break;
+                }
+                result.set("promotion_piece", promotion_str);
+            }
+        } else {
+            result.set("from_row", -1);
+            result.set("from_col", -1);
+            result.set("to_row", -1);
+            result.set("to_col", -1);
+            result.set("flags", 0);
+            result.set("evaluation", 0);
+            result.set("depth_reached", 0);
+        }
+
+        return result;
+    }
+
+    void stopSearch() {
+        async.finished = true;
+        Threads.stop = true;
+    }
+
+    // --- Pondering ------------------------------------------------------
+    // Between our moves the engine used to sit idle while the opponent
+    // thought. startPonder() plays the reply predicted by the last search
+    // (the second PV move) onto the board speculatively and arms the same
+    // cooperative loop as startSearch(); the host keeps calling stepSearch()
+    // during the opponent's turn. When the opponent moves, ponderHit()
+    // promotes the speculative search into the real one (position and
+    // accumulated depth are already correct, the remaining budget just gets
+    // re-armed), while ponderMiss() unwinds the speculative move and leaves
+    // the warmed transposition table to speed up the fresh search. On a hit
+    // the move effectively searched for the whole opponent think time.
+    // makeMove()/pushMove()/setBoardState() must not be called while a
+    // ponder search is unresolved.
+
+    // UCI string of the reply the next startPonder() would assume, "" when
+    // the last PV ended after our move
+    std::string getPonderMove() const {
+        if (!initialized || predictedReply == MOVE_NONE) return "";
+        return UCI::move(predictedReply, pos.is_chess960());
+    }
+
+    // Start a speculative search assuming the predicted reply gets played.
+    // depth/time_limit_ms bound it like startSearch(); both <= 0 means
+    // "until resolved", the normal case since the opponent sets the clock.
+    bool startPonder(int depth, int time_limit_ms) {
+        if (!initialized || !pos.pos_is_ok() || predictedReply == MOVE_NONE)
+            return false;
+        if (async.active && !async.finished)
+            return false; // resolve the running search first
+
+        // The prediction came from a PV one ply back; re-validate it against
+        // the position actually on the board now
+        bool legal = false;
+        for (const ExtMove& em : MoveList<LEGAL>(pos))
+            if (em.move == predictedReply) {
+                legal = true;
+                break;
+            }
+        if (!legal)
+            return false;
+
+        states->emplace_back();
+        pos.do_move(predictedReply, states->back());
+
+        async = AsyncSearch();
+        async.active = true;
+        async.ponder = true;
+        async.ponderMove = predictedReply;
+        async.targetDepth = depth > 0 ? std::min(depth, MAX_PLY - 1) : MAX_PLY - 1;
+        async.budgetMs = time_limit_ms > 0 ? time_limit_ms : 0;
+        return true;
+    }
+
+    // The opponent played the predicted reply: the speculative move becomes
+    // part of the game and the search continues as the real one under the
+    // given bounds. Progress so far (depth, best move, clock) is kept.
+    bool ponderHit(int depth, int time_limit_ms) {
+        if (!initialized || !async.ponder)
+            return false;
+
+        moveHistory.push_back(async.ponderMove);
+        async.ponder = false;
+        async.ponderMove = MOVE_NONE;
+        async.finished = false; // a budget-stopped ponder search resumes here
+        async.targetDepth = depth > 0 ? std::min(depth, MAX_PLY - 1) : MAX_PLY - 1;
+        async.budgetMs = time_limit_ms > 0 ? time_limit_ms : 0;
+        async.elapsedMs = 0; // the opponent paid for the time spent so far
+        if (async.nextDepth > async.targetDepth || (depth <= 0 && time_limit_ms <= 0))
+            async.finished = true; // already deeper than asked, play it
+        return true;
+    }
+
+    // The opponent played something else: unwind the speculative move and
+    // forget the search. The transposition table keeps whatever overlaps.
+    bool ponderMiss() {
+        if (!initialized || !async.ponder)
+            return false;
+
+        pos.undo_move(async.ponderMove);
+        states->pop_back();
+        async = AsyncSearch();
+        return true;
+    }
+
     int getEvaluation() {
         if (!initialized) return 0;
         return evaluate();
@@ -681,6 +1473,44 @@ public:
         }
     }
     
+    // Set the number of search threads (Lazy SMP). Only the pthread-enabled
+    // build (build_wasm.sh --threads) can spawn workers; the single-threaded
+    // build keeps its synchronous main thread and reports 1. The main thread
+    // always drives the search from the caller's stack and wakes the helper
+    // threads itself, all sharing one transposition table, so this works with
+    // the existing synchronous findBestMove() API.
+    int setThreadCount(int requested) {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        if (!initialized)
+            return 1;
+
+        int n = std::max(1, std::min(requested, 8));
+
+        // ThreadPool::set() keeps the worker-less main thread (see note (C)
+        // in the Thread constructor) and only adds/removes helpers.
+        Threads.set(n);
+        return n;
+#else
+        (void)requested;
+        return 1;
+#endif
+    }
+
+    // True once every helper thread reached idle_loop(). Like uci_command()
+    // the caller must retry with backoff before searching (see note (B) in
+    // the Thread constructor): signalling a thread that has not parked yet
+    // would lose the wakeup.
+    bool threadsReady() const {
+        for (Thread* th : Threads)
+            if (!th->threadStarted)
+                return false;
+        return true;
+    }
+
+    int getThreadCount() const {
+        return int(Threads.size());
+    }
+
     // Get board state as JSON-like string for debugging
     std::string getBoardState() const {
         std::ostringstream oss;
@@ -708,13 +1538,45 @@ EMSCRIPTEN_BINDINGS(chess_engine) {
         .constructor<>()
         .function("setBoardState", static_cast<bool(WasmChessEngine::*)(const val&, bool)>(&WasmChessEngine::setBoardState))
         .function("setBoardStateFull", static_cast<bool(WasmChessEngine::*)(const val&, bool, bool, bool, int, int)>(&WasmChessEngine::setBoardState))
+        .function("setFEN", &WasmChessEngine::setFEN)
+        .function("setHashSize", &WasmChessEngine::setHashSize)
+        .function("clearHashChunk", &WasmChessEngine::clearHashChunk)
+        .function("getHashfull", &WasmChessEngine::getHashfull)
+        .function("setBoardStateBinary", &WasmChessEngine::setBoardStateBinary)
         .function("findBestMove", &WasmChessEngine::findBestMove)
+        .function("findBestMovePacked", &WasmChessEngine::findBestMovePacked)
+        .function("findBestMoveTimed", &WasmChessEngine::findBestMoveTimed)
+        .function("analyze", &WasmChessEngine::analyze)
+        .function("setMoveOverhead", &WasmChessEngine::setMoveOverhead)
+        .function("startSearch", &WasmChessEngine::startSearch)
+        .function("stepSearch", &WasmChessEngine::stepSearch)
+        .function("pollSearch", &WasmChessEngine::pollSearch)
+        .function("stopSearch", &WasmChessEngine::stopSearch)
+        .function("getPonderMove", &WasmChessEngine::getPonderMove)
+        .function("startPonder", &WasmChessEngine::startPonder)
+        .function("ponderHit", &WasmChessEngine::ponderHit)
+        .function("ponderMiss", &WasmChessEngine::ponderMiss)
         .function("getLegalMoves", &WasmChessEngine::getLegalMoves)
+        .function("getLegalMovesPacked", &WasmChessEngine::getLegalMovesPacked)
         .function("getEvaluation", &WasmChessEngine::getEvaluation)
         .function("isInCheck", &WasmChessEngine::isInCheck)
         .function("isCheckmate", &WasmChessEngine::isCheckmate)
         .function("isStalemate", &WasmChessEngine::isStalemate)
         .function("applyMove", &WasmChessEngine::applyMove)
+        .function("pushMove", &WasmChessEngine::pushMove)
+        .function("pushMoveCoords", &WasmChessEngine::pushMoveCoords)
+        .function("pushMoves", &WasmChessEngine::pushMoves)
+        .function("popMove", &WasmChessEngine::popMove)
+        .function("getPositionChecksum", &WasmChessEngine::getPositionChecksum)
+        .function("getSearchStats", &WasmChessEngine::getSearchStats)
+        .function("loadBook", &WasmChessEngine::loadBook)
+        .function("clearBook", &WasmChessEngine::clearBook)
+        .function("getBookSize", &WasmChessEngine::getBookSize)
+        .function("saveSnapshot", &WasmChessEngine::saveSnapshot)
+        .function("loadSnapshot", &WasmChessEngine::loadSnapshot)
         .function("getAbilitiesAt", &WasmChessEngine::getAbilitiesAtCoords)
-        .function("getBoardState", &WasmChessEngine::getBoardState);
+        .function("getBoardState", &WasmChessEngine::getBoardState)
+        .function("setThreadCount", &WasmChessEngine::setThreadCount)
+        .function("threadsReady", &WasmChessEngine::threadsReady)
+        .function("getThreadCount", &WasmChessEngine::getThreadCount);
 }
\ No newline at end of file
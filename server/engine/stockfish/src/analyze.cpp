@@ -0,0 +1,297 @@
+/*
+  Absorb Chess offline game-analysis pipeline (native only, see
+  ../build_analyze.sh).
+
+  Ingests an archive of finished games and evaluates every position of every
+  game to a fixed depth, fanning the games out across the engine thread pool.
+  Unlike a normal search the pool threads are not Lazy SMP helpers here: each
+  one is driven as an independent worker with its own root position and a
+  per-thread depth cap (Thread::depthLimit), so N threads analyze N games at
+  once against the shared transposition table. Successive plies of a game hit
+  each other's TT entries; concurrent games are kept apart by salting their
+  keys with a per-game ttTag, the same scheme the multi-game server mode in
+  uci.cpp uses. Batch throughput - positions per core-second across the whole
+  archive - is the point; the per-position path through engine.py achieves a
+  tiny fraction of it.
+
+  Input: one game per line, "<fen> [moves <uci>...]", where the fen may carry
+  the extended '[...]' ability suffixes (see Position::set()). Blank lines and
+  lines starting with '#' are skipped.
+
+  Output: a little-endian binary stream for the post-game review feature.
+    header   "ABGA", uint8 version (1), uint8 search depth, uint16 reserved,
+             uint32 game count (patched in on completion)
+    records  uint32 game, uint16 ply, uint16 best move (Move encoding),
+             int16 score, uint8 reached depth, uint8 flags
+  Scores are from White's point of view. Flags: 0x1 the score is a mate
+  score, 0x2 the position is terminal (no legal moves; the move field is
+  MOVE_NONE and no search ran). Records of one game are contiguous with plies
+  ascending; games appear in completion order, so readers key on the game
+  field. Ply p scores the position before move p of the game.
+
+  Usage: analyze <games.txt> <out.bin> [depth] [threads] [hash_mb]
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "movegen.h"
+#include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "tt.h"
+#include "uci.h"
+
+using namespace std;
+
+namespace PSQT { void init(); }
+namespace AbsorbChess { void init_tables(); }
+
+namespace {
+
+constexpr uint8_t FLAG_MATE     = 0x1;
+constexpr uint8_t FLAG_TERMINAL = 0x2;
+
+struct Record {
+  uint32_t game;
+  uint16_t ply;
+  uint16_t move;
+  int16_t  score;
+  uint8_t  depth;
+  uint8_t  flags;
+};
+
+int searchDepth;
+vector<string> games;
+
+std::atomic<size_t> nextGame(0);
+std::atomic<uint64_t> positionsDone(0);
+
+std::mutex outMutex;
+ofstream out;
+
+void write_record(const Record& r) {
+  out.write(reinterpret_cast<const char*>(&r.game),  sizeof(r.game));
+  out.write(reinterpret_cast<const char*>(&r.ply),   sizeof(r.ply));
+  out.write(reinterpret_cast<const char*>(&r.move),  sizeof(r.move));
+  out.write(reinterpret_cast<const char*>(&r.score), sizeof(r.score));
+  out.write(reinterpret_cast<const char*>(&r.depth), sizeof(r.depth));
+  out.write(reinterpret_cast<const char*>(&r.flags), sizeof(r.flags));
+}
+
+// Run one fixed-depth search on 'th' as an independent worker and score the
+// position from White's point of view. Mirrors the per-thread setup of
+// ThreadPool::start_thinking(), but for this thread only; the extended fen
+// carries the absorbed abilities across to rootPos.
+Record analyze_position(const Position& pos, Thread* th, Key tag,
+                        uint32_t game, uint16_t ply) {
+
+  Record r{game, ply, uint16_t(MOVE_NONE), 0, 0, 0};
+
+  Search::RootMoves rootMoves;
+  for (const auto& m : MoveList<LEGAL>(pos))
+      rootMoves.emplace_back(m);
+
+  if (rootMoves.empty())
+  {
+      // Mate or stalemate: no search to run, score the game result
+      Value v = !pos.checkers() ? VALUE_DRAW
+              : pos.side_to_move() == WHITE ? -VALUE_MATE : VALUE_MATE;
+      r.score = int16_t(v);
+      r.flags = FLAG_TERMINAL | (pos.checkers() ? FLAG_MATE : 0);
+      return r;
+  }
+
+  StateListPtr states(new std::deque<StateInfo>(1));
+  th->rootPos.set(pos.fen(), false, &states->back(), th);
+  th->rootPos.set_tt_tag(tag);
+  th->rootMoves = std::move(rootMoves);
+  th->rootDepth = th->completedDepth = 0;
+  th->nmpMinPly = th->bestMoveChanges = 0;
+  th->depthLimit = searchDepth;
+
+  th->start_searching();
+  th->wait_for_search_finished();
+
+  const Search::RootMove& best = th->rootMoves[0];
+  Value v = best.score;
+
+  r.move  = uint16_t(best.pv[0]);
+  r.score = int16_t(pos.side_to_move() == WHITE ? v : -v);
+  r.depth = uint8_t(th->completedDepth);
+  if (abs(v) >= VALUE_MATE_IN_MAX_PLY)
+      r.flags |= FLAG_MATE;
+
+  return r;
+}
+
+// Walk one archived game and analyze the position before every played move
+// plus the final one. A malformed move ends that game's records early but
+// does not abort the batch.
+void analyze_game(uint32_t g, Thread* th, Key tag, vector<Record>& records) {
+
+  istringstream is(games[g]);
+  string fen, token;
+
+  while (is >> token && token != "moves")
+      fen += token + " ";
+
+  vector<string> played;
+  while (is >> token)
+      played.push_back(token);
+
+  Position pos;
+  StateListPtr states(new std::deque<StateInfo>(1));
+  pos.set(fen, false, &states->back(), th);
+
+  for (size_t ply = 0; ply <= played.size(); ++ply)
+  {
+      records.push_back(analyze_position(pos, th, tag, g, uint16_t(ply)));
+      positionsDone.fetch_add(1, std::memory_order_relaxed);
+
+      if (records.back().flags & FLAG_TERMINAL)
+          break;
+
+      if (ply < played.size())
+      {
+          Move m = UCI::to_move(pos, played[ply]);
+          if (m == MOVE_NONE)
+          {
+              cerr << "game " << g + 1 << ": illegal move '" << played[ply]
+                   << "' at ply " << ply + 1 << ", truncating" << endl;
+              break;
+          }
+          states->emplace_back();
+          pos.do_move(m, states->back());
+      }
+  }
+}
+
+// One worker per pool thread: pull games off the shared counter, analyze
+// them on the owned engine thread and flush each finished game's records in
+// one go, so they stay contiguous in the output.
+void worker_loop(size_t workerIdx) {
+
+  Thread* th = Threads[workerIdx + 1]; // Threads[0] is the unused main thread
+  PRNG rng(0x5049504Bull * (workerIdx + 1));
+
+  for (size_t g = nextGame.fetch_add(1); g < games.size(); g = nextGame.fetch_add(1))
+  {
+      vector<Record> records;
+      analyze_game(uint32_t(g), th, rng.rand<Key>(), records);
+
+      std::lock_guard<std::mutex> lk(outMutex);
+      for (const Record& r : records)
+          write_record(r);
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+
+  if (argc < 3)
+  {
+      cerr << "Usage: analyze <games.txt> <out.bin> [depth] [threads] [hash_mb]"
+           << endl;
+      return EXIT_FAILURE;
+  }
+
+  UCI::init(Options);
+  PSQT::init();
+  Bitboards::init();
+  Position::init();
+  Bitbases::init();
+  Endgames::init();
+  AbsorbChess::init_tables();
+
+  searchDepth     = argc > 3 ? atoi(argv[3]) : 12;
+  int threadCount = argc > 4 ? atoi(argv[4])
+                             : int(std::thread::hardware_concurrency());
+  int hashMb      = argc > 5 ? atoi(argv[5]) : 256;
+
+  ifstream in(argv[1]);
+  if (!in)
+  {
+      cerr << "Cannot open games file: " << argv[1] << endl;
+      return EXIT_FAILURE;
+  }
+
+  string line;
+  while (getline(in, line))
+      if (!line.empty() && line[0] != '#')
+          games.push_back(line);
+
+  if (games.empty())
+  {
+      cerr << "No games in " << argv[1] << endl;
+      return EXIT_FAILURE;
+  }
+
+  out.open(argv[2], ios::binary | ios::trunc);
+  if (!out)
+  {
+      cerr << "Cannot open output file: " << argv[2] << endl;
+      return EXIT_FAILURE;
+  }
+
+  // Threads[0] is the MainThread with its time-management search; the
+  // independent workers are the plain helper threads behind it.
+  Threads.set(size_t(threadCount + 1));
+  TT.resize(size_t(hashMb));
+  Search::clear();
+  TT.new_search();
+
+  Threads.stop = false;
+  Threads.increaseDepth = true;
+  Search::Limits = Search::LimitsType();
+  Search::Limits.infinite = 1; // Workers stop on depthLimit, never on time
+
+  out.write("ABGA", 4);
+  uint8_t version = 1, depth8 = uint8_t(searchDepth);
+  uint16_t reserved = 0;
+  uint32_t gameCount = 0; // Patched below once the batch is complete
+  out.write(reinterpret_cast<const char*>(&version),   sizeof(version));
+  out.write(reinterpret_cast<const char*>(&depth8),    sizeof(depth8));
+  out.write(reinterpret_cast<const char*>(&reserved),  sizeof(reserved));
+  out.write(reinterpret_cast<const char*>(&gameCount), sizeof(gameCount));
+
+  cout << "Analyzing " << games.size() << " games to depth " << searchDepth
+       << " on " << threadCount << " threads, hash " << hashMb << " MB" << endl;
+
+  TimePoint elapsed = now();
+
+  vector<std::thread> pool;
+  for (int t = 0; t < threadCount; t++)
+      pool.emplace_back(worker_loop, size_t(t));
+  for (auto& th : pool)
+      th.join();
+
+  elapsed = now() - elapsed + 1;
+
+  gameCount = uint32_t(games.size());
+  out.seekp(8);
+  out.write(reinterpret_cast<const char*>(&gameCount), sizeof(gameCount));
+  out.close();
+
+  uint64_t positions = positionsDone.load();
+  uint64_t nodes = Threads.nodes_searched();
+
+  cout << "Games            : " << games.size()
+       << "\nPositions        : " << positions
+       << "\nNodes            : " << nodes
+       << "\nTime (ms)        : " << elapsed
+       << "\nPositions/second : " << 1000 * positions / elapsed
+       << "\nPositions/core-s : " << 1000.0 * positions / elapsed / threadCount
+       << "\nNodes/second     : " << 1000 * nodes / elapsed << endl;
+
+  Threads.set(0);
+  return 0;
+}
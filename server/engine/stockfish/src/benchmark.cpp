@@ -92,8 +92,33 @@ const vector<string> Defaults = {
   "setoption name UCI_Chess960 value false"
 };
 
+// Absorb chess corpus, selectable with "bench ... absorb". The entries are
+// extended fens: a '[...]' suffix after a piece letter lists its absorbed
+// abilities (see Position::set()), so each position is stated directly instead
+// of being replayed through a capture sequence from a standard fen. Several
+// pieces per entry stack 2-4 abilities. The comments give how many pieces
+// carry absorbed abilities and the largest ability stack.
+
+const vector<string> AbsorbDefaults = {
+  "r5k[n]1/p1p3b1/B2p4/5p2/1r[p]3P2/2B[p]4P/R[p]1P4P/3K3R w - - 0 22",                    // 4 absorbed pieces, max 2 abilities
+  "5r2/1p1np[n]2k[q]/p7/2p5/P1PR[p]4/8/6PP/4B[r]1K1 b - - 0 26",                          // 4 absorbed pieces, max 2 abilities
+  "8/1p4pk[q]/1pp5/8/4PpP[b]1/8/1PP3P1/N[r]3R[q]1K1 b - - 0 25",                          // 4 absorbed pieces, max 2 abilities
+  "r5k1/2Q[p]2p1p/p1p1b3/6N[p]1/8/1P[r]P[nq]5/2P2KPP/5R2 b - - 0 22",                     // 4 absorbed pieces, max 3 abilities
+  "3b2nr/3k1p1p/8/4r[p]3/2N5/3B4/PPP2R[p]2/1K6 w - - 0 25",                               // 2 absorbed pieces, max 2 abilities
+  "r1b1k[q]3/1pp3pp/p7/6q[b]1/8/8/R[n]PP[n]N1KPP/8 w - - 0 25",                           // 4 absorbed pieces, max 2 abilities
+  "4k[q]3/p6p/8/6P[brq]1/8/8/P4RPP/4BNK1 b - - 0 34",                                     // 2 absorbed pieces, max 4 abilities
+  "7k[r]/2p5/2P2p[n]2/8/8/2P5/P4PP1/2K5 w - - 0 30",                                      // 2 absorbed pieces, max 2 abilities
+  "4k1nr/5p2/4p3/4p2P/3N[brq]P3/r[p]7/7P/6K1 w k - 0 28",                                 // 2 absorbed pieces, max 4 abilities
+};
+
 } // namespace
 
+/// absorb_bench_positions() exposes the absorb corpus to the standalone perft
+/// tool (perft.cpp) so that it counts the exact same positions bench searches.
+
+const vector<string>& absorb_bench_positions() { return AbsorbDefaults; }
+
+
 /// setup_bench() builds a list of UCI commands to be run by bench. There
 /// are five parameters: TT size in MB, number of search threads that
 /// should be used, the limit value spent for each position, a file name
@@ -102,6 +127,7 @@ const vector<string> Defaults = {
 ///
 /// bench -> search default positions up to depth 13
 /// bench 64 1 15 -> search default positions up to depth 15 (TT = 64MB)
+/// bench 16 1 13 absorb -> search the absorb-chess corpus up to depth 13
 /// bench 64 4 5000 current movetime -> search current position with 4 threads for 5 sec
 /// bench 64 1 100000 default nodes -> search default positions for 100K nodes each
 /// bench 16 1 5 default perft -> run a perft 5 on default positions
@@ -123,6 +149,9 @@ vector<string> setup_bench(const Position& current, istream& is) {
   if (fenFile == "default")
       fens = Defaults;
 
+  else if (fenFile == "absorb")
+      fens = AbsorbDefaults;
+
   else if (fenFile == "current")
       fens.push_back(current.fen());
 
@@ -19,8 +19,6 @@
 */
 
 #include <cassert>
-#include <vector>
-#include <bitset>
 
 #include "bitboard.h"
 #include "types.h"
@@ -31,8 +29,6 @@ namespace {
   // Positions with the pawn on files E to H will be mirrored before probing.
   constexpr unsigned MAX_INDEX = 2*24*64*64; // stm * psq * wksq * bksq = 196608
 
-  std::bitset<MAX_INDEX> KPKBitbase;
-
   // A KPK bitbase index is an integer in [0, IndexMax] range
   //
   // Information is mapped in a way that minimizes the number of iterations:
@@ -46,25 +42,783 @@ namespace {
     return int(wksq) | (bksq << 6) | (stm << 12) | (file_of(psq) << 13) | ((RANK_7 - rank_of(psq)) << 15);
   }
 
-  enum Result {
-    INVALID = 0,
-    UNKNOWN = 1,
-    DRAW    = 2,
-    WIN     = 4
-  };
-
-  Result& operator|=(Result& r, Result v) { return r = Result(r | v); }
-
-  struct KPKPosition {
-    KPKPosition() = default;
-    explicit KPKPosition(unsigned idx);
-    operator Result() const { return result; }
-    Result classify(const std::vector<KPKPosition>& db);
-
-    Color stm;
-    Square ksq[COLOR_NB], psq;
-    Result result;
-  };
+  // The bitbase itself, one bit per index, set for the won positions. The
+  // retrograde fixpoint iteration that used to build this at startup needs
+  // the runtime attack tables and far exceeds what a constexpr evaluator
+  // accepts, so the finished table is embedded instead: it was produced by
+  // running the old Bitbases::init() and dumping the bitset as 32-bit words.
+  // Absorbed abilities never reach this code; Material::probe() only selects
+  // the KPK evaluators when every piece moves exactly as its base type.
+constexpr uint32_t KPKBitbase[MAX_INDEX / 32] = {
+0xFFFFFCFCu, 0xFFFEFFFFu, 0xFFFFF8F8u, 0xFFFEFFFFu, 0xFFFFF1F1u, 0xFFFEFFFFu, 0xFFFFE3E3u, 0xFFFEFFFFu,
+0xFFFFC7C7u, 0xFFFEFFFFu, 0xFFFF8F8Fu, 0xFFFEFFFFu, 0xFFFF1F1Fu, 0xFFFEFFFFu, 0xFFFF3F3Fu, 0xFFFEFFFFu,
+0xFFFCFCFCu, 0xFFFEFFFFu, 0xFFF8F8F8u, 0xFFFEFFFFu, 0xFFF1F1F1u, 0xFFFEFFFFu, 0xFFE3E3E3u, 0xFFFEFFFFu,
+0xFFC7C7C7u, 0xFFFEFFFFu, 0xFF8F8F8Fu, 0xFFFEFFFFu, 0xFF1F1F1Fu, 0xFFFEFFFFu, 0xFF3F3F3Fu, 0xFFFEFFFFu,
+0xFCFCFCFFu, 0xFFFEFFFFu, 0xF8F8F8FFu, 0xFFFEFFFFu, 0xF1F1F1FFu, 0xFFFEFFFFu, 0xE3E3E3FFu, 0xFFFEFFFFu,
+0xC7C7C7FFu, 0xFFFEFFFFu, 0x8F8F8FFFu, 0xFFFEFFFFu, 0x1F1F1FFFu, 0xFFFEFFFFu, 0x3F3F3FFFu, 0xFFFEFFFFu,
+0xFCFCFFFFu, 0xFFFEFFFCu, 0xF8F8FFFFu, 0xFFFEFFF8u, 0xF1F1FFFFu, 0xFFFEFFF1u, 0xE3E3FFFFu, 0xFFFEFFE3u,
+0xC7C7FFFFu, 0xFFFEFFC7u, 0x8F8FFFFFu, 0xFFFEFF8Fu, 0x1F1FFFFFu, 0xFFFEFF1Fu, 0x3F3FFFFFu, 0xFFFEFF3Fu,
+0xFCFFFFFFu, 0xFFFEFCFCu, 0xF8FFFFFFu, 0xFFFEF8F8u, 0xF1FFFFFFu, 0xFFFEF1F1u, 0xE3FFFFFFu, 0xFFFEE3E3u,
+0xC7FFFFFFu, 0xFFFEC7C7u, 0x8FFFFFFFu, 0xFFFE8F8Fu, 0x1FFFFFFFu, 0xFFFE1F1Fu, 0x3FFFFFFFu, 0xFFFE3F3Fu,
+0xFFFFFFFFu, 0xFFFCFCFCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF0F1F1u, 0xFFFFFFFFu, 0xFFE2E3E3u,
+0xFFFFFFFFu, 0xFFC6C7C7u, 0xFFFFFFFFu, 0xFF8E8F8Fu, 0xFFFFFFFFu, 0xFF1E1F1Fu, 0xFFFFFFFFu, 0xFF3E3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xF0F0F1FFu, 0xFFFFFFFFu, 0xE3E2E3FFu,
+0xFFFFFFFFu, 0xC7C6C7FFu, 0xFFFFFFFFu, 0x8F8E8FFFu, 0xFFFFFFFFu, 0x1F1E1FFFu, 0xFFFFFFFFu, 0x3F3E3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xF0F0FFFFu, 0xFFFFFFFFu, 0xE3E2FFFFu,
+0xFFFFFFFFu, 0xC7C6FFFFu, 0xFFFFFFFFu, 0x8F8EFFFFu, 0xFFFFFFFFu, 0x1F1EFFFFu, 0xFFFFFFFFu, 0x3F3EFFFFu,
+0xFFFFFCFCu, 0xFFFEFFFFu, 0xFFFFF8F8u, 0xFFFEFFFFu, 0xFFFFF1F1u, 0xFFFEFFFFu, 0xFFFFE3E3u, 0xFFFEFFFFu,
+0xFFFFC7C7u, 0xFFFEFFFFu, 0xFFFF8F8Fu, 0xFFFEFFFFu, 0xFFFF1F1Fu, 0xFFFEFFFFu, 0xFFFF3F3Fu, 0xFFFEFFFFu,
+0xFFFCFCFCu, 0xFFFEFFFFu, 0xFFF8F8F8u, 0xFFFEFFFFu, 0xFFF1F1F1u, 0xFFFEFFFFu, 0xFFE3E3E3u, 0xFFFEFFFFu,
+0xFFC7C7C7u, 0xFFFEFFFFu, 0xFF8F8F8Fu, 0xFFFEFFFFu, 0xFF1F1F1Fu, 0xFFFEFFFFu, 0xFF3F3F3Fu, 0xFFFEFFFFu,
+0xFCFCFCFFu, 0xFFFEFFFFu, 0xF8F8F8FFu, 0xFFFEFFFFu, 0xF1F1F1FFu, 0xFFFEFFFFu, 0xE3E3E3FFu, 0xFFFEFFFFu,
+0xC7C7C7FFu, 0xFFFEFFFFu, 0x8F8F8FFFu, 0xFFFEFFFFu, 0x1F1F1FFFu, 0xFFFEFFFFu, 0x3F3F3FFFu, 0xFFFEFFFFu,
+0xFCFCFFFFu, 0xFFFEFFFCu, 0xF8F8FFFFu, 0xFFFEFFF8u, 0xF1F1FFFFu, 0xFFFEFFF1u, 0xE3E3FFFFu, 0xFFFEFFE3u,
+0xC7C7FFFFu, 0xFFFEFFC7u, 0x8F8FFFFFu, 0xFFFEFF8Fu, 0x1F1FFFFFu, 0xFFFEFF1Fu, 0x3F3FFFFFu, 0xFFFEFF3Fu,
+0xFCFFFFFFu, 0xFFFEFCFCu, 0xF8FFFFFFu, 0xFFFEF8F8u, 0xF1FFFFFFu, 0xFFFEF1F1u, 0xE3FFFFFFu, 0xFFFEE3E3u,
+0xC7FFFFFFu, 0xFFFEC7C7u, 0x8FFFFFFFu, 0xFFFE8F8Fu, 0x1FFFFFFFu, 0xFFFE1F1Fu, 0x3FFFFFFFu, 0xFFFE3F3Fu,
+0x00000000u, 0x03000000u, 0x00000000u, 0x02000000u, 0x00000000u, 0x06000100u, 0xFFFFFFFFu, 0xFEE2E3E3u,
+0xFFFFFFFFu, 0xFFC6C7C7u, 0xFFFFFFFFu, 0xFF8E8F8Fu, 0xFFFFFFFFu, 0xFF1E1F1Fu, 0xFFFFFFFFu, 0xFF3E3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000100u, 0xFFFFFFFFu, 0xE2E2E3FFu,
+0xFFFFFFFFu, 0xC7C6C7FFu, 0xFFFFFFFFu, 0x8F8E8FFFu, 0xFFFFFFFFu, 0x1F1E1FFFu, 0xFFFFFFFFu, 0x3F3E3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000700u, 0xFFFFFFFFu, 0xE2E2FFFFu,
+0xFFFFFFFFu, 0xC7C6FFFFu, 0xFFFFFFFFu, 0x8F8EFFFFu, 0xFFFFFFFFu, 0x1F1EFFFFu, 0xFFFFFFFFu, 0x3F3EFFFFu,
+0xFFFFFCFCu, 0xFFFDFFFFu, 0xFFFFF8F8u, 0xFFFDFFFFu, 0xFFFFF1F1u, 0xFFFDFFFFu, 0xFFFFE3E3u, 0xFFFDFFFFu,
+0xFFFFC7C7u, 0xFFFDFFFFu, 0xFFFF8F8Fu, 0xFFFDFFFFu, 0xFFFF1F1Fu, 0xFFFDFFFFu, 0xFFFF3F3Fu, 0xFFFDFFFFu,
+0xFFFCFCFCu, 0xFFFDFFFFu, 0xFFF8F8F8u, 0xFFFDFFFFu, 0xFFF1F1F1u, 0xFFFDFFFFu, 0xFFE3E3E3u, 0xFFFDFFFFu,
+0xFFC7C7C7u, 0xFFFDFFFFu, 0xFF8F8F8Fu, 0xFFFDFFFFu, 0xFF1F1F1Fu, 0xFFFDFFFFu, 0xFF3F3F3Fu, 0xFFFDFFFFu,
+0xFCFCFCFFu, 0xFFFDFFFFu, 0xF8F8F8FFu, 0xFFFDFFFFu, 0xF1F1F1FFu, 0xFFFDFFFFu, 0xE3E3E3FFu, 0xFFFDFFFFu,
+0xC7C7C7FFu, 0xFFFDFFFFu, 0x8F8F8FFFu, 0xFFFDFFFFu, 0x1F1F1FFFu, 0xFFFDFFFFu, 0x3F3F3FFFu, 0xFFFDFFFFu,
+0xFCFCFFFFu, 0xFFFDFFFCu, 0xF8F8FFFFu, 0xFFFDFFF8u, 0xF1F1FFFFu, 0xFFFDFFF1u, 0xE3E3FFFFu, 0xFFFDFFE3u,
+0xC7C7FFFFu, 0xFFFDFFC7u, 0x8F8FFFFFu, 0xFFFDFF8Fu, 0x1F1FFFFFu, 0xFFFDFF1Fu, 0x3F3FFFFFu, 0xFFFDFF3Fu,
+0xFCFFFFFFu, 0xFFFDFCFCu, 0xF8FFFFFFu, 0xFFFDF8F8u, 0xF1FFFFFFu, 0xFFFDF1F1u, 0xE3FFFFFFu, 0xFFFDE3E3u,
+0xC7FFFFFFu, 0xFFFDC7C7u, 0x8FFFFFFFu, 0xFFFD8F8Fu, 0x1FFFFFFFu, 0xFFFD1F1Fu, 0x3FFFFFFFu, 0xFFFD3F3Fu,
+0xFFFFFFFFu, 0xFFFCFCFCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE1E3E3u,
+0xFFFFFFFFu, 0xFFC5C7C7u, 0xFFFFFFFFu, 0xFF8D8F8Fu, 0xFFFFFFFFu, 0xFF1D1F1Fu, 0xFFFFFFFFu, 0xFF3D3F3Fu,
+0x00000000u, 0x0C0C0C00u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01010100u, 0xFFFFFFFFu, 0xE3E1E3FFu,
+0xFFFFFFFFu, 0xC7C5C7FFu, 0xFFFFFFFFu, 0x8F8D8FFFu, 0xFFFFFFFFu, 0x1F1D1FFFu, 0xFFFFFFFFu, 0x3F3D3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00080A0Fu, 0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xE3E1FFFFu,
+0xFFFFFFFFu, 0xC7C5FFFFu, 0xFFFFFFFFu, 0x8F8DFFFFu, 0xFFFFFFFFu, 0x1F1DFFFFu, 0xFFFFFFFFu, 0x3F3DFFFFu,
+0xFFFFFCFCu, 0xFFFDFFFFu, 0xFFFFF8F8u, 0xFFFDFFFFu, 0xFFFFF1F1u, 0xFFFDFFFFu, 0xFFFFE3E3u, 0xFFFDFFFFu,
+0xFFFFC7C7u, 0xFFFDFFFFu, 0xFFFF8F8Fu, 0xFFFDFFFFu, 0xFFFF1F1Fu, 0xFFFDFFFFu, 0xFFFF3F3Fu, 0xFFFDFFFFu,
+0xFFFCFCFCu, 0xFFFDFFFFu, 0xFFF8F8F8u, 0xFFFDFFFFu, 0xFFF1F1F1u, 0xFFFDFFFFu, 0xFFE3E3E3u, 0xFFFDFFFFu,
+0xFFC7C7C7u, 0xFFFDFFFFu, 0xFF8F8F8Fu, 0xFFFDFFFFu, 0xFF1F1F1Fu, 0xFFFDFFFFu, 0xFF3F3F3Fu, 0xFFFDFFFFu,
+0xFCFCFCFFu, 0xFFFDFFFFu, 0xF8F8F8FFu, 0xFFFDFFFFu, 0xF1F1F1FFu, 0xFFFDFFFFu, 0xE3E3E3FFu, 0xFFFDFFFFu,
+0xC7C7C7FFu, 0xFFFDFFFFu, 0x8F8F8FFFu, 0xFFFDFFFFu, 0x1F1F1FFFu, 0xFFFDFFFFu, 0x3F3F3FFFu, 0xFFFDFFFFu,
+0xFCFCFFFFu, 0xFFFDFFFCu, 0xF8F8FFFFu, 0xFFFDFFF8u, 0xF1F1FFFFu, 0xFFFDFFF1u, 0xE3E3FFFFu, 0xFFFDFFE3u,
+0xC7C7FFFFu, 0xFFFDFFC7u, 0x8F8FFFFFu, 0xFFFDFF8Fu, 0x1F1FFFFFu, 0xFFFDFF1Fu, 0x3F3FFFFFu, 0xFFFDFF3Fu,
+0xFCFFFFFFu, 0xFFFDFCFCu, 0xF8FFFFFFu, 0xFFFDF8F8u, 0xF1FFFFFFu, 0xFFFDF1F1u, 0xE3FFFFFFu, 0xFFFDE3E3u,
+0xC7FFFFFFu, 0xFFFDC7C7u, 0x8FFFFFFFu, 0xFFFD8F8Fu, 0x1FFFFFFFu, 0xFFFD1F1Fu, 0x3FFFFFFFu, 0xFFFD3F3Fu,
+0x00000000u, 0x07040400u, 0x00000000u, 0x07000000u, 0x00000000u, 0x07010100u, 0x00000000u, 0x0F010300u,
+0xFFFFFFFFu, 0xFFC5C7C7u, 0xFFFFFFFFu, 0xFF8D8F8Fu, 0xFFFFFFFFu, 0xFF1D1F1Fu, 0xFFFFFFFFu, 0xFF3D3F3Fu,
+0x00000000u, 0x04040000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01010000u, 0x00000000u, 0x03010300u,
+0xFFFFFFFFu, 0xC7C5C7FFu, 0xFFFFFFFFu, 0x8F8D8FFFu, 0xFFFFFFFFu, 0x1F1D1FFFu, 0xFFFFFFFFu, 0x3F3D3FFFu,
+0x00000000u, 0x04040200u, 0x00000000u, 0x00000500u, 0x00000000u, 0x01010200u, 0x00000000u, 0x03010F00u,
+0xFFFFFFFFu, 0xC7C5FFFFu, 0xFFFFFFFFu, 0x8F8DFFFFu, 0xFFFFFFFFu, 0x1F1DFFFFu, 0xFFFFFFFFu, 0x3F3DFFFFu,
+0xFFFFFCFCu, 0xFFFBFFFFu, 0xFFFFF8F8u, 0xFFFBFFFFu, 0xFFFFF1F1u, 0xFFFBFFFFu, 0xFFFFE3E3u, 0xFFFBFFFFu,
+0xFFFFC7C7u, 0xFFFBFFFFu, 0xFFFF8F8Fu, 0xFFFBFFFFu, 0xFFFF1F1Fu, 0xFFFBFFFFu, 0xFFFF3F3Fu, 0xFFFBFFFFu,
+0xFFFCFCFCu, 0xFFFBFFFFu, 0xFFF8F8F8u, 0xFFFBFFFFu, 0xFFF1F1F1u, 0xFFFBFFFFu, 0xFFE3E3E3u, 0xFFFBFFFFu,
+0xFFC7C7C7u, 0xFFFBFFFFu, 0xFF8F8F8Fu, 0xFFFBFFFFu, 0xFF1F1F1Fu, 0xFFFBFFFFu, 0xFF3F3F3Fu, 0xFFFBFFFFu,
+0xFCFCFCFFu, 0xFFFBFFFFu, 0xF8F8F8FFu, 0xFFFBFFFFu, 0xF1F1F1FFu, 0xFFFBFFFFu, 0xE3E3E3FFu, 0xFFFBFFFFu,
+0xC7C7C7FFu, 0xFFFBFFFFu, 0x8F8F8FFFu, 0xFFFBFFFFu, 0x1F1F1FFFu, 0xFFFBFFFFu, 0x3F3F3FFFu, 0xFFFBFFFFu,
+0xFCFCFFFFu, 0xFFFBFFFCu, 0xF8F8FFFFu, 0xFFFBFFF8u, 0xF1F1FFFFu, 0xFFFBFFF1u, 0xE3E3FFFFu, 0xFFFBFFE3u,
+0xC7C7FFFFu, 0xFFFBFFC7u, 0x8F8FFFFFu, 0xFFFBFF8Fu, 0x1F1FFFFFu, 0xFFFBFF1Fu, 0x3F3FFFFFu, 0xFFFBFF3Fu,
+0xFCFFFFFFu, 0xFFFBFCFCu, 0xF8FFFFFFu, 0xFFFBF8F8u, 0xF1FFFFFFu, 0xFFFBF1F1u, 0xE3FFFFFFu, 0xFFFBE3E3u,
+0xC7FFFFFFu, 0xFFFBC7C7u, 0x8FFFFFFFu, 0xFFFB8F8Fu, 0x1FFFFFFFu, 0xFFFB1F1Fu, 0x3FFFFFFFu, 0xFFFB3F3Fu,
+0xFFFFFFFFu, 0xFFF8FCFCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE3E3E3u,
+0xFFFFFFFFu, 0xFFC3C7C7u, 0xFFFFFFFFu, 0xFF8B8F8Fu, 0xFFFFFFFFu, 0xFF1B1F1Fu, 0xFFFFFFFFu, 0xFF3B3F3Fu,
+0xFFFFFFFFu, 0xFCF8FCFFu, 0x00000000u, 0x18181800u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+0xFFFFFFFFu, 0xC7C3C7FFu, 0xFFFFFFFFu, 0x8F8B8FFFu, 0xFFFFFFFFu, 0x1F1B1FFFu, 0xFFFFFFFFu, 0x3F3B3FFFu,
+0xFFFFFFFFu, 0xFCF8FFFFu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0011151Fu, 0x00000000u, 0x00000000u,
+0xFFFFFFFFu, 0xC7C3FFFFu, 0xFFFFFFFFu, 0x8F8BFFFFu, 0xFFFFFFFFu, 0x1F1BFFFFu, 0xFFFFFFFFu, 0x3F3BFFFFu,
+0xFFFFFCFCu, 0xFFFBFFFFu, 0xFFFFF8F8u, 0xFFFBFFFFu, 0xFFFFF1F1u, 0xFFFBFFFFu, 0xFFFFE3E3u, 0xFFFBFFFFu,
+0xFFFFC7C7u, 0xFFFBFFFFu, 0xFFFF8F8Fu, 0xFFFBFFFFu, 0xFFFF1F1Fu, 0xFFFBFFFFu, 0xFFFF3F3Fu, 0xFFFBFFFFu,
+0xFFFCFCFCu, 0xFFFBFFFFu, 0xFFF8F8F8u, 0xFFFBFFFFu, 0xFFF1F1F1u, 0xFFFBFFFFu, 0xFFE3E3E3u, 0xFFFBFFFFu,
+0xFFC7C7C7u, 0xFFFBFFFFu, 0xFF8F8F8Fu, 0xFFFBFFFFu, 0xFF1F1F1Fu, 0xFFFBFFFFu, 0xFF3F3F3Fu, 0xFFFBFFFFu,
+0xFCFCFCFFu, 0xFFFBFFFFu, 0xF8F8F8FFu, 0xFFFBFFFFu, 0xF1F1F1FFu, 0xFFFBFFFFu, 0xE3E3E3FFu, 0xFFFBFFFFu,
+0xC7C7C7FFu, 0xFFFBFFFFu, 0x8F8F8FFFu, 0xFFFBFFFFu, 0x1F1F1FFFu, 0xFFFBFFFFu, 0x3F3F3FFFu, 0xFFFBFFFFu,
+0xFCFCFFFFu, 0xFFFBFFFCu, 0xF8F8FFFFu, 0xFFFBFFF8u, 0xF1F1FFFFu, 0xFFFBFFF1u, 0xE3E3FFFFu, 0xFFFBFFE3u,
+0xC7C7FFFFu, 0xFFFBFFC7u, 0x8F8FFFFFu, 0xFFFBFF8Fu, 0x1F1FFFFFu, 0xFFFBFF1Fu, 0x3F3FFFFFu, 0xFFFBFF3Fu,
+0xFCFFFFFFu, 0xFFFBFCFCu, 0xF8FFFFFFu, 0xFFFBF8F8u, 0xF1FFFFFFu, 0xFFFBF1F1u, 0xE3FFFFFFu, 0xFFFBE3E3u,
+0xC7FFFFFFu, 0xFFFBC7C7u, 0x8FFFFFFFu, 0xFFFB8F8Fu, 0x1FFFFFFFu, 0xFFFB1F1Fu, 0x3FFFFFFFu, 0xFFFB3F3Fu,
+0x00000000u, 0x1F181C00u, 0x00000000u, 0x0E080800u, 0x00000000u, 0x0E000000u, 0x00000000u, 0x0E020200u,
+0x00000000u, 0x1F030700u, 0xFFFFFFFFu, 0xFF8B8F8Fu, 0xFFFFFFFFu, 0xFF1B1F1Fu, 0xFFFFFFFFu, 0xFF3B3F3Fu,
+0x00000000u, 0x1C181C00u, 0x00000000u, 0x08080000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+0x00000000u, 0x07030700u, 0xFFFFFFFFu, 0x8F8B8FFFu, 0xFFFFFFFFu, 0x1F1B1FFFu, 0xFFFFFFFFu, 0x3F3B3FFFu,
+0x00000000u, 0x1C181C00u, 0x00000000u, 0x08080400u, 0x00000000u, 0x00000A00u, 0x00000000u, 0x02020400u,
+0x00000000u, 0x07031F00u, 0xFFFFFFFFu, 0x8F8BFFFFu, 0xFFFFFFFFu, 0x1F1BFFFFu, 0xFFFFFFFFu, 0x3F3BFFFFu,
+0xFFFFFCFCu, 0xFFF7FFFFu, 0xFFFFF8F8u, 0xFFF7FFFFu, 0xFFFFF1F1u, 0xFFF7FFFFu, 0xFFFFE3E3u, 0xFFF7FFFFu,
+0xFFFFC7C7u, 0xFFF7FFFFu, 0xFFFF8F8Fu, 0xFFF7FFFFu, 0xFFFF1F1Fu, 0xFFF7FFFFu, 0xFFFF3F3Fu, 0xFFF7FFFFu,
+0xFFFCFCFCu, 0xFFF7FFFFu, 0xFFF8F8F8u, 0xFFF7FFFFu, 0xFFF1F1F1u, 0xFFF7FFFFu, 0xFFE3E3E3u, 0xFFF7FFFFu,
+0xFFC7C7C7u, 0xFFF7FFFFu, 0xFF8F8F8Fu, 0xFFF7FFFFu, 0xFF1F1F1Fu, 0xFFF7FFFFu, 0xFF3F3F3Fu, 0xFFF7FFFFu,
+0xFCFCFCFFu, 0xFFF7FFFFu, 0xF8F8F8FFu, 0xFFF7FFFFu, 0xF1F1F1FFu, 0xFFF7FFFFu, 0xE3E3E3FFu, 0xFFF7FFFFu,
+0xC7C7C7FFu, 0xFFF7FFFFu, 0x8F8F8FFFu, 0xFFF7FFFFu, 0x1F1F1FFFu, 0xFFF7FFFFu, 0x3F3F3FFFu, 0xFFF7FFFFu,
+0xFCFCFFFFu, 0xFFF7FFFCu, 0xF8F8FFFFu, 0xFFF7FFF8u, 0xF1F1FFFFu, 0xFFF7FFF1u, 0xE3E3FFFFu, 0xFFF7FFE3u,
+0xC7C7FFFFu, 0xFFF7FFC7u, 0x8F8FFFFFu, 0xFFF7FF8Fu, 0x1F1FFFFFu, 0xFFF7FF1Fu, 0x3F3FFFFFu, 0xFFF7FF3Fu,
+0xFCFFFFFFu, 0xFFF7FCFCu, 0xF8FFFFFFu, 0xFFF7F8F8u, 0xF1FFFFFFu, 0xFFF7F1F1u, 0xE3FFFFFFu, 0xFFF7E3E3u,
+0xC7FFFFFFu, 0xFFF7C7C7u, 0x8FFFFFFFu, 0xFFF78F8Fu, 0x1FFFFFFFu, 0xFFF71F1Fu, 0x3FFFFFFFu, 0xFFF73F3Fu,
+0xFFFFFFFFu, 0xFFF4FCFCu, 0xFFFFFFFFu, 0xFFF0F8F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE3E3E3u,
+0xFFFFFFFFu, 0xFFC7C7C7u, 0xFFFFFFFFu, 0xFF878F8Fu, 0xFFFFFFFFu, 0xFF171F1Fu, 0xFFFFFFFFu, 0xFF373F3Fu,
+0xFFFFFFFFu, 0xFCF4FCFFu, 0xFFFFFFFFu, 0xF8F0F8FFu, 0x00000000u, 0x30303000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x06060600u, 0xFFFFFFFFu, 0x8F878FFFu, 0xFFFFFFFFu, 0x1F171FFFu, 0xFFFFFFFFu, 0x3F373FFFu,
+0xFFFFFFFFu, 0xFCF4FFFFu, 0xFFFFFFFFu, 0xF8F0FFFFu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00222A3Eu,
+0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x8F87FFFFu, 0xFFFFFFFFu, 0x1F17FFFFu, 0xFFFFFFFFu, 0x3F37FFFFu,
+0xFFFFFCFCu, 0xFFF7FFFFu, 0xFFFFF8F8u, 0xFFF7FFFFu, 0xFFFFF1F1u, 0xFFF7FFFFu, 0xFFFFE3E3u, 0xFFF7FFFFu,
+0xFFFFC7C7u, 0xFFF7FFFFu, 0xFFFF8F8Fu, 0xFFF7FFFFu, 0xFFFF1F1Fu, 0xFFF7FFFFu, 0xFFFF3F3Fu, 0xFFF7FFFFu,
+0xFFFCFCFCu, 0xFFF7FFFFu, 0xFFF8F8F8u, 0xFFF7FFFFu, 0xFFF1F1F1u, 0xFFF7FFFFu, 0xFFE3E3E3u, 0xFFF7FFFFu,
+0xFFC7C7C7u, 0xFFF7FFFFu, 0xFF8F8F8Fu, 0xFFF7FFFFu, 0xFF1F1F1Fu, 0xFFF7FFFFu, 0xFF3F3F3Fu, 0xFFF7FFFFu,
+0xFCFCFCFFu, 0xFFF7FFFFu, 0xF8F8F8FFu, 0xFFF7FFFFu, 0xF1F1F1FFu, 0xFFF7FFFFu, 0xE3E3E3FFu, 0xFFF7FFFFu,
+0xC7C7C7FFu, 0xFFF7FFFFu, 0x8F8F8FFFu, 0xFFF7FFFFu, 0x1F1F1FFFu, 0xFFF7FFFFu, 0x3F3F3FFFu, 0xFFF7FFFFu,
+0xFCFCFFFFu, 0xFFF7FFFCu, 0xF8F8FFFFu, 0xFFF7FFF8u, 0xF1F1FFFFu, 0xFFF7FFF1u, 0xE3E3FFFFu, 0xFFF7FFE3u,
+0xC7C7FFFFu, 0xFFF7FFC7u, 0x8F8FFFFFu, 0xFFF7FF8Fu, 0x1F1FFFFFu, 0xFFF7FF1Fu, 0x3F3FFFFFu, 0xFFF7FF3Fu,
+0xFCFFFFFFu, 0xFFF7FCFCu, 0xF8FFFFFFu, 0xFFF7F8F8u, 0xF1FFFFFFu, 0xFFF7F1F1u, 0xE3FFFFFFu, 0xFFF7E3E3u,
+0xC7FFFFFFu, 0xFFF7C7C7u, 0x8FFFFFFFu, 0xFFF78F8Fu, 0x1FFFFFFFu, 0xFFF71F1Fu, 0x3FFFFFFFu, 0xFFF73F3Fu,
+0xFFFFFFFFu, 0xFFF4FCFCu, 0x00000000u, 0x3E303800u, 0x00000000u, 0x1C101000u, 0x00000000u, 0x1C000000u,
+0x00000000u, 0x1C040400u, 0x00000000u, 0x3E060E00u, 0xFFFFFFFFu, 0xFF171F1Fu, 0xFFFFFFFFu, 0xFF373F3Fu,
+0xFFFFFFFFu, 0xFCF4FCFFu, 0x00000000u, 0x38303800u, 0x00000000u, 0x10100000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x04040000u, 0x00000000u, 0x0E060E00u, 0xFFFFFFFFu, 0x1F171FFFu, 0xFFFFFFFFu, 0x3F373FFFu,
+0xFFFFFFFFu, 0xFCF4FFFFu, 0x00000000u, 0x38303E00u, 0x00000000u, 0x10100800u, 0x00000000u, 0x00001400u,
+0x00000000u, 0x04040800u, 0x00000000u, 0x0E063E00u, 0xFFFFFFFFu, 0x1F17FFFFu, 0xFFFFFFFFu, 0x3F37FFFFu,
+0xFFFFFCFCu, 0xFFFFFEFFu, 0xFFFFF8F8u, 0xFFFFFEFFu, 0xFFFFF1F1u, 0xFFFFFEFFu, 0xFFFFE3E3u, 0xFFFFFEFFu,
+0xFFFFC7C7u, 0xFFFFFEFFu, 0xFFFF8F8Fu, 0xFFFFFEFFu, 0xFFFF1F1Fu, 0xFFFFFEFFu, 0xFFFF3F3Fu, 0xFFFFFEFFu,
+0xFFFCFCFCu, 0xFFFFFEFFu, 0xFFF8F8F8u, 0xFFFFFEFFu, 0xFFF1F1F1u, 0xFFFFFEFFu, 0xFFE3E3E3u, 0xFFFFFEFFu,
+0xFFC7C7C7u, 0xFFFFFEFFu, 0xFF8F8F8Fu, 0xFFFFFEFFu, 0xFF1F1F1Fu, 0xFFFFFEFFu, 0xFF3F3F3Fu, 0xFFFFFEFFu,
+0xFCFCFCFFu, 0xFFFFFEFFu, 0xF8F8F8FFu, 0xFFFFFEFFu, 0xF1F1F1FFu, 0xFFFFFEFFu, 0xE3E3E3FFu, 0xFFFFFEFFu,
+0xC7C7C7FFu, 0xFFFFFEFFu, 0x8F8F8FFFu, 0xFFFFFEFFu, 0x1F1F1FFFu, 0xFFFFFEFFu, 0x3F3F3FFFu, 0xFFFFFEFFu,
+0xFCFCFFFFu, 0xFFFFFEFCu, 0xF8F8FFFFu, 0xFFFFFEF8u, 0xF1F1FFFFu, 0xFFFFFEF1u, 0xE3E3FFFFu, 0xFFFFFEE3u,
+0xC7C7FFFFu, 0xFFFFFEC7u, 0x8F8FFFFFu, 0xFFFFFE8Fu, 0x1F1FFFFFu, 0xFFFFFE1Fu, 0x3F3FFFFFu, 0xFFFFFE3Fu,
+0xFCFFFFFFu, 0xFFFFFCFCu, 0xF8FFFFFFu, 0xFFFFF8F8u, 0xF1FFFFFFu, 0xFFFFF0F1u, 0xE3FFFFFFu, 0xFFFFE2E3u,
+0xC7FFFFFFu, 0xFFFFC6C7u, 0x8FFFFFFFu, 0xFFFF8E8Fu, 0x1FFFFFFFu, 0xFFFF1E1Fu, 0x3FFFFFFFu, 0xFFFF3E3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000000u, 0x07010000u, 0xFFFFFFFFu, 0xFFE3E2E3u,
+0xFFFFFFFFu, 0xFFC7C6C7u, 0xFFFFFFFFu, 0xFF8F8E8Fu, 0xFFFFFFFFu, 0xFF1F1E1Fu, 0xFFFFFFFFu, 0xFF3F3E3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xE3E3E2FFu,
+0xFFFFFFFFu, 0xC7C7C6FFu, 0xFFFFFFFFu, 0x8F8F8EFFu, 0xFFFFFFFFu, 0x1F1F1EFFu, 0xFFFFFFFFu, 0x3F3F3EFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000600u, 0xFFFFFFFFu, 0xE3E3FEFFu,
+0xFFFFFFFFu, 0xC7C7FEFFu, 0xFFFFFFFFu, 0x8F8FFEFFu, 0xFFFFFFFFu, 0x1F1FFEFFu, 0xFFFFFFFFu, 0x3F3FFEFFu,
+0xFFFFFCFCu, 0xFFFFFEFFu, 0xFFFFF8F8u, 0xFFFFFEFFu, 0xFFFFF1F1u, 0xFFFFFEFFu, 0xFFFFE3E3u, 0xFFFFFEFFu,
+0xFFFFC7C7u, 0xFFFFFEFFu, 0xFFFF8F8Fu, 0xFFFFFEFFu, 0xFFFF1F1Fu, 0xFFFFFEFFu, 0xFFFF3F3Fu, 0xFFFFFEFFu,
+0xFFFCFCFCu, 0xFFFFFEFFu, 0xFFF8F8F8u, 0xFFFFFEFFu, 0xFFF1F1F1u, 0xFFFFFEFFu, 0xFFE3E3E3u, 0xFFFFFEFFu,
+0xFFC7C7C7u, 0xFFFFFEFFu, 0xFF8F8F8Fu, 0xFFFFFEFFu, 0xFF1F1F1Fu, 0xFFFFFEFFu, 0xFF3F3F3Fu, 0xFFFFFEFFu,
+0xFCFCFCFFu, 0xFFFFFEFFu, 0xF8F8F8FFu, 0xFFFFFEFFu, 0xF1F1F1FFu, 0xFFFFFEFFu, 0xE3E3E3FFu, 0xFFFFFEFFu,
+0xC7C7C7FFu, 0xFFFFFEFFu, 0x8F8F8FFFu, 0xFFFFFEFFu, 0x1F1F1FFFu, 0xFFFFFEFFu, 0x3F3F3FFFu, 0xFFFFFEFFu,
+0xFCFCFFFFu, 0xFFFFFEFCu, 0xF8F8FFFFu, 0xFFFFFEF8u, 0xF1F1FFFFu, 0xFFFFFEF1u, 0xE3E3FFFFu, 0xFFFFFEE3u,
+0xC7C7FFFFu, 0xFFFFFEC7u, 0x8F8FFFFFu, 0xFFFFFE8Fu, 0x1F1FFFFFu, 0xFFFFFE1Fu, 0x3F3FFFFFu, 0xFFFFFE3Fu,
+0x00000000u, 0x00030000u, 0x00000000u, 0x00030000u, 0x00000000u, 0x02070000u, 0x00000000u, 0x070F0202u,
+0xC7FFFFFFu, 0xFFFFC6C7u, 0x8FFFFFFFu, 0xFFFF8E8Fu, 0x1FFFFFFFu, 0xFFFF1E1Fu, 0x3FFFFFFFu, 0xFFFF3E3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000000u, 0x06020200u,
+0xFFFFFFFFu, 0xFFC7C6C7u, 0xFFFFFFFFu, 0xFF8F8E8Fu, 0xFFFFFFFFu, 0xFF1F1E1Fu, 0xFFFFFFFFu, 0xFF3F3E3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020200u,
+0xFFFFFFFFu, 0xC7C7C6FFu, 0xFFFFFFFFu, 0x8F8F8EFFu, 0xFFFFFFFFu, 0x1F1F1EFFu, 0xFFFFFFFFu, 0x3F3F3EFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020600u,
+0xFFFFFFFFu, 0xC7C7FEFFu, 0xFFFFFFFFu, 0x8F8FFEFFu, 0xFFFFFFFFu, 0x1F1FFEFFu, 0xFFFFFFFFu, 0x3F3FFEFFu,
+0xFFFFFCFCu, 0xFFFFFDFFu, 0xFFFFF8F8u, 0xFFFFFDFFu, 0xFFFFF1F1u, 0xFFFFFDFFu, 0xFFFFE3E3u, 0xFFFFFDFFu,
+0xFFFFC7C7u, 0xFFFFFDFFu, 0xFFFF8F8Fu, 0xFFFFFDFFu, 0xFFFF1F1Fu, 0xFFFFFDFFu, 0xFFFF3F3Fu, 0xFFFFFDFFu,
+0xFFFCFCFCu, 0xFFFFFDFFu, 0xFFF8F8F8u, 0xFFFFFDFFu, 0xFFF1F1F1u, 0xFFFFFDFFu, 0xFFE3E3E3u, 0xFFFFFDFFu,
+0xFFC7C7C7u, 0xFFFFFDFFu, 0xFF8F8F8Fu, 0xFFFFFDFFu, 0xFF1F1F1Fu, 0xFFFFFDFFu, 0xFF3F3F3Fu, 0xFFFFFDFFu,
+0xFCFCFCFFu, 0xFFFFFDFFu, 0xF8F8F8FFu, 0xFFFFFDFFu, 0xF1F1F1FFu, 0xFFFFFDFFu, 0xE3E3E3FFu, 0xFFFFFDFFu,
+0xC7C7C7FFu, 0xFFFFFDFFu, 0x8F8F8FFFu, 0xFFFFFDFFu, 0x1F1F1FFFu, 0xFFFFFDFFu, 0x3F3F3FFFu, 0xFFFFFDFFu,
+0xFCFCFFFFu, 0xFFFFFDFCu, 0xF8F8FFFFu, 0xFFFFFDF8u, 0xF1F1FFFFu, 0xFFFFFDF1u, 0xE3E3FFFFu, 0xFFFFFDE3u,
+0xC7C7FFFFu, 0xFFFFFDC7u, 0x8F8FFFFFu, 0xFFFFFD8Fu, 0x1F1FFFFFu, 0xFFFFFD1Fu, 0x3F3FFFFFu, 0xFFFFFD3Fu,
+0xFCFFFFFFu, 0xFFFFFCFCu, 0xF8FFFFFFu, 0xFFFFF8F8u, 0xF1FFFFFFu, 0xFFFFF1F1u, 0xE3FFFFFFu, 0xFFFFE1E3u,
+0xC7FFFFFFu, 0xFFFFC5C7u, 0x8FFFFFFFu, 0xFFFF8D8Fu, 0x1FFFFFFFu, 0xFFFF1D1Fu, 0x3FFFFFFFu, 0xFFFF3D3Fu,
+0x00000000u, 0x0F0C0C0Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x07010101u, 0x07000000u, 0x0F030103u,
+0xFFFFFFFFu, 0xFFC7C5C7u, 0xFFFFFFFFu, 0xFF8F8D8Fu, 0xFFFFFFFFu, 0xFF1F1D1Fu, 0xFFFFFFFFu, 0xFF3F3D3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x1F000000u, 0x0303011Fu,
+0xFFFFFFFFu, 0xC7C7C5FFu, 0xFFFFFFFFu, 0x8F8F8DFFu, 0xFFFFFFFFu, 0x1F1F1DFFu, 0xFFFFFFFFu, 0x3F3F3DFFu,
+0x00000000u, 0x040C080Fu, 0x00000000u, 0x00000500u, 0x00000000u, 0x0101090Fu, 0x1F000000u, 0x03031D1Fu,
+0xFFFFFFFFu, 0xC7C7FDFFu, 0xFFFFFFFFu, 0x8F8FFDFFu, 0xFFFFFFFFu, 0x1F1FFDFFu, 0xFFFFFFFFu, 0x3F3FFDFFu,
+0xFFFFFCFCu, 0xFFFFFDFFu, 0xFFFFF8F8u, 0xFFFFFDFFu, 0xFFFFF1F1u, 0xFFFFFDFFu, 0xFFFFE3E3u, 0xFFFFFDFFu,
+0xFFFFC7C7u, 0xFFFFFDFFu, 0xFFFF8F8Fu, 0xFFFFFDFFu, 0xFFFF1F1Fu, 0xFFFFFDFFu, 0xFFFF3F3Fu, 0xFFFFFDFFu,
+0xFFFCFCFCu, 0xFFFFFDFFu, 0xFFF8F8F8u, 0xFFFFFDFFu, 0xFFF1F1F1u, 0xFFFFFDFFu, 0xFFE3E3E3u, 0xFFFFFDFFu,
+0xFFC7C7C7u, 0xFFFFFDFFu, 0xFF8F8F8Fu, 0xFFFFFDFFu, 0xFF1F1F1Fu, 0xFFFFFDFFu, 0xFF3F3F3Fu, 0xFFFFFDFFu,
+0xFCFCFCFFu, 0xFFFFFDFFu, 0xF8F8F8FFu, 0xFFFFFDFFu, 0xF1F1F1FFu, 0xFFFFFDFFu, 0xE3E3E3FFu, 0xFFFFFDFFu,
+0xC7C7C7FFu, 0xFFFFFDFFu, 0x8F8F8FFFu, 0xFFFFFDFFu, 0x1F1F1FFFu, 0xFFFFFDFFu, 0x3F3F3FFFu, 0xFFFFFDFFu,
+0xFCFCFFFFu, 0xFFFFFDFCu, 0xF8F8FFFFu, 0xFFFFFDF8u, 0xF1F1FFFFu, 0xFFFFFDF1u, 0xE3E3FFFFu, 0xFFFFFDE3u,
+0xC7C7FFFFu, 0xFFFFFDC7u, 0x8F8FFFFFu, 0xFFFFFD8Fu, 0x1F1FFFFFu, 0xFFFFFD1Fu, 0x3F3FFFFFu, 0xFFFFFD3Fu,
+0x00000000u, 0x00070404u, 0x00000000u, 0x00070000u, 0x00000000u, 0x00070101u, 0x00000000u, 0x070F0103u,
+0x07000000u, 0x0F1F0507u, 0x8FFFFFFFu, 0xFFFF8D8Fu, 0x1FFFFFFFu, 0xFFFF1D1Fu, 0x3FFFFFFFu, 0xFFFF3D3Fu,
+0x00000000u, 0x00040400u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00010100u, 0x00000000u, 0x07030103u,
+0x07000000u, 0x0F070507u, 0xFFFFFFFFu, 0xFF8F8D8Fu, 0xFFFFFFFFu, 0xFF1F1D1Fu, 0xFFFFFFFFu, 0xFF3F3D3Fu,
+0x00000000u, 0x00040000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00010100u, 0x00000000u, 0x0303010Fu,
+0x07000000u, 0x0707051Fu, 0xFFFFFFFFu, 0x8F8F8DFFu, 0xFFFFFFFFu, 0x1F1F1DFFu, 0xFFFFFFFFu, 0x3F3F3DFFu,
+0x00000000u, 0x00000500u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01010500u, 0x00000000u, 0x0303090Fu,
+0x1F000000u, 0x07071D1Fu, 0xFFFFFFFFu, 0x8F8FFDFFu, 0xFFFFFFFFu, 0x1F1FFDFFu, 0xFFFFFFFFu, 0x3F3FFDFFu,
+0xFFFFFCFCu, 0xFFFFFBFFu, 0xFFFFF8F8u, 0xFFFFFBFFu, 0xFFFFF1F1u, 0xFFFFFBFFu, 0xFFFFE3E3u, 0xFFFFFBFFu,
+0xFFFFC7C7u, 0xFFFFFBFFu, 0xFFFF8F8Fu, 0xFFFFFBFFu, 0xFFFF1F1Fu, 0xFFFFFBFFu, 0xFFFF3F3Fu, 0xFFFFFBFFu,
+0xFFFCFCFCu, 0xFFFFFBFFu, 0xFFF8F8F8u, 0xFFFFFBFFu, 0xFFF1F1F1u, 0xFFFFFBFFu, 0xFFE3E3E3u, 0xFFFFFBFFu,
+0xFFC7C7C7u, 0xFFFFFBFFu, 0xFF8F8F8Fu, 0xFFFFFBFFu, 0xFF1F1F1Fu, 0xFFFFFBFFu, 0xFF3F3F3Fu, 0xFFFFFBFFu,
+0xFCFCFCFFu, 0xFFFFFBFFu, 0xF8F8F8FFu, 0xFFFFFBFFu, 0xF1F1F1FFu, 0xFFFFFBFFu, 0xE3E3E3FFu, 0xFFFFFBFFu,
+0xC7C7C7FFu, 0xFFFFFBFFu, 0x8F8F8FFFu, 0xFFFFFBFFu, 0x1F1F1FFFu, 0xFFFFFBFFu, 0x3F3F3FFFu, 0xFFFFFBFFu,
+0xFCFCFFFFu, 0xFFFFFBFCu, 0xF8F8FFFFu, 0xFFFFFBF8u, 0xF1F1FFFFu, 0xFFFFFBF1u, 0xE3E3FFFFu, 0xFFFFFBE3u,
+0xC7C7FFFFu, 0xFFFFFBC7u, 0x8F8FFFFFu, 0xFFFFFB8Fu, 0x1F1FFFFFu, 0xFFFFFB1Fu, 0x3F3FFFFFu, 0xFFFFFB3Fu,
+0xFCFFFFFFu, 0xFFFFF8FCu, 0xF8FFFFFFu, 0xFFFFF8F8u, 0xF1FFFFFFu, 0xFFFFF1F1u, 0xE3FFFFFFu, 0xFFFFE3E3u,
+0xC7FFFFFFu, 0xFFFFC3C7u, 0x8FFFFFFFu, 0xFFFF8B8Fu, 0x1FFFFFFFu, 0xFFFF1B1Fu, 0x3FFFFFFFu, 0xFFFF3B3Fu,
+0x3E000000u, 0x3F3C383Cu, 0x00000000u, 0x1E181818u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0F030303u,
+0x0F000000u, 0x1F070307u, 0xFFFFFFFFu, 0xFF8F8B8Fu, 0xFFFFFFFFu, 0xFF1F1B1Fu, 0xFFFFFFFFu, 0xFF3F3B3Fu,
+0x3F000000u, 0x3C3C383Fu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x3F000000u, 0x0707033Fu, 0xFFFFFFFFu, 0x8F8F8BFFu, 0xFFFFFFFFu, 0x1F1F1BFFu, 0xFFFFFFFFu, 0x3F3F3BFFu,
+0x3F000000u, 0x3C3C3B3Fu, 0x00000000u, 0x1818191Fu, 0x00000000u, 0x00000A00u, 0x00000000u, 0x0303131Fu,
+0x3F000000u, 0x07073B3Fu, 0xFFFFFFFFu, 0x8F8FFBFFu, 0xFFFFFFFFu, 0x1F1FFBFFu, 0xFFFFFFFFu, 0x3F3FFBFFu,
+0xFFFFFCFCu, 0xFFFFFBFFu, 0xFFFFF8F8u, 0xFFFFFBFFu, 0xFFFFF1F1u, 0xFFFFFBFFu, 0xFFFFE3E3u, 0xFFFFFBFFu,
+0xFFFFC7C7u, 0xFFFFFBFFu, 0xFFFF8F8Fu, 0xFFFFFBFFu, 0xFFFF1F1Fu, 0xFFFFFBFFu, 0xFFFF3F3Fu, 0xFFFFFBFFu,
+0xFFFCFCFCu, 0xFFFFFBFFu, 0xFFF8F8F8u, 0xFFFFFBFFu, 0xFFF1F1F1u, 0xFFFFFBFFu, 0xFFE3E3E3u, 0xFFFFFBFFu,
+0xFFC7C7C7u, 0xFFFFFBFFu, 0xFF8F8F8Fu, 0xFFFFFBFFu, 0xFF1F1F1Fu, 0xFFFFFBFFu, 0xFF3F3F3Fu, 0xFFFFFBFFu,
+0xFCFCFCFFu, 0xFFFFFBFFu, 0xF8F8F8FFu, 0xFFFFFBFFu, 0xF1F1F1FFu, 0xFFFFFBFFu, 0xE3E3E3FFu, 0xFFFFFBFFu,
+0xC7C7C7FFu, 0xFFFFFBFFu, 0x8F8F8FFFu, 0xFFFFFBFFu, 0x1F1F1FFFu, 0xFFFFFBFFu, 0x3F3F3FFFu, 0xFFFFFBFFu,
+0xFCFCFFFFu, 0xFFFFFBFCu, 0xF8F8FFFFu, 0xFFFFFBF8u, 0xF1F1FFFFu, 0xFFFFFBF1u, 0xE3E3FFFFu, 0xFFFFFBE3u,
+0xC7C7FFFFu, 0xFFFFFBC7u, 0x8F8FFFFFu, 0xFFFFFB8Fu, 0x1F1FFFFFu, 0xFFFFFB1Fu, 0x3F3FFFFFu, 0xFFFFFB3Fu,
+0x00000000u, 0x1E1F181Cu, 0x00000000u, 0x000E0808u, 0x00000000u, 0x000E0000u, 0x00000000u, 0x000E0202u,
+0x00000000u, 0x0F1F0307u, 0x0F000000u, 0x1F3F0B0Fu, 0x1FFFFFFFu, 0xFFFF1B1Fu, 0x3FFFFFFFu, 0xFFFF3B3Fu,
+0x00000000u, 0x1E1C181Cu, 0x00000000u, 0x00080800u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+0x00000000u, 0x0F070307u, 0x0F000000u, 0x1F0F0B0Fu, 0xFFFFFFFFu, 0xFF1F1B1Fu, 0xFFFFFFFFu, 0xFF3F3B3Fu,
+0x00000000u, 0x1C1C181Fu, 0x00000000u, 0x00080800u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+0x00000000u, 0x0707031Fu, 0x0F000000u, 0x0F0F0B3Fu, 0xFFFFFFFFu, 0x1F1F1BFFu, 0xFFFFFFFFu, 0x3F3F3BFFu,
+0x00000000u, 0x1C1C191Fu, 0x00000000u, 0x08080A00u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020A00u,
+0x00000000u, 0x0707131Fu, 0x3F000000u, 0x0F0F3B3Fu, 0xFFFFFFFFu, 0x1F1FFBFFu, 0xFFFFFFFFu, 0x3F3FFBFFu,
+0xFFFFFCFCu, 0xFFFFF7FFu, 0xFFFFF8F8u, 0xFFFFF7FFu, 0xFFFFF1F1u, 0xFFFFF7FFu, 0xFFFFE3E3u, 0xFFFFF7FFu,
+0xFFFFC7C7u, 0xFFFFF7FFu, 0xFFFF8F8Fu, 0xFFFFF7FFu, 0xFFFF1F1Fu, 0xFFFFF7FFu, 0xFFFF3F3Fu, 0xFFFFF7FFu,
+0xFFFCFCFCu, 0xFFFFF7FFu, 0xFFF8F8F8u, 0xFFFFF7FFu, 0xFFF1F1F1u, 0xFFFFF7FFu, 0xFFE3E3E3u, 0xFFFFF7FFu,
+0xFFC7C7C7u, 0xFFFFF7FFu, 0xFF8F8F8Fu, 0xFFFFF7FFu, 0xFF1F1F1Fu, 0xFFFFF7FFu, 0xFF3F3F3Fu, 0xFFFFF7FFu,
+0xFCFCFCFFu, 0xFFFFF7FFu, 0xF8F8F8FFu, 0xFFFFF7FFu, 0xF1F1F1FFu, 0xFFFFF7FFu, 0xE3E3E3FFu, 0xFFFFF7FFu,
+0xC7C7C7FFu, 0xFFFFF7FFu, 0x8F8F8FFFu, 0xFFFFF7FFu, 0x1F1F1FFFu, 0xFFFFF7FFu, 0x3F3F3FFFu, 0xFFFFF7FFu,
+0xFCFCFFFFu, 0xFFFFF7FCu, 0xF8F8FFFFu, 0xFFFFF7F8u, 0xF1F1FFFFu, 0xFFFFF7F1u, 0xE3E3FFFFu, 0xFFFFF7E3u,
+0xC7C7FFFFu, 0xFFFFF7C7u, 0x8F8FFFFFu, 0xFFFFF78Fu, 0x1F1FFFFFu, 0xFFFFF71Fu, 0x3F3FFFFFu, 0xFFFFF73Fu,
+0xFCFFFFFFu, 0xFFFFF4FCu, 0xF8FFFFFFu, 0xFFFFF0F8u, 0xF1FFFFFFu, 0xFFFFF1F1u, 0xE3FFFFFFu, 0xFFFFE3E3u,
+0xC7FFFFFFu, 0xFFFFC7C7u, 0x8FFFFFFFu, 0xFFFF878Fu, 0x1FFFFFFFu, 0xFFFF171Fu, 0x3FFFFFFFu, 0xFFFF373Fu,
+0xFFFFFFFFu, 0xFFFCF4FCu, 0x7C000000u, 0x7E787078u, 0x00000000u, 0x3C303030u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x1E060606u, 0x1F000000u, 0x3F0F070Fu, 0xFFFFFFFFu, 0xFF1F171Fu, 0xFFFFFFFFu, 0xFF3F373Fu,
+0xFFFFFFFFu, 0xFCFCF4FFu, 0x7F000000u, 0x7878707Fu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000000u, 0x7F000000u, 0x0F0F077Fu, 0xFFFFFFFFu, 0x1F1F17FFu, 0xFFFFFFFFu, 0x3F3F37FFu,
+0xFFFFFFFFu, 0xFCFCF7FFu, 0x7F000000u, 0x7878777Fu, 0x00000000u, 0x3030323Eu, 0x00000000u, 0x00001400u,
+0x00000000u, 0x0606263Eu, 0x7F000000u, 0x0F0F777Fu, 0xFFFFFFFFu, 0x1F1FF7FFu, 0xFFFFFFFFu, 0x3F3FF7FFu,
+0xFFFFFCFCu, 0xFFFFF7FFu, 0xFFFFF8F8u, 0xFFFFF7FFu, 0xFFFFF1F1u, 0xFFFFF7FFu, 0xFFFFE3E3u, 0xFFFFF7FFu,
+0xFFFFC7C7u, 0xFFFFF7FFu, 0xFFFF8F8Fu, 0xFFFFF7FFu, 0xFFFF1F1Fu, 0xFFFFF7FFu, 0xFFFF3F3Fu, 0xFFFFF7FFu,
+0xFFFCFCFCu, 0xFFFFF7FFu, 0xFFF8F8F8u, 0xFFFFF7FFu, 0xFFF1F1F1u, 0xFFFFF7FFu, 0xFFE3E3E3u, 0xFFFFF7FFu,
+0xFFC7C7C7u, 0xFFFFF7FFu, 0xFF8F8F8Fu, 0xFFFFF7FFu, 0xFF1F1F1Fu, 0xFFFFF7FFu, 0xFF3F3F3Fu, 0xFFFFF7FFu,
+0xFCFCFCFFu, 0xFFFFF7FFu, 0xF8F8F8FFu, 0xFFFFF7FFu, 0xF1F1F1FFu, 0xFFFFF7FFu, 0xE3E3E3FFu, 0xFFFFF7FFu,
+0xC7C7C7FFu, 0xFFFFF7FFu, 0x8F8F8FFFu, 0xFFFFF7FFu, 0x1F1F1FFFu, 0xFFFFF7FFu, 0x3F3F3FFFu, 0xFFFFF7FFu,
+0xFCFCFFFFu, 0xFFFFF7FCu, 0xF8F8FFFFu, 0xFFFFF7F8u, 0xF1F1FFFFu, 0xFFFFF7F1u, 0xE3E3FFFFu, 0xFFFFF7E3u,
+0xC7C7FFFFu, 0xFFFFF7C7u, 0x8F8FFFFFu, 0xFFFFF78Fu, 0x1F1FFFFFu, 0xFFFFF71Fu, 0x3F3FFFFFu, 0xFFFFF73Fu,
+0x7C000000u, 0x7E7F747Cu, 0x00000000u, 0x3C3E3038u, 0x00000000u, 0x001C1010u, 0x00000000u, 0x001C0000u,
+0x00000000u, 0x001C0404u, 0x00000000u, 0x1E3E060Eu, 0x1F000000u, 0x3F7F171Fu, 0x3FFFFFFFu, 0xFFFF373Fu,
+0x7C000000u, 0x7E7C747Cu, 0x00000000u, 0x3C383038u, 0x00000000u, 0x00101000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00040400u, 0x00000000u, 0x1E0E060Eu, 0x1F000000u, 0x3F1F171Fu, 0xFFFFFFFFu, 0xFF3F373Fu,
+0x7C000000u, 0x7C7C747Fu, 0x00000000u, 0x3838303Eu, 0x00000000u, 0x00101000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00040400u, 0x00000000u, 0x0E0E063Eu, 0x1F000000u, 0x1F1F177Fu, 0xFFFFFFFFu, 0x3F3F37FFu,
+0x7F000000u, 0x7C7C777Fu, 0x00000000u, 0x3838323Eu, 0x00000000u, 0x10101400u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x04041400u, 0x00000000u, 0x0E0E263Eu, 0x7F000000u, 0x1F1F777Fu, 0xFFFFFFFFu, 0x3F3FF7FFu,
+0xFFFFFCFCu, 0xFFFFFFFEu, 0xFFFFF8F8u, 0xFFFFFFFEu, 0xFFFFF1F1u, 0xFFFFFFFEu, 0xFFFFE3E3u, 0xFFFFFFFEu,
+0xFFFFC7C7u, 0xFFFFFFFEu, 0xFFFF8F8Fu, 0xFFFFFFFEu, 0xFFFF1F1Fu, 0xFFFFFFFEu, 0xFFFF3F3Fu, 0xFFFFFFFEu,
+0xFFFCFCFCu, 0xFFFFFFFEu, 0xFFF8F8F8u, 0xFFFFFFFEu, 0xFFF1F1F1u, 0xFFFFFFFEu, 0xFFE3E3E3u, 0xFFFFFFFEu,
+0xFFC7C7C7u, 0xFFFFFFFEu, 0xFF8F8F8Fu, 0xFFFFFFFEu, 0xFF1F1F1Fu, 0xFFFFFFFEu, 0xFF3F3F3Fu, 0xFFFFFFFEu,
+0xFCFCFCFFu, 0xFFFFFFFEu, 0xF8F8F8FFu, 0xFFFFFFFEu, 0xF1F1F1FFu, 0xFFFFFFFEu, 0xE3E3E3FFu, 0xFFFFFFFEu,
+0xC7C7C7FFu, 0xFFFFFFFEu, 0x8F8F8FFFu, 0xFFFFFFFEu, 0x1F1F1FFFu, 0xFFFFFFFEu, 0x3F3F3FFFu, 0xFFFFFFFEu,
+0xFCFCFFFFu, 0xFFFFFFFCu, 0xF8F8FFFFu, 0xFFFFFFF8u, 0xF1F1FFFFu, 0xFFFFFFF0u, 0xE3E3FFFFu, 0xFFFFFFE2u,
+0xC7C7FFFFu, 0xFFFFFFC6u, 0x8F8FFFFFu, 0xFFFFFF8Eu, 0x1F1FFFFFu, 0xFFFFFF1Eu, 0x3F3FFFFFu, 0xFFFFFF3Eu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00030000u, 0x00000000u, 0x07070100u, 0x03000000u, 0x0F0F0302u,
+0xC7FFFFFFu, 0xFFFFC7C6u, 0x8FFFFFFFu, 0xFFFF8F8Eu, 0x1FFFFFFFu, 0xFFFF1F1Eu, 0x3FFFFFFFu, 0xFFFF3F3Eu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000000u, 0x07030302u,
+0xFFFFFFFFu, 0xFFC7C7C6u, 0xFFFFFFFFu, 0xFF8F8F8Eu, 0xFFFFFFFFu, 0xFF1F1F1Eu, 0xFFFFFFFFu, 0xFF3F3F3Eu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+0xFFFFFFFFu, 0xC7C7C7FEu, 0xFFFFFFFFu, 0x8F8F8FFEu, 0xFFFFFFFFu, 0x1F1F1FFEu, 0xFFFFFFFFu, 0x3F3F3FFEu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+0xFFFFFFFFu, 0xC7C7FFFEu, 0xFFFFFFFFu, 0x8F8FFFFEu, 0xFFFFFFFFu, 0x1F1FFFFEu, 0xFFFFFFFFu, 0x3F3FFFFEu,
+0xFFFFFCFCu, 0xFFFFFFFEu, 0xFFFFF8F8u, 0xFFFFFFFEu, 0xFFFFF1F1u, 0xFFFFFFFEu, 0xFFFFE3E3u, 0xFFFFFFFEu,
+0xFFFFC7C7u, 0xFFFFFFFEu, 0xFFFF8F8Fu, 0xFFFFFFFEu, 0xFFFF1F1Fu, 0xFFFFFFFEu, 0xFFFF3F3Fu, 0xFFFFFFFEu,
+0xFFFCFCFCu, 0xFFFFFFFEu, 0xFFF8F8F8u, 0xFFFFFFFEu, 0xFFF1F1F1u, 0xFFFFFFFEu, 0xFFE3E3E3u, 0xFFFFFFFEu,
+0xFFC7C7C7u, 0xFFFFFFFEu, 0xFF8F8F8Fu, 0xFFFFFFFEu, 0xFF1F1F1Fu, 0xFFFFFFFEu, 0xFF3F3F3Fu, 0xFFFFFFFEu,
+0xFCFCFCFFu, 0xFFFFFFFEu, 0xF8F8F8FFu, 0xFFFFFFFEu, 0xF1F1F1FFu, 0xFFFFFFFEu, 0xE3E3E3FFu, 0xFFFFFFFEu,
+0xC7C7C7FFu, 0xFFFFFFFEu, 0x8F8F8FFFu, 0xFFFFFFFEu, 0x1F1F1FFFu, 0xFFFFFFFEu, 0x3F3F3FFFu, 0xFFFFFFFEu,
+0x00000000u, 0x00000300u, 0x00000000u, 0x00000300u, 0x00000000u, 0x00030700u, 0x02000000u, 0x07070F02u,
+0x07000000u, 0x0F0F1F06u, 0x8F8FFFFFu, 0xFFFFFF8Eu, 0x1F1FFFFFu, 0xFFFFFF1Eu, 0x3F3FFFFFu, 0xFFFFFF3Eu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u, 0x00000000u, 0x02060202u,
+0x00000000u, 0x070F0706u, 0x8FFFFFFFu, 0xFFFF8F8Eu, 0x1FFFFFFFu, 0xFFFF1F1Eu, 0x3FFFFFFFu, 0xFFFF3F3Eu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020200u,
+0x00000000u, 0x07070700u, 0xFFFFFFFFu, 0xFF8F8F8Eu, 0xFFFFFFFFu, 0xFF1F1F1Eu, 0xFFFFFFFFu, 0xFF3F3F3Eu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+0x00000000u, 0x07070700u, 0xFFFFFFFFu, 0x8F8F8FFEu, 0xFFFFFFFFu, 0x1F1F1FFEu, 0xFFFFFFFFu, 0x3F3F3FFEu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+0x00000000u, 0x07070700u, 0xFFFFFFFFu, 0x8F8FFFFEu, 0xFFFFFFFFu, 0x1F1FFFFEu, 0xFFFFFFFFu, 0x3F3FFFFEu,
+0xFFFFFCFCu, 0xFFFFFFFDu, 0xFFFFF8F8u, 0xFFFFFFFDu, 0xFFFFF1F1u, 0xFFFFFFFDu, 0xFFFFE3E3u, 0xFFFFFFFDu,
+0xFFFFC7C7u, 0xFFFFFFFDu, 0xFFFF8F8Fu, 0xFFFFFFFDu, 0xFFFF1F1Fu, 0xFFFFFFFDu, 0xFFFF3F3Fu, 0xFFFFFFFDu,
+0xFFFCFCFCu, 0xFFFFFFFDu, 0xFFF8F8F8u, 0xFFFFFFFDu, 0xFFF1F1F1u, 0xFFFFFFFDu, 0xFFE3E3E3u, 0xFFFFFFFDu,
+0xFFC7C7C7u, 0xFFFFFFFDu, 0xFF8F8F8Fu, 0xFFFFFFFDu, 0xFF1F1F1Fu, 0xFFFFFFFDu, 0xFF3F3F3Fu, 0xFFFFFFFDu,
+0xFCFCFCFFu, 0xFFFFFFFDu, 0xF8F8F8FFu, 0xFFFFFFFDu, 0xF1F1F1FFu, 0xFFFFFFFDu, 0xE3E3E3FFu, 0xFFFFFFFDu,
+0xC7C7C7FFu, 0xFFFFFFFDu, 0x8F8F8FFFu, 0xFFFFFFFDu, 0x1F1F1FFFu, 0xFFFFFFFDu, 0x3F3F3FFFu, 0xFFFFFFFDu,
+0xFCFCFFFFu, 0xFFFFFFFCu, 0xF8F8FFFFu, 0xFFFFFFF8u, 0xF1F1FFFFu, 0xFFFFFFF1u, 0xE3E3FFFFu, 0xFFFFFFE1u,
+0xC7C7FFFFu, 0xFFFFFFC5u, 0x8F8FFFFFu, 0xFFFFFF8Du, 0x1F1FFFFFu, 0xFFFFFF1Du, 0x3F3FFFFFu, 0xFFFFFF3Du,
+0x0C000000u, 0x000F0C0Cu, 0x00000000u, 0x00000000u, 0x01000000u, 0x00070101u, 0x03070000u, 0x0F0F0301u,
+0x07070000u, 0x1F1F0705u, 0x8FFFFFFFu, 0xFFFF8F8Du, 0x1FFFFFFFu, 0xFFFF1F1Du, 0x3FFFFFFFu, 0xFFFF3F3Du,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03000000u, 0x07030301u,
+0x0F070000u, 0x0F070705u, 0xFFFFFFFFu, 0xFF8F8F8Du, 0xFFFFFFFFu, 0xFF1F1F1Du, 0xFFFFFFFFu, 0xFF3F3F3Du,
+0x00000000u, 0x0C0C0C0Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x01010101u, 0x03000000u, 0x0303030Du,
+0x1F070000u, 0x0707071Du, 0xFFFFFFFFu, 0x8F8F8FFDu, 0xFFFFFFFFu, 0x1F1F1FFDu, 0xFFFFFFFFu, 0x3F3F3FFDu,
+0x00000000u, 0x0C0C0F0Du, 0x00000000u, 0x00080F0Du, 0x00000000u, 0x01010F0Du, 0x03000000u, 0x03031F1Du,
+0x1F070000u, 0x07073F3Du, 0xFFFFFFFFu, 0x8F8FFFFDu, 0xFFFFFFFFu, 0x1F1FFFFDu, 0xFFFFFFFFu, 0x3F3FFFFDu,
+0xFFFFFCFCu, 0xFFFFFFFDu, 0xFFFFF8F8u, 0xFFFFFFFDu, 0xFFFFF1F1u, 0xFFFFFFFDu, 0xFFFFE3E3u, 0xFFFFFFFDu,
+0xFFFFC7C7u, 0xFFFFFFFDu, 0xFFFF8F8Fu, 0xFFFFFFFDu, 0xFFFF1F1Fu, 0xFFFFFFFDu, 0xFFFF3F3Fu, 0xFFFFFFFDu,
+0xFFFCFCFCu, 0xFFFFFFFDu, 0xFFF8F8F8u, 0xFFFFFFFDu, 0xFFF1F1F1u, 0xFFFFFFFDu, 0xFFE3E3E3u, 0xFFFFFFFDu,
+0xFFC7C7C7u, 0xFFFFFFFDu, 0xFF8F8F8Fu, 0xFFFFFFFDu, 0xFF1F1F1Fu, 0xFFFFFFFDu, 0xFF3F3F3Fu, 0xFFFFFFFDu,
+0xFCFCFCFFu, 0xFFFFFFFDu, 0xF8F8F8FFu, 0xFFFFFFFDu, 0xF1F1F1FFu, 0xFFFFFFFDu, 0xE3E3E3FFu, 0xFFFFFFFDu,
+0xC7C7C7FFu, 0xFFFFFFFDu, 0x8F8F8FFFu, 0xFFFFFFFDu, 0x1F1F1FFFu, 0xFFFFFFFDu, 0x3F3F3FFFu, 0xFFFFFFFDu,
+0x04000000u, 0x00000704u, 0x00000000u, 0x00000700u, 0x01000000u, 0x00000701u, 0x03000000u, 0x00070F01u,
+0x07070000u, 0x0F0F1F05u, 0x0F070000u, 0x1F1F3F0Du, 0x1F1FFFFFu, 0xFFFFFF1Du, 0x3F3FFFFFu, 0xFFFFFF3Du,
+0x00000000u, 0x00000404u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000101u, 0x03000000u, 0x00070301u,
+0x03000000u, 0x070F0705u, 0x0F070000u, 0x0F1F0F0Du, 0x1FFFFFFFu, 0xFFFF1F1Du, 0x3FFFFFFFu, 0xFFFF3F3Du,
+0x00000000u, 0x00000400u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000100u, 0x00000000u, 0x00030301u,
+0x03000000u, 0x07070705u, 0x0F070000u, 0x0F0F0F0Du, 0xFFFFFFFFu, 0xFF1F1F1Du, 0xFFFFFFFFu, 0xFF3F3F3Du,
+0x00000000u, 0x00040400u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00010100u, 0x00000000u, 0x03030301u,
+0x03000000u, 0x0707070Du, 0x0F070000u, 0x0F0F0F1Du, 0xFFFFFFFFu, 0x1F1F1FFDu, 0xFFFFFFFFu, 0x3F3F3FFDu,
+0x00000000u, 0x04040700u, 0x00000000u, 0x00000700u, 0x00000000u, 0x01010700u, 0x00000000u, 0x03030F01u,
+0x03000000u, 0x07071F0Du, 0x1F070000u, 0x0F0F3F1Du, 0xFFFFFFFFu, 0x1F1FFFFDu, 0xFFFFFFFFu, 0x3F3FFFFDu,
+0xFFFFFCFCu, 0xFFFFFFFBu, 0xFFFFF8F8u, 0xFFFFFFFBu, 0xFFFFF1F1u, 0xFFFFFFFBu, 0xFFFFE3E3u, 0xFFFFFFFBu,
+0xFFFFC7C7u, 0xFFFFFFFBu, 0xFFFF8F8Fu, 0xFFFFFFFBu, 0xFFFF1F1Fu, 0xFFFFFFFBu, 0xFFFF3F3Fu, 0xFFFFFFFBu,
+0xFFFCFCFCu, 0xFFFFFFFBu, 0xFFF8F8F8u, 0xFFFFFFFBu, 0xFFF1F1F1u, 0xFFFFFFFBu, 0xFFE3E3E3u, 0xFFFFFFFBu,
+0xFFC7C7C7u, 0xFFFFFFFBu, 0xFF8F8F8Fu, 0xFFFFFFFBu, 0xFF1F1F1Fu, 0xFFFFFFFBu, 0xFF3F3F3Fu, 0xFFFFFFFBu,
+0xFCFCFCFFu, 0xFFFFFFFBu, 0xF8F8F8FFu, 0xFFFFFFFBu, 0xF1F1F1FFu, 0xFFFFFFFBu, 0xE3E3E3FFu, 0xFFFFFFFBu,
+0xC7C7C7FFu, 0xFFFFFFFBu, 0x8F8F8FFFu, 0xFFFFFFFBu, 0x1F1F1FFFu, 0xFFFFFFFBu, 0x3F3F3FFFu, 0xFFFFFFFBu,
+0xFCFCFFFFu, 0xFFFFFFF8u, 0xF8F8FFFFu, 0xFFFFFFF8u, 0xF1F1FFFFu, 0xFFFFFFF1u, 0xE3E3FFFFu, 0xFFFFFFE3u,
+0xC7C7FFFFu, 0xFFFFFFC3u, 0x8F8FFFFFu, 0xFFFFFF8Bu, 0x1F1FFFFFu, 0xFFFFFF1Bu, 0x3F3FFFFFu, 0xFFFFFF3Bu,
+0x3C3E0000u, 0x3F3F3C38u, 0x18000000u, 0x001E1818u, 0x00000000u, 0x00000000u, 0x03000000u, 0x000F0303u,
+0x070F0000u, 0x1F1F0703u, 0x0F0F0000u, 0x3F3F0F0Bu, 0x1FFFFFFFu, 0xFFFF1F1Bu, 0x3FFFFFFFu, 0xFFFF3F3Bu,
+0x3C000000u, 0x3E3C3C38u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x07000000u, 0x0F070703u, 0x1F0F0000u, 0x1F0F0F0Bu, 0xFFFFFFFFu, 0xFF1F1F1Bu, 0xFFFFFFFFu, 0xFF3F3F3Bu,
+0x3C000000u, 0x3C3C3C3Bu, 0x00000000u, 0x18181818u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030303u,
+0x07000000u, 0x0707071Bu, 0x3F0F0000u, 0x0F0F0F3Bu, 0xFFFFFFFFu, 0x1F1F1FFBu, 0xFFFFFFFFu, 0x3F3F3FFBu,
+0x3C000000u, 0x3C3C3F3Bu, 0x00000000u, 0x18181F1Bu, 0x00000000u, 0x00111F1Bu, 0x00000000u, 0x03031F1Bu,
+0x07000000u, 0x07073F3Bu, 0x3F0F0000u, 0x0F0F7F7Bu, 0xFFFFFFFFu, 0x1F1FFFFBu, 0xFFFFFFFFu, 0x3F3FFFFBu,
+0xFFFFFCFCu, 0xFFFFFFFBu, 0xFFFFF8F8u, 0xFFFFFFFBu, 0xFFFFF1F1u, 0xFFFFFFFBu, 0xFFFFE3E3u, 0xFFFFFFFBu,
+0xFFFFC7C7u, 0xFFFFFFFBu, 0xFFFF8F8Fu, 0xFFFFFFFBu, 0xFFFF1F1Fu, 0xFFFFFFFBu, 0xFFFF3F3Fu, 0xFFFFFFFBu,
+0xFFFCFCFCu, 0xFFFFFFFBu, 0xFFF8F8F8u, 0xFFFFFFFBu, 0xFFF1F1F1u, 0xFFFFFFFBu, 0xFFE3E3E3u, 0xFFFFFFFBu,
+0xFFC7C7C7u, 0xFFFFFFFBu, 0xFF8F8F8Fu, 0xFFFFFFFBu, 0xFF1F1F1Fu, 0xFFFFFFFBu, 0xFF3F3F3Fu, 0xFFFFFFFBu,
+0xFCFCFCFFu, 0xFFFFFFFBu, 0xF8F8F8FFu, 0xFFFFFFFBu, 0xF1F1F1FFu, 0xFFFFFFFBu, 0xE3E3E3FFu, 0xFFFFFFFBu,
+0xC7C7C7FFu, 0xFFFFFFFBu, 0x8F8F8FFFu, 0xFFFFFFFBu, 0x1F1F1FFFu, 0xFFFFFFFBu, 0x3F3F3FFFu, 0xFFFFFFFBu,
+0x1C000000u, 0x001E1F18u, 0x08000000u, 0x00000E08u, 0x00000000u, 0x00000E00u, 0x02000000u, 0x00000E02u,
+0x07000000u, 0x000F1F03u, 0x0F0F0000u, 0x1F1F3F0Bu, 0x1F0F0000u, 0x3F3F7F1Bu, 0x3F3FFFFFu, 0xFFFFFF3Bu,
+0x1C000000u, 0x001E1C18u, 0x00000000u, 0x00000808u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+0x07000000u, 0x000F0703u, 0x07000000u, 0x0F1F0F0Bu, 0x1F0F0000u, 0x1F3F1F1Bu, 0x3FFFFFFFu, 0xFFFF3F3Bu,
+0x00000000u, 0x001C1C18u, 0x00000000u, 0x00000800u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u,
+0x00000000u, 0x00070703u, 0x07000000u, 0x0F0F0F0Bu, 0x1F0F0000u, 0x1F1F1F1Bu, 0xFFFFFFFFu, 0xFF3F3F3Bu,
+0x00000000u, 0x1C1C1C18u, 0x00000000u, 0x00080800u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+0x00000000u, 0x07070703u, 0x07000000u, 0x0F0F0F1Bu, 0x1F0F0000u, 0x1F1F1F3Bu, 0xFFFFFFFFu, 0x3F3F3FFBu,
+0x00000000u, 0x1C1C1F18u, 0x00000000u, 0x08080E00u, 0x00000000u, 0x00000E00u, 0x00000000u, 0x02020E00u,
+0x00000000u, 0x07071F03u, 0x07000000u, 0x0F0F3F1Bu, 0x3F0F0000u, 0x1F1F7F3Bu, 0xFFFFFFFFu, 0x3F3FFFFBu,
+0xFFFFFCFCu, 0xFFFFFFF7u, 0xFFFFF8F8u, 0xFFFFFFF7u, 0xFFFFF1F1u, 0xFFFFFFF7u, 0xFFFFE3E3u, 0xFFFFFFF7u,
+0xFFFFC7C7u, 0xFFFFFFF7u, 0xFFFF8F8Fu, 0xFFFFFFF7u, 0xFFFF1F1Fu, 0xFFFFFFF7u, 0xFFFF3F3Fu, 0xFFFFFFF7u,
+0xFFFCFCFCu, 0xFFFFFFF7u, 0xFFF8F8F8u, 0xFFFFFFF7u, 0xFFF1F1F1u, 0xFFFFFFF7u, 0xFFE3E3E3u, 0xFFFFFFF7u,
+0xFFC7C7C7u, 0xFFFFFFF7u, 0xFF8F8F8Fu, 0xFFFFFFF7u, 0xFF1F1F1Fu, 0xFFFFFFF7u, 0xFF3F3F3Fu, 0xFFFFFFF7u,
+0xFCFCFCFFu, 0xFFFFFFF7u, 0xF8F8F8FFu, 0xFFFFFFF7u, 0xF1F1F1FFu, 0xFFFFFFF7u, 0xE3E3E3FFu, 0xFFFFFFF7u,
+0xC7C7C7FFu, 0xFFFFFFF7u, 0x8F8F8FFFu, 0xFFFFFFF7u, 0x1F1F1FFFu, 0xFFFFFFF7u, 0x3F3F3FFFu, 0xFFFFFFF7u,
+0xFCFCFFFFu, 0xFFFFFFF4u, 0xF8F8FFFFu, 0xFFFFFFF0u, 0xF1F1FFFFu, 0xFFFFFFF1u, 0xE3E3FFFFu, 0xFFFFFFE3u,
+0xC7C7FFFFu, 0xFFFFFFC7u, 0x8F8FFFFFu, 0xFFFFFF87u, 0x1F1FFFFFu, 0xFFFFFF17u, 0x3F3FFFFFu, 0xFFFFFF37u,
+0xFCFC0000u, 0xFFFFFCF4u, 0x787C0000u, 0x7E7E7870u, 0x30000000u, 0x003C3030u, 0x00000000u, 0x00000000u,
+0x06000000u, 0x001E0606u, 0x0F1F0000u, 0x3F3F0F07u, 0x1F1F0000u, 0x7F7F1F17u, 0x3FFFFFFFu, 0xFFFF3F37u,
+0xFEFC0000u, 0xFEFCFCF4u, 0x78000000u, 0x7C787870u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000000u, 0x0F000000u, 0x1F0F0F07u, 0x3F1F0000u, 0x3F1F1F17u, 0xFFFFFFFFu, 0xFF3F3F37u,
+0xFFFC0000u, 0xFCFCFCF7u, 0x78000000u, 0x78787876u, 0x00000000u, 0x30303030u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x06060606u, 0x0F000000u, 0x0F0F0F37u, 0x7F1F0000u, 0x1F1F1F77u, 0xFFFFFFFFu, 0x3F3F3FF7u,
+0xFFFC0000u, 0xFCFCFFF7u, 0x78000000u, 0x78787F77u, 0x00000000u, 0x30303E36u, 0x00000000u, 0x00223E36u,
+0x00000000u, 0x06063E36u, 0x0F000000u, 0x0F0F7F77u, 0x7F1F0000u, 0x1F1FFFF7u, 0xFFFFFFFFu, 0x3F3FFFF7u,
+0xFFFFFCFCu, 0xFFFFFFF7u, 0xFFFFF8F8u, 0xFFFFFFF7u, 0xFFFFF1F1u, 0xFFFFFFF7u, 0xFFFFE3E3u, 0xFFFFFFF7u,
+0xFFFFC7C7u, 0xFFFFFFF7u, 0xFFFF8F8Fu, 0xFFFFFFF7u, 0xFFFF1F1Fu, 0xFFFFFFF7u, 0xFFFF3F3Fu, 0xFFFFFFF7u,
+0xFFFCFCFCu, 0xFFFFFFF7u, 0xFFF8F8F8u, 0xFFFFFFF7u, 0xFFF1F1F1u, 0xFFFFFFF7u, 0xFFE3E3E3u, 0xFFFFFFF7u,
+0xFFC7C7C7u, 0xFFFFFFF7u, 0xFF8F8F8Fu, 0xFFFFFFF7u, 0xFF1F1F1Fu, 0xFFFFFFF7u, 0xFF3F3F3Fu, 0xFFFFFFF7u,
+0xFCFCFCFFu, 0xFFFFFFF7u, 0xF8F8F8FFu, 0xFFFFFFF7u, 0xF1F1F1FFu, 0xFFFFFFF7u, 0xE3E3E3FFu, 0xFFFFFFF7u,
+0xC7C7C7FFu, 0xFFFFFFF7u, 0x8F8F8FFFu, 0xFFFFFFF7u, 0x1F1F1FFFu, 0xFFFFFFF7u, 0x3F3F3FFFu, 0xFFFFFFF7u,
+0x7C7C0000u, 0x7E7E7F74u, 0x38000000u, 0x003C3E30u, 0x10000000u, 0x00001C10u, 0x00000000u, 0x00001C00u,
+0x04000000u, 0x00001C04u, 0x0E000000u, 0x001E3E06u, 0x1F1F0000u, 0x3F3F7F17u, 0x3F1F0000u, 0x7F7FFF37u,
+0x78000000u, 0x7C7E7C74u, 0x38000000u, 0x003C3830u, 0x00000000u, 0x00001010u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000404u, 0x0E000000u, 0x001E0E06u, 0x0F000000u, 0x1F3F1F17u, 0x3F1F0000u, 0x3F7F3F37u,
+0x78000000u, 0x7C7C7C74u, 0x00000000u, 0x00383830u, 0x00000000u, 0x00001000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000400u, 0x00000000u, 0x000E0E06u, 0x0F000000u, 0x1F1F1F17u, 0x3F1F0000u, 0x3F3F3F37u,
+0x78000000u, 0x7C7C7C76u, 0x00000000u, 0x38383830u, 0x00000000u, 0x00101000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00040400u, 0x00000000u, 0x0E0E0E06u, 0x0F000000u, 0x1F1F1F37u, 0x3F1F0000u, 0x3F3F3F77u,
+0x78000000u, 0x7C7C7F76u, 0x00000000u, 0x38383E30u, 0x00000000u, 0x10101C00u, 0x00000000u, 0x00001C00u,
+0x00000000u, 0x04041C00u, 0x00000000u, 0x0E0E3E06u, 0x0F000000u, 0x1F1F7F37u, 0x7F1F0000u, 0x3F3FFF77u,
+0xFEFFFCFCu, 0xFFFFFFFFu, 0xFEFFF8F8u, 0xFFFFFFFFu, 0xFEFFF1F1u, 0xFFFFFFFFu, 0xFEFFE3E3u, 0xFFFFFFFFu,
+0xFEFFC7C7u, 0xFFFFFFFFu, 0xFEFF8F8Fu, 0xFFFFFFFFu, 0xFEFF1F1Fu, 0xFFFFFFFFu, 0xFEFF3F3Fu, 0xFFFFFFFFu,
+0xFEFCFCFCu, 0xFFFFFFFFu, 0xFEF8F8F8u, 0xFFFFFFFFu, 0xFEF1F1F1u, 0xFFFFFFFFu, 0xFEE3E3E3u, 0xFFFFFFFFu,
+0xFEC7C7C7u, 0xFFFFFFFFu, 0xFE8F8F8Fu, 0xFFFFFFFFu, 0xFE1F1F1Fu, 0xFFFFFFFFu, 0xFE3F3F3Fu, 0xFFFFFFFFu,
+0xFCFCFCFFu, 0xFFFFFFFFu, 0xF8F8F8FFu, 0xFFFFFFFFu, 0xF0F1F1FFu, 0xFFFFFFFFu, 0xE2E3E3FFu, 0xFFFFFFFFu,
+0xC6C7C7FFu, 0xFFFFFFFFu, 0x8E8F8FFFu, 0xFFFFFFFFu, 0x1E1F1FFFu, 0xFFFFFFFFu, 0x3E3F3FFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000300u, 0x00000000u, 0x00070701u, 0x02030000u, 0x070F0F03u,
+0x06070000u, 0x0F1F1F07u, 0x8E8FFFFFu, 0xFFFFFF8Fu, 0x1E1FFFFFu, 0xFFFFFF1Fu, 0x3E3FFFFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u, 0x02000000u, 0x07070303u,
+0x06000000u, 0x0F0F0707u, 0x8EFFFFFFu, 0xFFFF8F8Fu, 0x1EFFFFFFu, 0xFFFF1F1Fu, 0x3EFFFFFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x07030303u,
+0x00000000u, 0x0F070707u, 0xFEFFFFFFu, 0xFF8F8F8Fu, 0xFEFFFFFFu, 0xFF1F1F1Fu, 0xFEFFFFFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+0x00000000u, 0x0707070Fu, 0xFEFFFFFFu, 0x8F8F8FFFu, 0xFEFFFFFFu, 0x1F1F1FFFu, 0xFEFFFFFFu, 0x3F3F3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+0x00000000u, 0x07070F0Fu, 0xFEFFFFFFu, 0x8F8FFFFFu, 0xFEFFFFFFu, 0x1F1FFFFFu, 0xFEFFFFFFu, 0x3F3FFFFFu,
+0xFEFFFCFCu, 0xFFFFFFFFu, 0xFEFFF8F8u, 0xFFFFFFFFu, 0xFEFFF1F1u, 0xFFFFFFFFu, 0xFEFFE3E3u, 0xFFFFFFFFu,
+0xFEFFC7C7u, 0xFFFFFFFFu, 0xFEFF8F8Fu, 0xFFFFFFFFu, 0xFEFF1F1Fu, 0xFFFFFFFFu, 0xFEFF3F3Fu, 0xFFFFFFFFu,
+0xFEFCFCFCu, 0xFFFFFFFFu, 0xFEF8F8F8u, 0xFFFFFFFFu, 0xFEF1F1F1u, 0xFFFFFFFFu, 0xFEE3E3E3u, 0xFFFFFFFFu,
+0xFEC7C7C7u, 0xFFFFFFFFu, 0xFE8F8F8Fu, 0xFFFFFFFFu, 0xFE1F1F1Fu, 0xFFFFFFFFu, 0xFE3F3F3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000003u, 0x00000000u, 0x00000003u, 0x00000000u, 0x00000307u, 0x02020000u, 0x0007070Fu,
+0x06070000u, 0x070F0F1Fu, 0x0E0F0000u, 0x0F1F1F3Fu, 0x1E1F1FFFu, 0xFFFFFFFFu, 0x3E3F3FFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u, 0x02000000u, 0x00020602u,
+0x06000000u, 0x07070F07u, 0x0E000000u, 0x0F0F1F0Fu, 0x1E1FFFFFu, 0xFFFFFF1Fu, 0x3E3FFFFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020202u,
+0x00000000u, 0x07070707u, 0x00000000u, 0x0F0F0F0Fu, 0x1EFFFFFFu, 0xFFFF1F1Fu, 0x3EFFFFFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+0x00000000u, 0x07070700u, 0x00000000u, 0x0F0F0F0Fu, 0xFEFFFFFFu, 0xFF1F1F1Fu, 0xFEFFFFFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u,
+0x00000000u, 0x07070700u, 0x00000000u, 0x0F0F0F0Fu, 0xFEFFFFFFu, 0x1F1F1FFFu, 0xFEFFFFFFu, 0x3F3F3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+0x00000000u, 0x07070700u, 0x00000000u, 0x0F0F0F0Fu, 0xFEFFFFFFu, 0x1F1FFFFFu, 0xFEFFFFFFu, 0x3F3FFFFFu,
+0xFDFFFCFCu, 0xFFFFFFFFu, 0xFDFFF8F8u, 0xFFFFFFFFu, 0xFDFFF1F1u, 0xFFFFFFFFu, 0xFDFFE3E3u, 0xFFFFFFFFu,
+0xFDFFC7C7u, 0xFFFFFFFFu, 0xFDFF8F8Fu, 0xFFFFFFFFu, 0xFDFF1F1Fu, 0xFFFFFFFFu, 0xFDFF3F3Fu, 0xFFFFFFFFu,
+0xFDFCFCFCu, 0xFFFFFFFFu, 0xFDF8F8F8u, 0xFFFFFFFFu, 0xFDF1F1F1u, 0xFFFFFFFFu, 0xFDE3E3E3u, 0xFFFFFFFFu,
+0xFDC7C7C7u, 0xFFFFFFFFu, 0xFD8F8F8Fu, 0xFFFFFFFFu, 0xFD1F1F1Fu, 0xFFFFFFFFu, 0xFD3F3F3Fu, 0xFFFFFFFFu,
+0xFCFCFCFFu, 0xFFFFFFFFu, 0xF8F8F8FFu, 0xFFFFFFFFu, 0xF1F1F1FFu, 0xFFFFFFFFu, 0xE1E3E3FFu, 0xFFFFFFFFu,
+0xC5C7C7FFu, 0xFFFFFFFFu, 0x8D8F8FFFu, 0xFFFFFFFFu, 0x1D1F1FFFu, 0xFFFFFFFFu, 0x3D3F3FFFu, 0xFFFFFFFFu,
+0x0C0C0000u, 0x00000F0Cu, 0x00000000u, 0x00000000u, 0x01010000u, 0x00000701u, 0x01030700u, 0x000F0F03u,
+0x05070700u, 0x0F1F1F07u, 0x0D0F1F0Fu, 0x1F3F3F0Fu, 0x1D1FFFFFu, 0xFFFFFF1Fu, 0x3D3FFFFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01030000u, 0x00070303u,
+0x050F0700u, 0x0F0F0707u, 0x0D1F1F0Fu, 0x1F1F0F0Fu, 0x1DFFFFFFu, 0xFFFF1F1Fu, 0x3DFFFFFFu, 0xFFFF3F3Fu,
+0x0C000000u, 0x000C0C0Cu, 0x00000000u, 0x00000000u, 0x01000000u, 0x00010101u, 0x05030000u, 0x07030303u,
+0x0D0F0700u, 0x0F070707u, 0x1D1F1F0Fu, 0x1F0F0F0Fu, 0xFDFFFFFFu, 0xFF1F1F1Fu, 0xFDFFFFFFu, 0xFF3F3F3Fu,
+0x0D000000u, 0x0C0C0C0Eu, 0x05000000u, 0x00000005u, 0x0D000000u, 0x0101010Bu, 0x1D030000u, 0x03030317u,
+0x3D0F0700u, 0x0707072Fu, 0x7D1F1F0Fu, 0x0F0F0F5Fu, 0xFDFFFFFFu, 0x1F1F1FFFu, 0xFDFFFFFFu, 0x3F3F3FFFu,
+0x0C000000u, 0x0C0C0F0Fu, 0x00000000u, 0x00080F0Fu, 0x01000000u, 0x01010F0Fu, 0x05030000u, 0x03031F1Fu,
+0x0D0F0700u, 0x07073F3Fu, 0x1D1F1F0Fu, 0x0F0F7F7Fu, 0xFDFFFFFFu, 0x1F1FFFFFu, 0xFDFFFFFFu, 0x3F3FFFFFu,
+0xFDFFFCFCu, 0xFFFFFFFFu, 0xFDFFF8F8u, 0xFFFFFFFFu, 0xFDFFF1F1u, 0xFFFFFFFFu, 0xFDFFE3E3u, 0xFFFFFFFFu,
+0xFDFFC7C7u, 0xFFFFFFFFu, 0xFDFF8F8Fu, 0xFFFFFFFFu, 0xFDFF1F1Fu, 0xFFFFFFFFu, 0xFDFF3F3Fu, 0xFFFFFFFFu,
+0xFDFCFCFCu, 0xFFFFFFFFu, 0xFDF8F8F8u, 0xFFFFFFFFu, 0xFDF1F1F1u, 0xFFFFFFFFu, 0xFDE3E3E3u, 0xFFFFFFFFu,
+0xFDC7C7C7u, 0xFFFFFFFFu, 0xFD8F8F8Fu, 0xFFFFFFFFu, 0xFD1F1F1Fu, 0xFFFFFFFFu, 0xFD3F3F3Fu, 0xFFFFFFFFu,
+0x04040000u, 0x00000007u, 0x00000000u, 0x00000007u, 0x01010000u, 0x00000007u, 0x01030000u, 0x0000070Fu,
+0x05070700u, 0x000F0F1Fu, 0x0D0F0700u, 0x0F1F1F3Fu, 0x1D1F1F0Fu, 0x1F3F3F7Fu, 0x3D3F3FFFu, 0xFFFFFFFFu,
+0x04000000u, 0x00000004u, 0x00000000u, 0x00000000u, 0x01000000u, 0x00000001u, 0x01030000u, 0x00000703u,
+0x05030000u, 0x00070F07u, 0x0D0F0700u, 0x0F0F1F0Fu, 0x1D1F1F0Fu, 0x1F1F3F1Fu, 0x3D3FFFFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000004u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000001u, 0x01000000u, 0x00000303u,
+0x05030000u, 0x00070707u, 0x0D0F0700u, 0x0F0F0F0Fu, 0x1D1F1F0Fu, 0x1F1F1F1Fu, 0x3DFFFFFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000404u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000101u, 0x01000000u, 0x00030303u,
+0x05030000u, 0x00070707u, 0x0D0F0700u, 0x0F0F0F0Fu, 0x1D1F1F0Fu, 0x1F1F1F1Fu, 0xFDFFFFFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00040405u, 0x00000000u, 0x00000002u, 0x00000000u, 0x00010105u, 0x01000000u, 0x0003030Bu,
+0x05030000u, 0x07070717u, 0x0D0F0700u, 0x0F0F0F2Fu, 0x1D1F1F0Fu, 0x1F1F1F5Fu, 0xFDFFFFFFu, 0x3F3F3FFFu,
+0x00000000u, 0x04040704u, 0x00000000u, 0x00000700u, 0x00000000u, 0x01010701u, 0x01000000u, 0x03030F03u,
+0x05030000u, 0x07071F07u, 0x0D0F0700u, 0x0F0F3F0Fu, 0x1D1F1F0Fu, 0x1F1F7F5Fu, 0xFDFFFFFFu, 0x3F3FFFFFu,
+0xFBFFFCFCu, 0xFFFFFFFFu, 0xFBFFF8F8u, 0xFFFFFFFFu, 0xFBFFF1F1u, 0xFFFFFFFFu, 0xFBFFE3E3u, 0xFFFFFFFFu,
+0xFBFFC7C7u, 0xFFFFFFFFu, 0xFBFF8F8Fu, 0xFFFFFFFFu, 0xFBFF1F1Fu, 0xFFFFFFFFu, 0xFBFF3F3Fu, 0xFFFFFFFFu,
+0xFBFCFCFCu, 0xFFFFFFFFu, 0xFBF8F8F8u, 0xFFFFFFFFu, 0xFBF1F1F1u, 0xFFFFFFFFu, 0xFBE3E3E3u, 0xFFFFFFFFu,
+0xFBC7C7C7u, 0xFFFFFFFFu, 0xFB8F8F8Fu, 0xFFFFFFFFu, 0xFB1F1F1Fu, 0xFFFFFFFFu, 0xFB3F3F3Fu, 0xFFFFFFFFu,
+0xF8FCFCFFu, 0xFFFFFFFFu, 0xF8F8F8FFu, 0xFFFFFFFFu, 0xF1F1F1FFu, 0xFFFFFFFFu, 0xE3E3E3FFu, 0xFFFFFFFFu,
+0xC3C7C7FFu, 0xFFFFFFFFu, 0x8B8F8FFFu, 0xFFFFFFFFu, 0x1B1F1FFFu, 0xFFFFFFFFu, 0x3B3F3FFFu, 0xFFFFFFFFu,
+0x383C3E00u, 0x003F3F3Cu, 0x18180000u, 0x00001E18u, 0x00000000u, 0x00000000u, 0x03030000u, 0x00000F03u,
+0x03070F00u, 0x001F1F07u, 0x0B0F0F00u, 0x1F3F3F0Fu, 0x1B1F3F1Fu, 0x3F7F7F1Fu, 0x3B3FFFFFu, 0xFFFFFF3Fu,
+0x383C0000u, 0x003E3C3Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x03070000u, 0x000F0707u, 0x0B1F0F00u, 0x1F1F0F0Fu, 0x1B3F3F1Fu, 0x3F3F1F1Fu, 0x3BFFFFFFu, 0xFFFF3F3Fu,
+0x3A3C0000u, 0x3E3C3C3Cu, 0x18000000u, 0x00181818u, 0x00000000u, 0x00000000u, 0x03000000u, 0x00030303u,
+0x0B070000u, 0x0F070707u, 0x1B1F0F00u, 0x1F0F0F0Fu, 0x3B3F3F1Fu, 0x3F1F1F1Fu, 0xFBFFFFFFu, 0xFF3F3F3Fu,
+0x3B3C0000u, 0x3C3C3C3Eu, 0x1B000000u, 0x1818181Du, 0x0A000000u, 0x0000000Au, 0x1B000000u, 0x03030317u,
+0x3B070000u, 0x0707072Fu, 0x7B1F0F00u, 0x0F0F0F5Fu, 0xFB3F3F1Fu, 0x1F1F1FBFu, 0xFBFFFFFFu, 0x3F3F3FFFu,
+0x3A3C0000u, 0x3C3C3F3Fu, 0x18000000u, 0x18181F1Fu, 0x00000000u, 0x00111F1Fu, 0x03000000u, 0x03031F1Fu,
+0x0B070000u, 0x07073F3Fu, 0x1B1F0F00u, 0x0F0F7F7Fu, 0x3B3F3F1Fu, 0x1F1FFFFFu, 0xFBFFFFFFu, 0x3F3FFFFFu,
+0xFBFFFCFCu, 0xFFFFFFFFu, 0xFBFFF8F8u, 0xFFFFFFFFu, 0xFBFFF1F1u, 0xFFFFFFFFu, 0xFBFFE3E3u, 0xFFFFFFFFu,
+0xFBFFC7C7u, 0xFFFFFFFFu, 0xFBFF8F8Fu, 0xFFFFFFFFu, 0xFBFF1F1Fu, 0xFFFFFFFFu, 0xFBFF3F3Fu, 0xFFFFFFFFu,
+0xFBFCFCFCu, 0xFFFFFFFFu, 0xFBF8F8F8u, 0xFFFFFFFFu, 0xFBF1F1F1u, 0xFFFFFFFFu, 0xFBE3E3E3u, 0xFFFFFFFFu,
+0xFBC7C7C7u, 0xFFFFFFFFu, 0xFB8F8F8Fu, 0xFFFFFFFFu, 0xFB1F1F1Fu, 0xFFFFFFFFu, 0xFB3F3F3Fu, 0xFFFFFFFFu,
+0x181C0000u, 0x00001E1Fu, 0x08080000u, 0x0000000Eu, 0x00000000u, 0x0000000Eu, 0x02020000u, 0x0000000Eu,
+0x03070000u, 0x00000F1Fu, 0x0B0F0F00u, 0x001F1F3Fu, 0x1B1F0F00u, 0x1F3F3F7Fu, 0x3B3F3F1Fu, 0x3F7F7FFFu,
+0x181C0000u, 0x00001E1Cu, 0x08000000u, 0x00000008u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000002u,
+0x03070000u, 0x00000F07u, 0x0B070000u, 0x000F1F0Fu, 0x1B1F0F00u, 0x1F1F3F1Fu, 0x3B3F3F1Fu, 0x3F3F7F3Fu,
+0x18000000u, 0x00001C1Cu, 0x00000000u, 0x00000008u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000002u,
+0x03000000u, 0x00000707u, 0x0B070000u, 0x000F0F0Fu, 0x1B1F0F00u, 0x1F1F1F1Fu, 0x3B3F3F1Fu, 0x3F3F3F3Fu,
+0x18000000u, 0x001C1C1Cu, 0x00000000u, 0x00000808u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+0x03000000u, 0x00070707u, 0x0B070000u, 0x000F0F0Fu, 0x1B1F0F00u, 0x1F1F1F1Fu, 0x3B3F3F1Fu, 0x3F3F3F3Fu,
+0x18000000u, 0x001C1C1Du, 0x00000000u, 0x0008080Au, 0x00000000u, 0x00000004u, 0x00000000u, 0x0002020Au,
+0x03000000u, 0x00070717u, 0x0B070000u, 0x0F0F0F2Fu, 0x1B1F0F00u, 0x1F1F1F5Fu, 0x3B3F3F1Fu, 0x3F3F3FBFu,
+0x18000000u, 0x1C1C1F1Cu, 0x00000000u, 0x08080E08u, 0x00000000u, 0x00000E00u, 0x00000000u, 0x02020E02u,
+0x03000000u, 0x07071F07u, 0x0B070000u, 0x0F0F3F0Fu, 0x1B1F0F00u, 0x1F1F7F1Fu, 0x3B3F3F1Fu, 0x3F3FFFBFu,
+0xF7FFFCFCu, 0xFFFFFFFFu, 0xF7FFF8F8u, 0xFFFFFFFFu, 0xF7FFF1F1u, 0xFFFFFFFFu, 0xF7FFE3E3u, 0xFFFFFFFFu,
+0xF7FFC7C7u, 0xFFFFFFFFu, 0xF7FF8F8Fu, 0xFFFFFFFFu, 0xF7FF1F1Fu, 0xFFFFFFFFu, 0xF7FF3F3Fu, 0xFFFFFFFFu,
+0xF7FCFCFCu, 0xFFFFFFFFu, 0xF7F8F8F8u, 0xFFFFFFFFu, 0xF7F1F1F1u, 0xFFFFFFFFu, 0xF7E3E3E3u, 0xFFFFFFFFu,
+0xF7C7C7C7u, 0xFFFFFFFFu, 0xF78F8F8Fu, 0xFFFFFFFFu, 0xF71F1F1Fu, 0xFFFFFFFFu, 0xF73F3F3Fu, 0xFFFFFFFFu,
+0xF4FCFCFFu, 0xFFFFFFFFu, 0xF0F8F8FFu, 0xFFFFFFFFu, 0xF1F1F1FFu, 0xFFFFFFFFu, 0xE3E3E3FFu, 0xFFFFFFFFu,
+0xC7C7C7FFu, 0xFFFFFFFFu, 0x878F8FFFu, 0xFFFFFFFFu, 0x171F1FFFu, 0xFFFFFFFFu, 0x373F3FFFu, 0xFFFFFFFFu,
+0xF4FCFC00u, 0xFEFFFFFCu, 0x70787C00u, 0x007E7E78u, 0x30300000u, 0x00003C30u, 0x00000000u, 0x00000000u,
+0x06060000u, 0x00001E06u, 0x070F1F00u, 0x003F3F0Fu, 0x171F1F00u, 0x3F7F7F1Fu, 0x373F7F3Fu, 0x7FFFFF3Fu,
+0xF4FEFC00u, 0xFEFEFCFCu, 0x70780000u, 0x007C7878u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000000u, 0x070F0000u, 0x001F0F0Fu, 0x173F1F00u, 0x3F3F1F1Fu, 0x377F7F3Fu, 0x7F7F3F3Fu,
+0xF6FEFC00u, 0xFEFCFCFCu, 0x74780000u, 0x7C787878u, 0x30000000u, 0x00303030u, 0x00000000u, 0x00000000u,
+0x06000000u, 0x00060606u, 0x170F0000u, 0x1F0F0F0Fu, 0x373F1F00u, 0x3F1F1F1Fu, 0x777F7F3Fu, 0x7F3F3F3Fu,
+0xF7FEFC00u, 0xFCFCFCFEu, 0x77780000u, 0x7878787Du, 0x36000000u, 0x3030303Au, 0x14000000u, 0x00000014u,
+0x36000000u, 0x0606062Eu, 0x770F0000u, 0x0F0F0F5Fu, 0xF73F1F00u, 0x1F1F1FBFu, 0xF77F7F3Fu, 0x3F3F3F7Fu,
+0xF6FEFC00u, 0xFCFCFFFFu, 0x74780000u, 0x78787F7Fu, 0x30000000u, 0x30303E3Eu, 0x00000000u, 0x00223E3Eu,
+0x06000000u, 0x06063E3Eu, 0x170F0000u, 0x0F0F7F7Fu, 0x373F1F00u, 0x1F1FFFFFu, 0x777F7F3Fu, 0x3F3FFFFFu,
+0xF7FFFCFCu, 0xFFFFFFFFu, 0xF7FFF8F8u, 0xFFFFFFFFu, 0xF7FFF1F1u, 0xFFFFFFFFu, 0xF7FFE3E3u, 0xFFFFFFFFu,
+0xF7FFC7C7u, 0xFFFFFFFFu, 0xF7FF8F8Fu, 0xFFFFFFFFu, 0xF7FF1F1Fu, 0xFFFFFFFFu, 0xF7FF3F3Fu, 0xFFFFFFFFu,
+0xF7FCFCFCu, 0xFFFFFFFFu, 0xF7F8F8F8u, 0xFFFFFFFFu, 0xF7F1F1F1u, 0xFFFFFFFFu, 0xF7E3E3E3u, 0xFFFFFFFFu,
+0xF7C7C7C7u, 0xFFFFFFFFu, 0xF78F8F8Fu, 0xFFFFFFFFu, 0xF71F1F1Fu, 0xFFFFFFFFu, 0xF73F3F3Fu, 0xFFFFFFFFu,
+0x747C7C00u, 0x007E7E7Fu, 0x30380000u, 0x00003C3Eu, 0x10100000u, 0x0000001Cu, 0x00000000u, 0x0000001Cu,
+0x04040000u, 0x0000001Cu, 0x060E0000u, 0x00001E3Eu, 0x171F1F00u, 0x003F3F7Fu, 0x373F1F00u, 0x3F7F7FFFu,
+0x74780000u, 0x007C7E7Cu, 0x30380000u, 0x00003C38u, 0x10000000u, 0x00000010u, 0x00000000u, 0x00000000u,
+0x04000000u, 0x00000004u, 0x060E0000u, 0x00001E0Eu, 0x170F0000u, 0x001F3F1Fu, 0x373F1F00u, 0x3F3F7F3Fu,
+0x74780000u, 0x007C7C7Cu, 0x30000000u, 0x00003838u, 0x00000000u, 0x00000010u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000004u, 0x06000000u, 0x00000E0Eu, 0x170F0000u, 0x001F1F1Fu, 0x373F1F00u, 0x3F3F3F3Fu,
+0x74780000u, 0x007C7C7Cu, 0x30000000u, 0x00383838u, 0x00000000u, 0x00001010u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000404u, 0x06000000u, 0x000E0E0Eu, 0x170F0000u, 0x001F1F1Fu, 0x373F1F00u, 0x3F3F3F3Fu,
+0x74780000u, 0x7C7C7C7Du, 0x30000000u, 0x0038383Au, 0x00000000u, 0x00101014u, 0x00000000u, 0x00000008u,
+0x00000000u, 0x00040414u, 0x06000000u, 0x000E0E2Eu, 0x170F0000u, 0x1F1F1F5Fu, 0x373F1F00u, 0x3F3F3FBFu,
+0x74780000u, 0x7C7C7F7Cu, 0x30000000u, 0x38383E38u, 0x00000000u, 0x10101C10u, 0x00000000u, 0x00001C00u,
+0x00000000u, 0x04041C04u, 0x06000000u, 0x0E0E3E0Eu, 0x170F0000u, 0x1F1F7F1Fu, 0x373F1F00u, 0x3F3FFF3Fu,
+0xFFFEFCFCu, 0xFFFFFFFFu, 0xFFFEF8F8u, 0xFFFFFFFFu, 0xFFFEF1F1u, 0xFFFFFFFFu, 0xFFFEE3E3u, 0xFFFFFFFFu,
+0xFFFEC7C7u, 0xFFFFFFFFu, 0xFFFE8F8Fu, 0xFFFFFFFFu, 0xFFFE1F1Fu, 0xFFFFFFFFu, 0xFFFE3F3Fu, 0xFFFFFFFFu,
+0xFFFCFCFCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF0F1F1u, 0xFFFFFFFFu, 0xFFE2E3E3u, 0xFFFFFFFFu,
+0xFFC6C7C7u, 0xFFFFFFFFu, 0xFF8E8F8Fu, 0xFFFFFFFFu, 0xFF1E1F1Fu, 0xFFFFFFFFu, 0xFF3E3F3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000003u, 0x01000000u, 0x00000707u, 0x03020300u, 0x00070F0Fu,
+0x07060700u, 0x0F0F1F1Fu, 0x0F0E0F00u, 0x1F1F3F3Fu, 0x1F1E1FFFu, 0xFFFFFFFFu, 0x3F3E3FFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u, 0x03020000u, 0x00070703u,
+0x07060000u, 0x0F0F0F07u, 0x0F0E0000u, 0x1F1F1F0Fu, 0x1F1EFFFFu, 0xFFFFFF1Fu, 0x3F3EFFFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03000000u, 0x00070303u,
+0x07000000u, 0x0F0F0707u, 0x0F000000u, 0x1F1F0F0Fu, 0x1FFEFFFFu, 0xFFFF1F1Fu, 0x3FFEFFFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00030303u,
+0x00000000u, 0x0F070707u, 0x1F000000u, 0x1F0F0F0Fu, 0xFFFEFFFFu, 0xFF1F1F1Fu, 0xFFFEFFFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+0x00000000u, 0x0707070Fu, 0x1F000000u, 0x0F0F0F1Fu, 0xFFFEFFFFu, 0x1F1F1FFFu, 0xFFFEFFFFu, 0x3F3F3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+0x00000000u, 0x07070F0Fu, 0x1F000000u, 0x0F0F1F1Fu, 0xFFFEFFFFu, 0x1F1FFFFFu, 0xFFFEFFFFu, 0x3F3FFFFFu,
+0xFFFEFCFCu, 0xFFFFFFFFu, 0xFFFEF8F8u, 0xFFFFFFFFu, 0xFFFEF1F1u, 0xFFFFFFFFu, 0xFFFEE3E3u, 0xFFFFFFFFu,
+0xFFFEC7C7u, 0xFFFFFFFFu, 0xFFFE8F8Fu, 0xFFFFFFFFu, 0xFFFE1F1Fu, 0xFFFFFFFFu, 0xFFFE3F3Fu, 0xFFFFFFFFu,
+0x03000000u, 0x00000000u, 0x03000000u, 0x00000000u, 0x07000000u, 0x00000003u, 0x0F020200u, 0x00000707u,
+0x1F060700u, 0x00070F0Fu, 0x3F0E0F00u, 0x0F0F1F1Fu, 0x7F1E1F00u, 0x1F1F3F3Fu, 0xFF3E3F3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000002u, 0x02020000u, 0x00000206u,
+0x07060000u, 0x0007070Fu, 0x0F0E0000u, 0x0F0F0F1Fu, 0x1F1E0000u, 0x1F1F1F3Fu, 0x3F3E3FFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000202u,
+0x07000000u, 0x00070707u, 0x0F000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0x3F3EFFFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+0x00000000u, 0x00070707u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0x3FFEFFFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u,
+0x00000000u, 0x00070700u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0xFFFEFFFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u,
+0x00000000u, 0x00070700u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0xFFFEFFFFu, 0x3F3F3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+0x00000000u, 0x07070700u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0xFFFEFFFFu, 0x3F3FFFFFu,
+0xFFFDFCFCu, 0xFFFFFFFFu, 0xFFFDF8F8u, 0xFFFFFFFFu, 0xFFFDF1F1u, 0xFFFFFFFFu, 0xFFFDE3E3u, 0xFFFFFFFFu,
+0xFFFDC7C7u, 0xFFFFFFFFu, 0xFFFD8F8Fu, 0xFFFFFFFFu, 0xFFFD1F1Fu, 0xFFFFFFFFu, 0xFFFD3F3Fu, 0xFFFFFFFFu,
+0xFFFCFCFCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE1E3E3u, 0xFFFFFFFFu,
+0xFFC5C7C7u, 0xFFFFFFFFu, 0xFF8D8F8Fu, 0xFFFFFFFFu, 0xFF1D1F1Fu, 0xFFFFFFFFu, 0xFF3D3F3Fu, 0xFFFFFFFFu,
+0x0C0C0C00u, 0x0000000Fu, 0x00000000u, 0x00000000u, 0x01010100u, 0x00000007u, 0x03010307u, 0x00000F0Fu,
+0x07050707u, 0x000F1F1Fu, 0x0F0D0F1Fu, 0x1F1F3F3Fu, 0x1F1D1F3Fu, 0x3F3F7F7Fu, 0x3F3D3FFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03010300u, 0x00000703u,
+0x07050F07u, 0x000F0F07u, 0x0F0D1F1Fu, 0x1F1F1F0Fu, 0x1F1D3F3Fu, 0x3F3F3F1Fu, 0x3F3DFFFFu, 0xFFFFFF3Fu,
+0x0C0C0000u, 0x00000C0Cu, 0x00000000u, 0x00000000u, 0x01010000u, 0x00000101u, 0x03050300u, 0x00070303u,
+0x070D0F07u, 0x000F0707u, 0x0F1D1F1Fu, 0x1F1F0F0Fu, 0x1F3D3F3Fu, 0x3F3F1F1Fu, 0x3FFDFFFFu, 0xFFFF3F3Fu,
+0x0E0D0000u, 0x000C0C0Cu, 0x05050000u, 0x00000000u, 0x0B0D0000u, 0x00010101u, 0x171D0300u, 0x00030303u,
+0x2F3D0F07u, 0x0F070707u, 0x5F7D1F1Fu, 0x1F0F0F0Fu, 0xBFFD3F3Fu, 0x3F1F1F1Fu, 0xFFFDFFFFu, 0xFF3F3F3Fu,
+0x0F0C0000u, 0x0C0C0C0Fu, 0x0F000000u, 0x0000080Fu, 0x0F010000u, 0x0101010Fu, 0x1F050300u, 0x0303031Fu,
+0x3F0D0F07u, 0x0707073Fu, 0x7F1D1F1Fu, 0x0F0F0F7Fu, 0xFF3D3F3Fu, 0x1F1F1FFFu, 0xFFFDFFFFu, 0x3F3F3FFFu,
+0x1F1D0000u, 0x0C1C1F1Fu, 0x1F1D0000u, 0x00181F1Fu, 0x1F1D0000u, 0x01111F1Fu, 0x1F1D0300u, 0x03031F1Fu,
+0x3F3D0F07u, 0x07073F3Fu, 0x7F7D1F1Fu, 0x0F0F7F7Fu, 0xFFFD3F3Fu, 0x1F1FFFFFu, 0xFFFDFFFFu, 0x3F3FFFFFu,
+0xFFFDFCFCu, 0xFFFFFFFFu, 0xFFFDF8F8u, 0xFFFFFFFFu, 0xFFFDF1F1u, 0xFFFFFFFFu, 0xFFFDE3E3u, 0xFFFFFFFFu,
+0xFFFDC7C7u, 0xFFFFFFFFu, 0xFFFD8F8Fu, 0xFFFFFFFFu, 0xFFFD1F1Fu, 0xFFFFFFFFu, 0xFFFD3F3Fu, 0xFFFFFFFFu,
+0x07040400u, 0x00000000u, 0x07000000u, 0x00000000u, 0x07010100u, 0x00000000u, 0x0F010300u, 0x00000007u,
+0x1F050707u, 0x00000F0Fu, 0x3F0D0F07u, 0x000F1F1Fu, 0x7F1D1F1Fu, 0x1F1F3F3Fu, 0xFF3D3F3Fu, 0x3F3F7F7Fu,
+0x04040000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01010000u, 0x00000000u, 0x03010300u, 0x00000007u,
+0x07050300u, 0x0000070Fu, 0x0F0D0F07u, 0x000F0F1Fu, 0x1F1D1F1Fu, 0x1F1F1F3Fu, 0x3F3D3F3Fu, 0x3F3F3F7Fu,
+0x04000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01000000u, 0x00000000u, 0x03010000u, 0x00000003u,
+0x07050300u, 0x00000707u, 0x0F0D0F07u, 0x000F0F0Fu, 0x1F1D1F1Fu, 0x1F1F1F1Fu, 0x3F3D3F3Fu, 0x3F3F3F3Fu,
+0x04000000u, 0x00000004u, 0x00000000u, 0x00000000u, 0x01000000u, 0x00000001u, 0x03010000u, 0x00000303u,
+0x07050300u, 0x00000707u, 0x0F0D0F07u, 0x000F0F0Fu, 0x1F1D1F1Fu, 0x1F1F1F1Fu, 0x3F3D3F3Fu, 0x3F3F3F3Fu,
+0x05000000u, 0x00000404u, 0x02000000u, 0x00000000u, 0x05000000u, 0x00000101u, 0x0B010000u, 0x00000303u,
+0x17050300u, 0x00070707u, 0x2F0D0F07u, 0x000F0F0Fu, 0x5F1D1F1Fu, 0x1F1F1F1Fu, 0xBF3D3F3Fu, 0x3F3F3F3Fu,
+0x04000000u, 0x00040407u, 0x00000000u, 0x00000007u, 0x01000000u, 0x00010107u, 0x03010000u, 0x0003030Fu,
+0x07050300u, 0x0007071Fu, 0x0F0D0F07u, 0x0F0F0F3Fu, 0x1F1D1F1Fu, 0x1F1F1F7Fu, 0xBF3D3F3Fu, 0x3F3F3FFFu,
+0x0F000000u, 0x04040F0Fu, 0x0F000000u, 0x00000F0Fu, 0x0F000000u, 0x01010F0Fu, 0x0F010000u, 0x03030F0Fu,
+0x1F050300u, 0x07071F1Fu, 0x3F0D0F07u, 0x0F0F3F3Fu, 0x7F1D1F1Fu, 0x1F1F7F7Fu, 0xFF3D3F3Fu, 0x3F3FFFFFu,
+0xFFFBFCFCu, 0xFFFFFFFFu, 0xFFFBF8F8u, 0xFFFFFFFFu, 0xFFFBF1F1u, 0xFFFFFFFFu, 0xFFFBE3E3u, 0xFFFFFFFFu,
+0xFFFBC7C7u, 0xFFFFFFFFu, 0xFFFB8F8Fu, 0xFFFFFFFFu, 0xFFFB1F1Fu, 0xFFFFFFFFu, 0xFFFB3F3Fu, 0xFFFFFFFFu,
+0xFFF8FCFCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE3E3E3u, 0xFFFFFFFFu,
+0xFFC3C7C7u, 0xFFFFFFFFu, 0xFF8B8F8Fu, 0xFFFFFFFFu, 0xFF1B1F1Fu, 0xFFFFFFFFu, 0xFF3B3F3Fu, 0xFFFFFFFFu,
+0x3C383C3Eu, 0x00003F3Fu, 0x18181800u, 0x0000001Eu, 0x00000000u, 0x00000000u, 0x03030300u, 0x0000000Fu,
+0x0703070Fu, 0x00001F1Fu, 0x0F0B0F0Fu, 0x001F3F3Fu, 0x1F1B1F3Fu, 0x3F3F7F7Fu, 0x3F3B3F7Fu, 0x7F7FFFFFu,
+0x3C383C00u, 0x00003E3Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x07030700u, 0x00000F07u, 0x0F0B1F0Fu, 0x001F1F0Fu, 0x1F1B3F3Fu, 0x3F3F3F1Fu, 0x3F3B7F7Fu, 0x7F7F7F3Fu,
+0x3C3A3C00u, 0x003E3C3Cu, 0x18180000u, 0x00001818u, 0x00000000u, 0x00000000u, 0x03030000u, 0x00000303u,
+0x070B0700u, 0x000F0707u, 0x0F1B1F0Fu, 0x001F0F0Fu, 0x1F3B3F3Fu, 0x3F3F1F1Fu, 0x3F7B7F7Fu, 0x7F7F3F3Fu,
+0x3E3B3C00u, 0x003C3C3Cu, 0x1D1B0000u, 0x00181818u, 0x0A0A0000u, 0x00000000u, 0x171B0000u, 0x00030303u,
+0x2F3B0700u, 0x00070707u, 0x5F7B1F0Fu, 0x1F0F0F0Fu, 0xBFFB3F3Fu, 0x3F1F1F1Fu, 0x7FFB7F7Fu, 0x7F3F3F3Fu,
+0x3F3A3C00u, 0x3C3C3C3Fu, 0x1F180000u, 0x1818181Fu, 0x1F000000u, 0x0000111Fu, 0x1F030000u, 0x0303031Fu,
+0x3F0B0700u, 0x0707073Fu, 0x7F1B1F0Fu, 0x0F0F0F7Fu, 0xFF3B3F3Fu, 0x1F1F1FFFu, 0xFF7B7F7Fu, 0x3F3F3FFFu,
+0x3F3B3C00u, 0x3C3C3F3Fu, 0x3F3B0000u, 0x18383F3Fu, 0x3F3B0000u, 0x00313F3Fu, 0x3F3B0000u, 0x03233F3Fu,
+0x3F3B0700u, 0x07073F3Fu, 0x7F7B1F0Fu, 0x0F0F7F7Fu, 0xFFFB3F3Fu, 0x1F1FFFFFu, 0xFFFB7F7Fu, 0x3F3FFFFFu,
+0xFFFBFCFCu, 0xFFFFFFFFu, 0xFFFBF8F8u, 0xFFFFFFFFu, 0xFFFBF1F1u, 0xFFFFFFFFu, 0xFFFBE3E3u, 0xFFFFFFFFu,
+0xFFFBC7C7u, 0xFFFFFFFFu, 0xFFFB8F8Fu, 0xFFFFFFFFu, 0xFFFB1F1Fu, 0xFFFFFFFFu, 0xFFFB3F3Fu, 0xFFFFFFFFu,
+0x1F181C00u, 0x0000001Eu, 0x0E080800u, 0x00000000u, 0x0E000000u, 0x00000000u, 0x0E020200u, 0x00000000u,
+0x1F030700u, 0x0000000Fu, 0x3F0B0F0Fu, 0x00001F1Fu, 0x7F1B1F0Fu, 0x001F3F3Fu, 0xFF3B3F3Fu, 0x3F3F7F7Fu,
+0x1C181C00u, 0x0000001Eu, 0x08080000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u, 0x00000000u,
+0x07030700u, 0x0000000Fu, 0x0F0B0700u, 0x00000F1Fu, 0x1F1B1F0Fu, 0x001F1F3Fu, 0x3F3B3F3Fu, 0x3F3F3F7Fu,
+0x1C180000u, 0x0000001Cu, 0x08000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000000u,
+0x07030000u, 0x00000007u, 0x0F0B0700u, 0x00000F0Fu, 0x1F1B1F0Fu, 0x001F1F1Fu, 0x3F3B3F3Fu, 0x3F3F3F3Fu,
+0x1C180000u, 0x00001C1Cu, 0x08000000u, 0x00000008u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000002u,
+0x07030000u, 0x00000707u, 0x0F0B0700u, 0x00000F0Fu, 0x1F1B1F0Fu, 0x001F1F1Fu, 0x3F3B3F3Fu, 0x3F3F3F3Fu,
+0x1D180000u, 0x00001C1Cu, 0x0A000000u, 0x00000808u, 0x04000000u, 0x00000000u, 0x0A000000u, 0x00000202u,
+0x17030000u, 0x00000707u, 0x2F0B0700u, 0x000F0F0Fu, 0x5F1B1F0Fu, 0x001F1F1Fu, 0xBF3B3F3Fu, 0x3F3F3F3Fu,
+0x1C180000u, 0x001C1C1Fu, 0x08000000u, 0x0008080Eu, 0x00000000u, 0x0000000Eu, 0x02000000u, 0x0002020Eu,
+0x07030000u, 0x0007071Fu, 0x0F0B0700u, 0x000F0F3Fu, 0x1F1B1F0Fu, 0x1F1F1F7Fu, 0x3F3B3F3Fu, 0x3F3F3FFFu,
+0x1F180000u, 0x1C1C1F1Fu, 0x1F000000u, 0x08081F1Fu, 0x1F000000u, 0x00001F1Fu, 0x1F000000u, 0x02021F1Fu,
+0x1F030000u, 0x07071F1Fu, 0x3F0B0700u, 0x0F0F3F3Fu, 0x7F1B1F0Fu, 0x1F1F7F7Fu, 0xFF3B3F3Fu, 0x3F3FFFFFu,
+0xFFF7FCFCu, 0xFFFFFFFFu, 0xFFF7F8F8u, 0xFFFFFFFFu, 0xFFF7F1F1u, 0xFFFFFFFFu, 0xFFF7E3E3u, 0xFFFFFFFFu,
+0xFFF7C7C7u, 0xFFFFFFFFu, 0xFFF78F8Fu, 0xFFFFFFFFu, 0xFFF71F1Fu, 0xFFFFFFFFu, 0xFFF73F3Fu, 0xFFFFFFFFu,
+0xFFF4FCFCu, 0xFFFFFFFFu, 0xFFF0F8F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE3E3E3u, 0xFFFFFFFFu,
+0xFFC7C7C7u, 0xFFFFFFFFu, 0xFF878F8Fu, 0xFFFFFFFFu, 0xFF171F1Fu, 0xFFFFFFFFu, 0xFF373F3Fu, 0xFFFFFFFFu,
+0xFCF4FCFCu, 0x00FEFFFFu, 0x7870787Cu, 0x00007E7Eu, 0x30303000u, 0x0000003Cu, 0x00000000u, 0x00000000u,
+0x06060600u, 0x0000001Eu, 0x0F070F1Fu, 0x00003F3Fu, 0x1F171F1Fu, 0x003F7F7Fu, 0x3F373F7Fu, 0x7F7FFFFFu,
+0xFCF4FEFCu, 0x00FEFEFCu, 0x78707800u, 0x00007C78u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000000u, 0x0F070F00u, 0x00001F0Fu, 0x1F173F1Fu, 0x003F3F1Fu, 0x3F377F7Fu, 0x7F7F7F3Fu,
+0xFCF6FEFCu, 0x00FEFCFCu, 0x78747800u, 0x007C7878u, 0x30300000u, 0x00003030u, 0x00000000u, 0x00000000u,
+0x06060000u, 0x00000606u, 0x0F170F00u, 0x001F0F0Fu, 0x1F373F1Fu, 0x003F1F1Fu, 0x3F777F7Fu, 0x7F7F3F3Fu,
+0xFEF7FEFCu, 0xFEFCFCFCu, 0x7D777800u, 0x00787878u, 0x3A360000u, 0x00303030u, 0x14140000u, 0x00000000u,
+0x2E360000u, 0x00060606u, 0x5F770F00u, 0x000F0F0Fu, 0xBFF73F1Fu, 0x3F1F1F1Fu, 0x7FF77F7Fu, 0x7F3F3F3Fu,
+0xFFF6FEFCu, 0xFCFCFCFFu, 0x7F747800u, 0x7878787Fu, 0x3E300000u, 0x3030303Eu, 0x3E000000u, 0x0000223Eu,
+0x3E060000u, 0x0606063Eu, 0x7F170F00u, 0x0F0F0F7Fu, 0xFF373F1Fu, 0x1F1F1FFFu, 0xFF777F7Fu, 0x3F3F3FFFu,
+0xFFF7FEFCu, 0xFCFCFFFFu, 0x7F777800u, 0x78787F7Fu, 0x7F770000u, 0x30717F7Fu, 0x7F770000u, 0x00637F7Fu,
+0x7F770000u, 0x06477F7Fu, 0x7F770F00u, 0x0F0F7F7Fu, 0xFFF73F1Fu, 0x1F1FFFFFu, 0xFFF77F7Fu, 0x3F3FFFFFu,
+0xFFF7FCFCu, 0xFFFFFFFFu, 0xFFF7F8F8u, 0xFFFFFFFFu, 0xFFF7F1F1u, 0xFFFFFFFFu, 0xFFF7E3E3u, 0xFFFFFFFFu,
+0xFFF7C7C7u, 0xFFFFFFFFu, 0xFFF78F8Fu, 0xFFFFFFFFu, 0xFFF71F1Fu, 0xFFFFFFFFu, 0xFFF73F3Fu, 0xFFFFFFFFu,
+0x7F747C7Cu, 0x00007E7Eu, 0x3E303800u, 0x0000003Cu, 0x1C101000u, 0x00000000u, 0x1C000000u, 0x00000000u,
+0x1C040400u, 0x00000000u, 0x3E060E00u, 0x0000001Eu, 0x7F171F1Fu, 0x00003F3Fu, 0xFF373F1Fu, 0x003F7F7Fu,
+0x7C747800u, 0x00007C7Eu, 0x38303800u, 0x0000003Cu, 0x10100000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x04040000u, 0x00000000u, 0x0E060E00u, 0x0000001Eu, 0x1F170F00u, 0x00001F3Fu, 0x3F373F1Fu, 0x003F3F7Fu,
+0x7C747800u, 0x00007C7Cu, 0x38300000u, 0x00000038u, 0x10000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x04000000u, 0x00000000u, 0x0E060000u, 0x0000000Eu, 0x1F170F00u, 0x00001F1Fu, 0x3F373F1Fu, 0x003F3F3Fu,
+0x7C747800u, 0x00007C7Cu, 0x38300000u, 0x00003838u, 0x10000000u, 0x00000010u, 0x00000000u, 0x00000000u,
+0x04000000u, 0x00000004u, 0x0E060000u, 0x00000E0Eu, 0x1F170F00u, 0x00001F1Fu, 0x3F373F1Fu, 0x003F3F3Fu,
+0x7D747800u, 0x007C7C7Cu, 0x3A300000u, 0x00003838u, 0x14000000u, 0x00001010u, 0x08000000u, 0x00000000u,
+0x14000000u, 0x00000404u, 0x2E060000u, 0x00000E0Eu, 0x5F170F00u, 0x001F1F1Fu, 0xBF373F1Fu, 0x003F3F3Fu,
+0x7C747800u, 0x007C7C7Fu, 0x38300000u, 0x0038383Eu, 0x10000000u, 0x0010101Cu, 0x00000000u, 0x0000001Cu,
+0x04000000u, 0x0004041Cu, 0x0E060000u, 0x000E0E3Eu, 0x1F170F00u, 0x001F1F7Fu, 0x3F373F1Fu, 0x3F3F3FFFu,
+0x7F747800u, 0x7C7C7F7Fu, 0x3E300000u, 0x38383E3Eu, 0x3E000000u, 0x10103E3Eu, 0x3E000000u, 0x00003E3Eu,
+0x3E000000u, 0x04043E3Eu, 0x3E060000u, 0x0E0E3E3Eu, 0x7F170F00u, 0x1F1F7F7Fu, 0xFF373F1Fu, 0x3F3FFFFFu,
+0xFFFFFCFCu, 0xFFFFFFFFu, 0xFFFFF8F8u, 0xFFFFFFFFu, 0xFFFFF0F1u, 0xFFFFFFFFu, 0xFFFFE2E3u, 0xFFFFFFFFu,
+0xFFFFC6C7u, 0xFFFFFFFFu, 0xFFFF8E8Fu, 0xFFFFFFFFu, 0xFFFF1E1Fu, 0xFFFFFFFFu, 0xFFFF3E3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0xFFF8F8F8u, 0xFFFFFFFFu, 0xFFF1F0F1u, 0xFFFFFFFFu, 0xFFE3E2E3u, 0xFFFFFFFFu,
+0xFFC7C6C7u, 0xFFFFFFFFu, 0xFF8F8E8Fu, 0xFFFFFFFFu, 0xFF1F1E1Fu, 0xFFFFFFFFu, 0xFF3F3E3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01000000u, 0x00000F0Fu, 0x03030200u, 0x00071F1Fu,
+0x07070600u, 0x0F0F3F3Fu, 0x0F0F0E00u, 0x1F1F7F7Fu, 0x1F1F1EFFu, 0xFFFFFFFFu, 0x3F3F3EFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u, 0x03030000u, 0x00070703u,
+0x07070000u, 0x0F0F0F07u, 0x0F0F0000u, 0x1F1F1F0Fu, 0x1F1FFEFFu, 0xFFFFFF1Fu, 0x3F3FFEFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03000000u, 0x00070303u,
+0x07000000u, 0x0F0F0707u, 0x0F000000u, 0x1F1F0F0Fu, 0x1FFFFEFFu, 0xFFFF1F1Fu, 0x3FFFFEFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00030303u,
+0x00000000u, 0x0F070707u, 0x1F000000u, 0x1F0F0F0Fu, 0xFFFFFEFFu, 0xFF1F1F1Fu, 0xFFFFFEFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+0x00000000u, 0x0707070Fu, 0x1F000000u, 0x0F0F0F1Fu, 0xFFFFFEFFu, 0x1F1F1FFFu, 0xFFFFFEFFu, 0x3F3F3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+0x00000000u, 0x07070F0Fu, 0x1F000000u, 0x0F0F1F1Fu, 0xFFFFFEFFu, 0x1F1FFFFFu, 0xFFFFFEFFu, 0x3F3FFFFFu,
+0x00030000u, 0x00000000u, 0x00030000u, 0x00000000u, 0xFFFFF0F1u, 0xFFFFFFFFu, 0xFFFFE2E3u, 0xFFFFFFFFu,
+0xFFFFC6C7u, 0xFFFFFFFFu, 0xFFFF8E8Fu, 0xFFFFFFFFu, 0xFFFF1E1Fu, 0xFFFFFFFFu, 0xFFFF3E3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0F000000u, 0x00000F0Fu, 0x0F020200u, 0x00000F0Fu,
+0x1F070600u, 0x00071F1Fu, 0x3F0F0E00u, 0x0F0F3F3Fu, 0x7F1F1E00u, 0x1F1F7F7Fu, 0xFF3F3E3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000006u, 0x02020000u, 0x0000020Eu,
+0x07070000u, 0x0007071Fu, 0x0F0F0000u, 0x0F0F0F3Fu, 0x1F1F0000u, 0x1F1F1F7Fu, 0x3F3F3EFFu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x00000202u,
+0x07000000u, 0x00070707u, 0x0F000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0x3F3FFEFFu, 0xFFFFFF3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+0x00000000u, 0x00070707u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0x3FFFFEFFu, 0xFFFF3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u,
+0x00000000u, 0x00070700u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0xFFFFFEFFu, 0xFF3F3F3Fu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u,
+0x00000000u, 0x00070700u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0xFFFFFEFFu, 0x3F3F3FFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+0x00000000u, 0x07070700u, 0x00000000u, 0x0F0F0F0Fu, 0x1F000000u, 0x1F1F1F1Fu, 0xFFFFFEFFu, 0x3F3FFFFFu,
+0xFFFFFCFCu, 0xFFFFFFFFu, 0xFFFFF8F8u, 0xFFFFFFFFu, 0xFFFFF1F1u, 0xFFFFFFFFu, 0xFFFFE1E3u, 0xFFFFFFFFu,
+0xFFFFC5C7u, 0xFFFFFFFFu, 0xFFFF8D8Fu, 0xFFFFFFFFu, 0xFFFF1D1Fu, 0xFFFFFFFFu, 0xFFFF3D3Fu, 0xFFFFFFFFu,
+0xFFFCFCFCu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0xFFF1F1F1u, 0xFFFFFFFFu, 0xFFE3E1E3u, 0xFFFFFFFFu,
+0xFFC7C5C7u, 0xFFFFFFFFu, 0xFF8F8D8Fu, 0xFFFFFFFFu, 0xFF1F1D1Fu, 0xFFFFFFFFu, 0xFF3F3D3Fu, 0xFFFFFFFFu,
+0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x03030103u, 0x00001F1Fu,
+0x0707050Fu, 0x000F3F3Fu, 0x0F0F0D1Fu, 0x1F1F7F7Fu, 0x1F1F1D3Fu, 0x3F3FFFFFu, 0x3F3F3DFFu, 0xFFFFFFFFu,
+0x0C0C0C00u, 0x0000000Cu, 0x00000000u, 0x00000000u, 0x01010100u, 0x00000001u, 0x03030503u, 0x00000703u,
+0x07070D0Fu, 0x000F0F07u, 0x0F0F1D1Fu, 0x1F1F1F0Fu, 0x1F1F3D3Fu, 0x3F3F3F1Fu, 0x3F3FFDFFu, 0xFFFFFF3Fu,
+0x0C0E0D00u, 0x00000C0Cu, 0x00050500u, 0x00000000u, 0x010B0D00u, 0x00000101u, 0x03171D03u, 0x00000303u,
+0x072F3D0Fu, 0x000F0707u, 0x0F5F7D1Fu, 0x1F1F0F0Fu, 0x1FBFFD3Fu, 0x3F3F1F1Fu, 0x3FFFFDFFu, 0xFFFF3F3Fu,
+0x0F0F0C00u, 0x000C0C0Cu, 0x0F0F0000u, 0x00000008u, 0x0F0F0100u, 0x00010101u, 0x1F1F0503u, 0x00030303u,
+0x3F3F0D0Fu, 0x00070707u, 0x7F7F1D1Fu, 0x1F0F0F0Fu, 0xFFFF3D3Fu, 0x3F1F1F1Fu, 0xFFFFFDFFu, 0xFF3F3F3Fu,
+0x1F1F1D00u, 0x0C0C1C1Fu, 0x1F1F1D00u, 0x0000181Fu, 0x1F1F1D00u, 0x0101111Fu, 0x1F1F1D03u, 0x0303031Fu,
+0x3F3F3D0Fu, 0x0707073Fu, 0x7F7F7D1Fu, 0x0F0F0F7Fu, 0xFFFFFD3Fu, 0x1F1F1FFFu, 0xFFFFFDFFu, 0x3F3F3FFFu,
+0x3F3F3D3Fu, 0x0C3C3F3Fu, 0x3F3F3D3Fu, 0x00383F3Fu, 0x3F3F3D3Fu, 0x01313F3Fu, 0x3F3F3D3Fu, 0x03233F3Fu,
+0x3F3F3D3Fu, 0x07073F3Fu, 0x7F7F7D7Fu, 0x0F0F7F7Fu, 0xFFFFFDFFu, 0x1F1FFFFFu, 0xFFFFFDFFu, 0x3F3FFFFFu,
+0x00070404u, 0x00000000u, 0x00070000u, 0x00000000u, 0x00070101u, 0x00000000u, 0xFFFFE1E3u, 0xFFFFFFFFu,
+0xFFFFC5C7u, 0xFFFFFFFFu, 0xFFFF8D8Fu, 0xFFFFFFFFu, 0xFFFF1D1Fu, 0xFFFFFFFFu, 0xFFFF3D3Fu, 0xFFFFFFFFu,
+0x00040400u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00010100u, 0x00000000u, 0x1F030103u, 0x00001F1Fu,
+0x1F070503u, 0x00001F1Fu, 0x3F0F0D0Fu, 0x000F3F3Fu, 0x7F1F1D1Fu, 0x1F1F7F7Fu, 0xFF3F3D3Fu, 0x3F3FFFFFu,
+0x00040000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00010000u, 0x00000000u, 0x03030100u, 0x0000000Fu,
+0x07070503u, 0x0000071Fu, 0x0F0F0D0Fu, 0x000F0F3Fu, 0x1F1F1D1Fu, 0x1F1F1F7Fu, 0x3F3F3D3Fu, 0x3F3F3FFFu,
+0x04040000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01010000u, 0x00000000u, 0x03030100u, 0x00000003u,
+0x07070503u, 0x00000707u, 0x0F0F0D0Fu, 0x000F0F0Fu, 0x1F1F1D1Fu, 0x1F1F1F1Fu, 0x3F3F3D3Fu, 0x3F3F3F3Fu,
+0x04050000u, 0x00000004u, 0x00020000u, 0x00000000u, 0x01050000u, 0x00000001u, 0x030B0100u, 0x00000003u,
+0x07170503u, 0x00000707u, 0x0F2F0D0Fu, 0x000F0F0Fu, 0x1F5F1D1Fu, 0x1F1F1F1Fu, 0x3FBF3D3Fu, 0x3F3F3F3Fu,
+0x07040000u, 0x00000404u, 0x07000000u, 0x00000000u, 0x07010000u, 0x00000101u, 0x0F030100u, 0x00000303u,
+0x1F070503u, 0x00000707u, 0x3F0F0D0Fu, 0x000F0F0Fu, 0x7F1F1D1Fu, 0x1F1F1F1Fu, 0xFFBF3D3Fu, 0x3F3F3F3Fu,
+0x0F0F0000u, 0x0004040Fu, 0x0F0F0000u, 0x0000000Fu, 0x0F0F0000u, 0x0001010Fu, 0x0F0F0100u, 0x0003030Fu,
+0x1F1F0503u, 0x0007071Fu, 0x3F3F0D0Fu, 0x000F0F3Fu, 0x7F7F1D1Fu, 0x1F1F1F7Fu, 0xFFFF3D3Fu, 0x3F3F3FFFu,
+0x1F1F1D00u, 0x04041F1Fu, 0x1F1F1D00u, 0x00001F1Fu, 0x1F1F1D00u, 0x01011F1Fu, 0x1F1F1D00u, 0x03031F1Fu,
+0x1F1F1D03u, 0x07071F1Fu, 0x3F3F3D0Fu, 0x0F0F3F3Fu, 0x7F7F7D1Fu, 0x1F1F7F7Fu, 0xFFFFFD3Fu, 0x3F3FFFFFu,
+0xFFFFF8FCu, 0xFFFFFFFFu, 0xFFFFF8F8u, 0xFFFFFFFFu, 0xFFFFF1F1u, 0xFFFFFFFFu, 0xFFFFE3E3u, 0xFFFFFFFFu,
+0xFFFFC3C7u, 0xFFFFFFFFu, 0xFFFF8B8Fu, 0xFFFFFFFFu, 0xFFFF1B1Fu, 0xFFFFFFFFu, 0xFFFF3B3Fu, 0xFFFFFFFFu,
+0xFFFCF8FCu, 0xFFFFFFFFu, 0xFFF8F8F8u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0xFFE3E3E3u, 0xFFFFFFFFu,
+0xFFC7C3C7u, 0xFFFFFFFFu, 0xFF8F8B8Fu, 0xFFFFFFFFu, 0xFF1F1B1Fu, 0xFFFFFFFFu, 0xFF3F3B3Fu, 0xFFFFFFFFu,
+0x3C3C383Cu, 0x00003F3Fu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x07070307u, 0x00003F3Fu, 0x0F0F0B1Fu, 0x001F7F7Fu, 0x1F1F1B3Fu, 0x3F3FFFFFu, 0x3F3F3B7Fu, 0x7F7FFFFFu,
+0x3C3C3A3Cu, 0x00003E3Cu, 0x18181800u, 0x00000018u, 0x00000000u, 0x00000000u, 0x03030300u, 0x00000003u,
+0x07070B07u, 0x00000F07u, 0x0F0F1B1Fu, 0x001F1F0Fu, 0x1F1F3B3Fu, 0x3F3F3F1Fu, 0x3F3F7B7Fu, 0x7F7F7F3Fu,
+0x3C3E3B3Cu, 0x00003C3Cu, 0x181D1B00u, 0x00001818u, 0x000A0A00u, 0x00000000u, 0x03171B00u, 0x00000303u,
+0x072F3B07u, 0x00000707u, 0x0F5F7B1Fu, 0x001F0F0Fu, 0x1FBFFB3Fu, 0x3F3F1F1Fu, 0x3F7FFB7Fu, 0x7F7F3F3Fu,
+0x3F3F3A3Cu, 0x003C3C3Cu, 0x1F1F1800u, 0x00181818u, 0x1F1F0000u, 0x00000011u, 0x1F1F0300u, 0x00030303u,
+0x3F3F0B07u, 0x00070707u, 0x7F7F1B1Fu, 0x000F0F0Fu, 0xFFFF3B3Fu, 0x3F1F1F1Fu, 0xFFFF7B7Fu, 0x7F3F3F3Fu,
+0x3F3F3B3Cu, 0x3C3C3C3Fu, 0x3F3F3B00u, 0x1818383Fu, 0x3F3F3B00u, 0x0000313Fu, 0x3F3F3B00u, 0x0303233Fu,
+0x3F3F3B07u, 0x0707073Fu, 0x7F7F7B1Fu, 0x0F0F0F7Fu, 0xFFFFFB3Fu, 0x1F1F1FFFu, 0xFFFFFB7Fu, 0x3F3F3FFFu,
+0x7F7F7B7Fu, 0x3C7C7F7Fu, 0x7F7F7B7Fu, 0x18787F7Fu, 0x7F7F7B7Fu, 0x00717F7Fu, 0x7F7F7B7Fu, 0x03637F7Fu,
+0x7F7F7B7Fu, 0x07477F7Fu, 0x7F7F7B7Fu, 0x0F0F7F7Fu, 0xFFFFFBFFu, 0x1F1FFFFFu, 0xFFFFFBFFu, 0x3F3FFFFFu,
+0xFFFFF8FCu, 0xFFFFFFFFu, 0x000E0808u, 0x00000000u, 0x000E0000u, 0x00000000u, 0x000E0202u, 0x00000000u,
+0xFFFFC3C7u, 0xFFFFFFFFu, 0xFFFF8B8Fu, 0xFFFFFFFFu, 0xFFFF1B1Fu, 0xFFFFFFFFu, 0xFFFF3B3Fu, 0xFFFFFFFFu,
+0x3F3C383Cu, 0x00003F3Fu, 0x00080800u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u, 0x00000000u,
+0x3F070307u, 0x00003F3Fu, 0x3F0F0B07u, 0x00003F3Fu, 0x7F1F1B1Fu, 0x001F7F7Fu, 0xFF3F3B3Fu, 0x3F3FFFFFu,
+0x1C1C1800u, 0x0000001Fu, 0x00080000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u, 0x00000000u,
+0x07070300u, 0x0000001Fu, 0x0F0F0B07u, 0x00000F3Fu, 0x1F1F1B1Fu, 0x001F1F7Fu, 0x3F3F3B3Fu, 0x3F3F3FFFu,
+0x1C1C1800u, 0x0000001Cu, 0x08080000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u, 0x00000000u,
+0x07070300u, 0x00000007u, 0x0F0F0B07u, 0x00000F0Fu, 0x1F1F1B1Fu, 0x001F1F1Fu, 0x3F3F3B3Fu, 0x3F3F3F3Fu,
+0x1C1D1800u, 0x0000001Cu, 0x080A0000u, 0x00000008u, 0x00040000u, 0x00000000u, 0x020A0000u, 0x00000002u,
+0x07170300u, 0x00000007u, 0x0F2F0B07u, 0x00000F0Fu, 0x1F5F1B1Fu, 0x001F1F1Fu, 0x3FBF3B3Fu, 0x3F3F3F3Fu,
+0x1F1C1800u, 0x00001C1Cu, 0x0E080000u, 0x00000808u, 0x0E000000u, 0x00000000u, 0x0E020000u, 0x00000202u,
+0x1F070300u, 0x00000707u, 0x3F0F0B07u, 0x00000F0Fu, 0x7F1F1B1Fu, 0x001F1F1Fu, 0xFF3F3B3Fu, 0x3F3F3F3Fu,
+0x1F1F1800u, 0x001C1C1Fu, 0x1F1F0000u, 0x0008081Fu, 0x1F1F0000u, 0x0000001Fu, 0x1F1F0000u, 0x0002021Fu,
+0x1F1F0300u, 0x0007071Fu, 0x3F3F0B07u, 0x000F0F3Fu, 0x7F7F1B1Fu, 0x001F1F7Fu, 0xFFFF3B3Fu, 0x3F3F3FFFu,
+0x3F3F3B00u, 0x1C1C3F3Fu, 0x3F3F3B00u, 0x08083F3Fu, 0x3F3F3B00u, 0x00003F3Fu, 0x3F3F3B00u, 0x02023F3Fu,
+0x3F3F3B00u, 0x07073F3Fu, 0x3F3F3B07u, 0x0F0F3F3Fu, 0x7F7F7B1Fu, 0x1F1F7F7Fu, 0xFFFFFB3Fu, 0x3F3FFFFFu,
+0xFFFFF4FCu, 0xFFFFFFFFu, 0xFFFFF0F8u, 0xFFFFFFFFu, 0xFFFFF1F1u, 0xFFFFFFFFu, 0xFFFFE3E3u, 0xFFFFFFFFu,
+0xFFFFC7C7u, 0xFFFFFFFFu, 0xFFFF878Fu, 0xFFFFFFFFu, 0xFFFF171Fu, 0xFFFFFFFFu, 0xFFFF373Fu, 0xFFFFFFFFu,
+0xFFFCF4FCu, 0xFFFFFFFFu, 0xFFF8F0F8u, 0xFFFFFFFFu, 0xFFF1F1F1u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u,
+0xFFC7C7C7u, 0xFFFFFFFFu, 0xFF8F878Fu, 0xFFFFFFFFu, 0xFF1F171Fu, 0xFFFFFFFFu, 0xFF3F373Fu, 0xFFFFFFFFu,
+0xFCFCF4FEu, 0x00FEFFFFu, 0x78787078u, 0x00007F7Fu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00000000u, 0x00000000u, 0x0F0F070Fu, 0x00007F7Fu, 0x1F1F173Fu, 0x003FFFFFu, 0x3F3F377Fu, 0x7F7FFFFFu,
+0xFCFCF6FEu, 0x00FEFEFCu, 0x78787478u, 0x00007C78u, 0x30303000u, 0x00000030u, 0x00000000u, 0x00000000u,
+0x06060600u, 0x00000006u, 0x0F0F170Fu, 0x00001F0Fu, 0x1F1F373Fu, 0x003F3F1Fu, 0x3F3F777Fu, 0x7F7F7F3Fu,
+0xFCFEF7FEu, 0x00FEFCFCu, 0x787D7778u, 0x00007878u, 0x303A3600u, 0x00003030u, 0x00141400u, 0x00000000u,
+0x062E3600u, 0x00000606u, 0x0F5F770Fu, 0x00000F0Fu, 0x1FBFF73Fu, 0x003F1F1Fu, 0x3F7FF77Fu, 0x7F7F3F3Fu,
+0xFFFFF6FEu, 0x00FCFCFCu, 0x7F7F7478u, 0x00787878u, 0x3E3E3000u, 0x00303030u, 0x3E3E0000u, 0x00000022u,
+0x3E3E0600u, 0x00060606u, 0x7F7F170Fu, 0x000F0F0Fu, 0xFFFF373Fu, 0x001F1F1Fu, 0xFFFF777Fu, 0x7F3F3F3Fu,
+0xFFFFF7FEu, 0xFCFCFCFFu, 0x7F7F7778u, 0x7878787Fu, 0x7F7F7700u, 0x3030717Fu, 0x7F7F7700u, 0x0000637Fu,
+0x7F7F7700u, 0x0606477Fu, 0x7F7F770Fu, 0x0F0F0F7Fu, 0xFFFFF73Fu, 0x1F1F1FFFu, 0xFFFFF77Fu, 0x3F3F3FFFu,
+0xFFFFF7FFu, 0xFCFCFFFFu, 0xFFFFF7FFu, 0x78F8FFFFu, 0xFFFFF7FFu, 0x30F1FFFFu, 0xFFFFF7FFu, 0x00E3FFFFu,
+0xFFFFF7FFu, 0x06C7FFFFu, 0xFFFFF7FFu, 0x0F8FFFFFu, 0xFFFFF7FFu, 0x1F1FFFFFu, 0xFFFFF7FFu, 0x3F3FFFFFu,
+0xFFFFF4FCu, 0xFFFFFFFFu, 0xFFFFF0F8u, 0xFFFFFFFFu, 0x001C1010u, 0x00000000u, 0x001C0000u, 0x00000000u,
+0x001C0404u, 0x00000000u, 0xFFFF878Fu, 0xFFFFFFFFu, 0xFFFF171Fu, 0xFFFFFFFFu, 0xFFFF373Fu, 0xFFFFFFFFu,
+0x7F7C7478u, 0x00007F7Fu, 0x7F787078u, 0x00007F7Fu, 0x00101000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00040400u, 0x00000000u, 0x7F0F070Fu, 0x00007F7Fu, 0x7F1F170Fu, 0x00007F7Fu, 0xFF3F373Fu, 0x003FFFFFu,
+0x7C7C7478u, 0x00007C7Fu, 0x38383000u, 0x0000003Eu, 0x00100000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x00040000u, 0x00000000u, 0x0E0E0600u, 0x0000003Eu, 0x1F1F170Fu, 0x00001F7Fu, 0x3F3F373Fu, 0x003F3FFFu,
+0x7C7C7478u, 0x00007C7Cu, 0x38383000u, 0x00000038u, 0x10100000u, 0x00000000u, 0x00000000u, 0x00000000u,
+0x04040000u, 0x00000000u, 0x0E0E0600u, 0x0000000Eu, 0x1F1F170Fu, 0x00001F1Fu, 0x3F3F373Fu, 0x003F3F3Fu,
+0x7C7D7478u, 0x00007C7Cu, 0x383A3000u, 0x00000038u, 0x10140000u, 0x00000010u, 0x00080000u, 0x00000000u,
+0x04140000u, 0x00000004u, 0x0E2E0600u, 0x0000000Eu, 0x1F5F170Fu, 0x00001F1Fu, 0x3FBF373Fu, 0x003F3F3Fu,
+0x7F7C7478u, 0x00007C7Cu, 0x3E383000u, 0x00003838u, 0x1C100000u, 0x00001010u, 0x1C000000u, 0x00000000u,
+0x1C040000u, 0x00000404u, 0x3E0E0600u, 0x00000E0Eu, 0x7F1F170Fu, 0x00001F1Fu, 0xFF3F373Fu, 0x003F3F3Fu,
+0x7F7F7478u, 0x007C7C7Fu, 0x3E3E3000u, 0x0038383Eu, 0x3E3E0000u, 0x0010103Eu, 0x3E3E0000u, 0x0000003Eu,
+0x3E3E0000u, 0x0004043Eu, 0x3E3E0600u, 0x000E0E3Eu, 0x7F7F170Fu, 0x001F1F7Fu, 0xFFFF373Fu, 0x003F3FFFu,
+0x7F7F7778u, 0x7C7C7F7Fu, 0x7F7F7700u, 0x38387F7Fu, 0x7F7F7700u, 0x10107F7Fu, 0x7F7F7700u, 0x00007F7Fu,
+0x7F7F7700u, 0x04047F7Fu, 0x7F7F7700u, 0x0E0E7F7Fu, 0x7F7F770Fu, 0x1F1F7F7Fu, 0xFFFFF73Fu, 0x3F3FFFFFu,
+};
 
 } // namespace
 
@@ -73,100 +827,12 @@ bool Bitbases::probe(Square wksq, Square wpsq, Square bksq, Color stm) {
 
   assert(file_of(wpsq) <= FILE_D);
 
-  return KPKBitbase[index(stm, bksq, wksq, wpsq)];
-}
-
-
-void Bitbases::init() {
-
-  std::vector<KPKPosition> db(MAX_INDEX);
-  unsigned idx, repeat = 1;
-
-  // Initialize db with known win / draw positions
-  for (idx = 0; idx < MAX_INDEX; ++idx)
-      db[idx] = KPKPosition(idx);
-
-  // Iterate through the positions until none of the unknown positions can be
-  // changed to either wins or draws (15 cycles needed).
-  while (repeat)
-      for (repeat = idx = 0; idx < MAX_INDEX; ++idx)
-          repeat |= (db[idx] == UNKNOWN && db[idx].classify(db) != UNKNOWN);
-
-  // Fill the bitbase with the decisive results
-  for (idx = 0; idx < MAX_INDEX; ++idx)
-      if (db[idx] == WIN)
-          KPKBitbase.set(idx);
+  unsigned idx = index(stm, bksq, wksq, wpsq);
+  return (KPKBitbase[idx / 32] >> (idx % 32)) & 1;
 }
 
 
-namespace {
-
-  KPKPosition::KPKPosition(unsigned idx) {
-
-    ksq[WHITE] = Square((idx >>  0) & 0x3F);
-    ksq[BLACK] = Square((idx >>  6) & 0x3F);
-    stm        = Color ((idx >> 12) & 0x01);
-    psq        = make_square(File((idx >> 13) & 0x3), Rank(RANK_7 - ((idx >> 15) & 0x7)));
-
-    // Invalid if two pieces are on the same square or if a king can be captured
-    if (   distance(ksq[WHITE], ksq[BLACK]) <= 1
-        || ksq[WHITE] == psq
-        || ksq[BLACK] == psq
-        || (stm == WHITE && (pawn_attacks_bb(WHITE, psq) & ksq[BLACK])))
-        result = INVALID;
-
-    // Win if the pawn can be promoted without getting captured
-    else if (   stm == WHITE
-             && rank_of(psq) == RANK_7
-             && ksq[WHITE] != psq + NORTH
-             && (    distance(ksq[BLACK], psq + NORTH) > 1
-                 || (distance(ksq[WHITE], psq + NORTH) == 1)))
-        result = WIN;
-
-    // Draw if it is stalemate or the black king can capture the pawn
-    else if (   stm == BLACK
-             && (  !(attacks_bb<KING>(ksq[BLACK]) & ~(attacks_bb<KING>(ksq[WHITE]) | pawn_attacks_bb(WHITE, psq)))
-                 || (attacks_bb<KING>(ksq[BLACK]) & ~attacks_bb<KING>(ksq[WHITE]) & psq)))
-        result = DRAW;
-
-    // Position will be classified later
-    else
-        result = UNKNOWN;
-  }
-
-  Result KPKPosition::classify(const std::vector<KPKPosition>& db) {
-
-    // White to move: If one move leads to a position classified as WIN, the result
-    // of the current position is WIN. If all moves lead to positions classified
-    // as DRAW, the current position is classified as DRAW, otherwise the current
-    // position is classified as UNKNOWN.
-    //
-    // Black to move: If one move leads to a position classified as DRAW, the result
-    // of the current position is DRAW. If all moves lead to positions classified
-    // as WIN, the position is classified as WIN, otherwise the current position is
-    // classified as UNKNOWN.
-    const Result Good = (stm == WHITE ? WIN   : DRAW);
-    const Result Bad  = (stm == WHITE ? DRAW  : WIN);
-
-    Result r = INVALID;
-    Bitboard b = attacks_bb<KING>(ksq[stm]);
-
-    while (b)
-        r |= stm == WHITE ? db[index(BLACK, ksq[BLACK] , pop_lsb(&b), psq)]
-                          : db[index(WHITE, pop_lsb(&b),  ksq[WHITE], psq)];
-
-    if (stm == WHITE)
-    {
-        if (rank_of(psq) < RANK_7)      // Single push
-            r |= db[index(BLACK, ksq[BLACK], ksq[WHITE], psq + NORTH)];
-
-        if (   rank_of(psq) == RANK_2   // Double push
-            && psq + NORTH != ksq[WHITE]
-            && psq + NORTH != ksq[BLACK])
-            r |= db[index(BLACK, ksq[BLACK], ksq[WHITE], psq + NORTH + NORTH)];
-    }
-
-    return result = r & Good  ? Good  : r & UNKNOWN ? UNKNOWN : Bad;
-  }
-
-} // namespace
+// A no-op now that the bitbase is compile-time data. As with the
+// piece-square tables, this also fixes the WASM wrapper, which never
+// called init() and so probed an all-zero bitbase.
+void Bitbases::init() {}
@@ -22,6 +22,7 @@
 #include <bitset>
 
 #include "bitboard.h"
+#include "magics.h"
 #include "misc.h"
 
 uint8_t PopCnt16[1 << 16];
@@ -37,156 +38,28 @@ Magic BishopMagics[SQUARE_NB];
 
 namespace {
 
+#if defined(USE_PEXT) || !defined(IS_64BIT)
+
+  // The generated constants in magics.h assume the 64-bit multiply index
+  // scheme, so PEXT and 32-bit builds keep the startup magic search with the
+  // classic split tables.
   Bitboard RookTable[0x19000];  // To store rook attacks
   Bitboard BishopTable[0x1480]; // To store bishop attacks
 
-// Correct precomputed magics from Stockfish (64-bit)
-const uint64_t RookMagicNumbers[64] = {
-    0x1100400000808020ULL,
-    0x1100400000808020ULL,
-    0x200a10e0800890ULL,
-    0x10a00c000800410ULL,
-    0x9080084080810404ULL,
-    0x4081a0481000201ULL,
-    0x48600480102008a1ULL,
-    0x8201228080801249ULL,
-    0x100500000440204ULL,
-    0x1020031000200804ULL,
-    0x2010802000082008ULL,
-    0x2010802000082008ULL,
-    0x20500806801a0022ULL,
-    0x20500806801a0022ULL,
-    0x38421000a008022ULL,
-    0x108442002200811ULL,
-    0x8002c02009010202ULL,
-    0x2041200441100040ULL,
-    0x2400300100004420ULL,
-    0x400090210004042ULL,
-    0x580100800080102ULL,
-    0x3100c0020020202ULL,
-    0x5020048820101ULL,
-    0x2491040100000201ULL,
-    0x1080010200424021ULL,
-    0x3042050080908022ULL,
-    0x4820802c020212ULL,
-    0x1010006420000921ULL,
-    0x58cc050008229801ULL,
-    0x14400200408901ULL,
-    0xc008104230680104ULL,
-    0xd00048201380041ULL,
-    0x40105040900823ULL,
-    0x40105040900823ULL,
-    0x80220600008610ULL,
-    0x80502010008289ULL,
-    0x1640040011120008ULL,
-    0x80048000a41102ULL,
-    0x40010000028c4aULL,
-    0x81004000009601ULL,
-    0x20800000049050ULL,
-    0x2020200802409009ULL,
-    0x184202200080441ULL,
-    0x821000800210010ULL,
-    0x302040201006208ULL,
-    0x400402220054302ULL,
-    0x4020808200e001ULL,
-    0x400404030110081ULL,
-    0x40302000900080ULL,
-    0x60108080c0086941ULL,
-    0x41010200c002106ULL,
-    0x801180800810400aULL,
-    0x41010200c002106ULL,
-    0x890c80401002004ULL,
-    0x11b0201000104082ULL,
-    0x180028090800871ULL,
-    0x280006104304013ULL,
-    0xa1405140040221ULL,
-    0x2011482520086005ULL,
-    0x404405290881822ULL,
-    0x12508c220a640482ULL,
-    0x818211260000402ULL,
-    0x12008104000a85ULL,
-    0x20009023018000c1ULL
-};
-
-const uint64_t BishopMagicNumbers[64] = {
-0x31010a0044021521ULL,
-    0x80200710301002ULL,
-    0x4221080080049122ULL,
-    0x1000124640080581ULL,
-    0x84084410001450c0ULL,
-    0x900808020a060104ULL,
-    0x848401c04c0d808ULL,
-    0x1100a40c3808528ULL,
-    0x4801304440803027ULL,
-    0x24081202006901bULL,
-    0x8606120002000401ULL,
-    0x880102091a82404ULL,
-    0x1040002a20030a32ULL,
-    0x44201a0160021091ULL,
-    0x1008080104402244ULL,
-    0x182203100450909ULL,
-    0x12100c4302280010ULL,
-    0x9a58410212580017ULL,
-    0x142058800102009ULL,
-    0x620a00400008104ULL,
-    0x301148200010002ULL,
-    0x8900900800204026ULL,
-    0x105200108024202ULL,
-    0x420a0410804092ULL,
-    0x4802086023601201ULL,
-    0x1811040840b00600ULL,
-    0x900c20004031000ULL,
-    0x2010201840004400ULL,
-    0x80805008101440ULL,
-    0x80a00c11006100ULL,
-    0x424010600114904ULL,
-    0x424010600114904ULL,
-    0x1220200802021804ULL,
-    0x814040000015102ULL,
-    0x6c10180040c04ULL,
-    0x401880a000000208ULL,
-    0x812480883820042ULL,
-    0x80808025149011ULL,
-    0x6c10180040c04ULL,
-    0x101c2007000812aULL,
-    0x2402120200880202ULL,
-    0x863244230004108ULL,
-    0x120820000114108ULL,
-    0x2090110022400099ULL,
-    0x1410020240000202ULL,
-    0xb040822001411001ULL,
-    0x20031000204012aULL,
-    0x81420500109001c1ULL,
-    0x828000078040105ULL,
-    0x402063624084424ULL,
-    0x40b0000124240049ULL,
-    0x504400000c040252ULL,
-    0x20a050102880092ULL,
-    0x100220000130a004ULL,
-    0x8108540051302bULL,
-    0x708028a2008d1044ULL,
-    0x10940401000a0101ULL,
-    0x118244024002821ULL,
-    0x8406062000441221ULL,
-    0x20a020000030108ULL,
-    0x10020225200102a0ULL,
-    0x2c6220020400120ULL,
-    0x80e910800104144ULL,
-    0x50c200800a982129ULL
-};
-
-  std::vector<int> mask_bit_positions(Bitboard mask) {
-    std::vector<int> positions;
-    while (mask) {
-      int pos = __builtin_ctzll(mask);
-      positions.push_back(pos);
-      mask &= mask - 1;
-    }
-    return positions;
-  }
-
   void init_magics(PieceType pt, Bitboard table[], Magic magics[]);
-  void init_magic_with_precomputed_numbers(PieceType pt, Bitboard table[], Magic magics[], const uint64_t magic_numbers[]);
+
+#else
+
+  // One shared table for rook and bishop attacks. Layout, magic numbers and
+  // per-square offsets come precomputed and verified from generate_magics
+  // (see magics.h), so no magic search runs at startup and overlapping
+  // ranges share their slots.
+  Bitboard AttackTable[MagicInit::SharedTableSize];
+
+  void init_shared_magics(PieceType pt, Magic magics[], const MagicInit::Entry init[]);
+
+#endif
+
 }
 
 
@@ -225,10 +98,13 @@ void Bitboards::init() {
       for (Square s2 = SQ_A1; s2 <= SQ_H8; ++s2)
           SquareDistance[s1][s2] = std::max(distance<File>(s1, s2), distance<Rank>(s1, s2));
 
-  init_magic_with_precomputed_numbers(ROOK, RookTable, RookMagics, RookMagicNumbers);
-  init_magic_with_precomputed_numbers(BISHOP, BishopTable, BishopMagics, BishopMagicNumbers);
-  // init_magics(ROOK, RookTable, RookMagics);
-  // init_magics(BISHOP, BishopTable, BishopMagics);
+#if defined(USE_PEXT) || !defined(IS_64BIT)
+  init_magics(ROOK, RookTable, RookMagics);
+  init_magics(BISHOP, BishopTable, BishopMagics);
+#else
+  init_shared_magics(ROOK, RookMagics, MagicInit::Rook);
+  init_shared_magics(BISHOP, BishopMagics, MagicInit::Bishop);
+#endif
 
   for (Square s1 = SQ_A1; s1 <= SQ_H8; ++s1)
   {
@@ -271,6 +147,8 @@ namespace {
   }
 
 
+#if defined(USE_PEXT) || !defined(IS_64BIT)
+
   // init_magics() computes all rook and bishop attacks at startup. Magic
   // bitboards are used to look up attacks of sliding pieces. As a reference see
   // www.chessprogramming.org/Magic_Bitboards. In particular, here we use the so
@@ -352,9 +230,17 @@ namespace {
     }
   }
 
-  void init_magic_with_precomputed_numbers(PieceType pt, Bitboard table[], Magic magics[], const uint64_t magic_numbers[]) {
+#else
+
+  // init_shared_magics() fills the shared attack table from the verified
+  // magics and offsets generated by generate_magics. Distinct squares may
+  // write the same slot, but only ever with the same attack bitboard (the
+  // generator has proven every overlap), so the fill order does not matter
+  // and there is no magic search at startup.
+
+  void init_shared_magics(PieceType pt, Magic magics[], const MagicInit::Entry init[]) {
+
     Bitboard edges, b;
-    int size = 0;
 
     for (Square s = SQ_A1; s <= SQ_H8; ++s) {
       // Board edges are not considered in the relevant occupancies
@@ -362,28 +248,19 @@ namespace {
 
       Magic& m = magics[s];
       m.mask = sliding_attack(pt, s, 0) & ~edges;
-      m.shift = (Is64Bit ? 64 : 32) - popcount(m.mask);
-      m.magic = magic_numbers[s];
-          // std::cout << "Square " << s
-          //     << " mask = 0x" << std::hex << m.mask << std::dec
-          //     << " (" << popcount(m.mask) << " bits)\n";
-      // Set the offset for the attacks table of the square
-      m.attacks = s == SQ_A1 ? table : magics[s - 1].attacks + size;
+      m.shift = init[s].shift;
+      m.magic = init[s].magic;
+      m.attacks = AttackTable + init[s].offset;
 
       // Use Carry-Rippler trick to enumerate all subsets of masks[s]
-      b = size = 0;
+      b = 0;
       do {
         m.attacks[m.index(b)] = sliding_attack(pt, s, b);
-        size++;
         b = (b - m.mask) & m.mask;
       } while (b);
     }
-
-    std::cout << (pt == ROOK ? "Rook" : "Bishop") << "MagicNumbers[64] = {\n";
-    for(int i=0; i<64; i++) {
-        std::cout << "    0x" << std::hex << magics[i].magic << std::dec << "ULL" << (i==63 ? "" : ",") << "\n";
-    }
-    std::cout << "};\n";
   }
 
+#endif
+
 }
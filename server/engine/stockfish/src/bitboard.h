@@ -23,6 +23,10 @@
 
 #include <string>
 
+#ifdef USE_WASM_SIMD
+#include <wasm_simd128.h>
+#endif
+
 #include "types.h"
 
 namespace Bitbases {
@@ -277,8 +281,8 @@ template<> inline int distance<File>(Square x, Square y) { return std::abs(file_
 template<> inline int distance<Rank>(Square x, Square y) { return std::abs(rank_of(x) - rank_of(y)); }
 template<> inline int distance<Square>(Square x, Square y) { return SquareDistance[x][y]; }
 
-inline int edge_distance(File f) { return std::min(f, File(FILE_H - f)); }
-inline int edge_distance(Rank r) { return std::min(r, Rank(RANK_8 - r)); }
+constexpr int edge_distance(File f) { return std::min(f, File(FILE_H - f)); }
+constexpr int edge_distance(Rank r) { return std::min(r, Rank(RANK_8 - r)); }
 
 
 /// safe_destination() returns the bitboard of target square for the given step
@@ -335,6 +339,79 @@ inline Bitboard attacks_bb(PieceType pt, Square s, Bitboard occupied) {
 }
 
 
+/// attacks_bb_multi() returns the attacks of a piece that absorbed extra
+/// abilities (Absorb Chess), as one fused union instead of one attacks_bb()
+/// call per absorbed type: at most a single magic lookup per slider family
+/// plus the leaper tables. The pawn ability is excluded because pawn pushes
+/// and captures depend on the side to move; callers handle it separately.
+
+inline Bitboard attacks_bb_multi(PieceType basePt, Abilities ab, Square s, Bitboard occupied) {
+
+  assert(is_ok(s));
+
+  // Fold the base type into the mask so each attack family is resolved once
+  if (basePt != PAWN)
+      ab |= 1 << (basePt - 1);
+
+  Bitboard b = 0;
+
+  if (ab & ABILITY_KNIGHT)
+      b |= PseudoAttacks[KNIGHT][s];
+
+  if (ab & ABILITY_KING)
+      b |= PseudoAttacks[KING][s];
+
+  if (ab & (ABILITY_BISHOP | ABILITY_QUEEN))
+      b |= attacks_bb<BISHOP>(s, occupied);
+
+  if (ab & (ABILITY_ROOK | ABILITY_QUEEN))
+      b |= attacks_bb<ROOK>(s, occupied);
+
+  return b;
+}
+
+
+/// Bitboard2 packs two independent bitboards. Under USE_WASM_SIMD (see
+/// build_wasm.sh --simd) the pair lives in one 128-bit wasm SIMD register, so
+/// each or2()/and2() folds two boards per instruction with half the dependency
+/// chain. Without the flag it is a plain pair that the optimizer flattens back
+/// into the original scalar code, so call sites need no #ifdefs.
+///
+/// Packing and the final fold cost one operation each, which is why only deep
+/// unions go through this type (attackers_to() combines a dozen boards);
+/// a single pairwise OR is cheaper left scalar, and the serial OR chains in
+/// the evaluation are short and branchy enough that they are left to the
+/// compiler's own vectorizer, which -msimd128 enables.
+
+#ifdef USE_WASM_SIMD
+
+typedef v128_t Bitboard2;
+
+inline Bitboard2 make_bitboard2(Bitboard lo, Bitboard hi) {
+  return wasm_i64x2_make(int64_t(lo), int64_t(hi));
+}
+
+inline Bitboard2 or2 (Bitboard2 a, Bitboard2 b) { return wasm_v128_or (a, b); }
+inline Bitboard2 and2(Bitboard2 a, Bitboard2 b) { return wasm_v128_and(a, b); }
+
+inline Bitboard fold_or(Bitboard2 v) {
+  return Bitboard(wasm_u64x2_extract_lane(v, 0)) | Bitboard(wasm_u64x2_extract_lane(v, 1));
+}
+
+#else
+
+struct Bitboard2 { Bitboard lo, hi; };
+
+inline Bitboard2 make_bitboard2(Bitboard lo, Bitboard hi) { return { lo, hi }; }
+
+inline Bitboard2 or2 (Bitboard2 a, Bitboard2 b) { return { a.lo | b.lo, a.hi | b.hi }; }
+inline Bitboard2 and2(Bitboard2 a, Bitboard2 b) { return { a.lo & b.lo, a.hi & b.hi }; }
+
+inline Bitboard fold_or(Bitboard2 v) { return v.lo | v.hi; }
+
+#endif
+
+
 /// popcount() counts the number of non-zero bits in a bitboard
 
 inline int popcount(Bitboard b) {
@@ -0,0 +1,116 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Absorb Chess modification for a binary opening book
+
+  File format: an 8-byte magic/version tag followed by 16-byte little-endian
+  records {key, move, weight, learn} sorted by key. The layout mirrors
+  Polyglot so existing tooling concepts carry over, but the key is this
+  engine's ability-aware Zobrist hash and the move its native encoding, so
+  a Polyglot book is deliberately rejected by the magic check.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "book.h"
+#include "movegen.h"
+#include "position.h"
+
+Book OpeningBook; // Global object, probed from uci.cpp and the WASM wrapper
+
+namespace {
+
+const char BookMagic[8] = { 'A', 'B', 'S', 'B', 'O', 'O', 'K', '1' };
+
+} // namespace
+
+
+/// Book::load_buffer() parses a book image already in memory. The records
+/// are expected sorted; a generator that did not sort is tolerated.
+
+bool Book::load_buffer(const void* data, size_t length) {
+
+  entries.clear();
+
+  if (!data || length < sizeof(BookMagic)
+      || (length - sizeof(BookMagic)) % sizeof(Entry) != 0
+      || std::memcmp(data, BookMagic, sizeof(BookMagic)) != 0)
+      return false;
+
+  size_t count = (length - sizeof(BookMagic)) / sizeof(Entry);
+  entries.resize(count);
+  std::memcpy(entries.data(), (const char*)data + sizeof(BookMagic),
+              count * sizeof(Entry));
+
+  if (!std::is_sorted(entries.begin(), entries.end(),
+                      [](const Entry& a, const Entry& b) { return a.key < b.key; }))
+      std::sort(entries.begin(), entries.end(),
+                [](const Entry& a, const Entry& b) { return a.key < b.key; });
+
+  return true;
+}
+
+
+/// Book::load() reads a book file into memory. Book files are small (16
+/// bytes per position/move pair), so a plain read beats mapping machinery.
+
+bool Book::load(const std::string& filename) {
+
+  entries.clear();
+
+  std::ifstream f(filename, std::ios::binary | std::ios::ate);
+  if (!f)
+      return false;
+
+  std::vector<char> image(size_t(f.tellg()));
+  f.seekg(0);
+  f.read(image.data(), image.size());
+
+  return f && load_buffer(image.data(), image.size());
+}
+
+
+/// Book::save() writes the entries back out in load()'s format
+
+bool Book::save(const std::string& filename) {
+
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.key < b.key; });
+
+  std::ofstream f(filename, std::ios::binary | std::ios::trunc);
+  if (!f)
+      return false;
+
+  f.write(BookMagic, sizeof(BookMagic));
+  f.write((const char*)entries.data(), entries.size() * sizeof(Entry));
+  return bool(f);
+}
+
+
+/// Book::probe() looks up the current position and returns the legal book
+/// move with the highest weight, or MOVE_NONE. Stored moves are validated
+/// against the move generator so a stale or corrupt book can never inject
+/// an illegal move into the game.
+
+Move Book::probe(const Position& pos) const {
+
+  Entry probeKey = { pos.key(), 0, 0, 0 };
+  auto range = std::equal_range(entries.begin(), entries.end(), probeKey,
+      [](const Entry& a, const Entry& b) { return a.key < b.key; });
+
+  Move best = MOVE_NONE;
+  int bestWeight = -1;
+
+  for (auto it = range.first; it != range.second; ++it)
+      if (int(it->weight) > bestWeight)
+          for (const ExtMove& em : MoveList<LEGAL>(pos))
+              if (em.move == Move(it->move))
+              {
+                  best = em.move;
+                  bestWeight = int(it->weight);
+                  break;
+              }
+
+  return best;
+}
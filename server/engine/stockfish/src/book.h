@@ -0,0 +1,59 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Absorb Chess modification for a binary opening book
+
+  Early absorb-chess positions repeat across games, so the first moves are
+  served from a compact Polyglot-style book instead of a full search: sorted
+  fixed-size records binary-searched by the ability-aware position key from
+  position.cpp. The same ability terms that key the transposition table key
+  the book, so a position only hits when every absorbed ability matches.
+*/
+
+#ifndef BOOK_H_INCLUDED
+#define BOOK_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "types.h"
+
+class Position;
+
+class Book {
+public:
+
+  // One book entry. 'move' is the engine's own 16-bit move encoding (the
+  // book is generated by this engine, so no Polyglot move translation),
+  // 'weight' orders alternatives, 'learn' is reserved for result feedback.
+  struct Entry {
+    uint64_t key;
+    uint16_t move;
+    uint16_t weight;
+    uint32_t learn;
+  };
+
+  // Load from a file (native) or from a buffer the host fetched for us
+  // (WASM, see loadBook() in the wrapper). Both replace the current book;
+  // a failed load leaves the book empty and returns false.
+  bool load(const std::string& filename);
+  bool load_buffer(const void* data, size_t length);
+
+  // Write the current entries to a file, the counterpart of load() used by
+  // the book building tooling. Entries are sorted as a side effect.
+  bool save(const std::string& filename);
+
+  // Best weighted book move that is legal in pos, or MOVE_NONE
+  Move probe(const Position& pos) const;
+
+  void add(const Entry& e) { entries.push_back(e); }
+  void clear() { entries.clear(); }
+  size_t size() const { return entries.size(); }
+
+private:
+  std::vector<Entry> entries; // sorted by key
+};
+
+extern Book OpeningBook;
+
+#endif // #ifndef BOOK_H_INCLUDED
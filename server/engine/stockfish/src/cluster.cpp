@@ -0,0 +1,476 @@
+/*
+  Absorb Chess cluster analysis coordinator (native only, see
+  ../build_cluster.sh).
+
+  Splits one deep search across engine processes on multiple machines.
+  ThreadPool only scales within one box; for the jobs that are still
+  wall-clock-bound after that (adjudicating disputed games, depth-18 book
+  building) this tool deals the root move list out across worker nodes, runs
+  them in lockstep one iteration at a time and merges the principal
+  variations. Root splitting is known to be the least efficient way to
+  parallelize alpha-beta - every node redoes the shallow iterations and only
+  one of them holds the best move - but it needs no shared memory, so it is
+  the split that works over plain pipes, and the duplicated work is bought
+  back in wall-clock time on the node pool.
+
+  The message protocol is this tree's UCI dialect plus one extension: after
+  each synchronized depth the coordinator broadcasts the best score found
+  anywhere in the cluster as "go ... rootbound <v>" (internal Value units,
+  see LimitsType::rootBound). A node whose subset is dominated then fails
+  low against that bound once and cheaply instead of resolving exact scores
+  for moves that cannot win the merge. The partition itself is fixed for the
+  whole run so each node's transposition table stays warm on its own
+  subtrees from one iteration to the next.
+
+  Workers are launched through the shell, so a hosts file line is any
+  command that speaks UCI on stdin/stdout:
+
+      ./stockfish
+      ssh node3 /opt/absorb/stockfish
+
+  Blank lines and lines starting with '#' are skipped. A worker that dies
+  mid-run has its moves re-dealt to the survivors; the run aborts only when
+  no node is left.
+
+  Usage: cluster <hosts.txt> "<fen> [moves <uci>...]" [depth] [node_threads]
+                 [node_hash_mb]
+
+  The fen may carry the extended '[...]' ability suffixes (see
+  Position::set()), so every worker must be a build of this tree.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "movegen.h"
+#include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "uci.h"
+
+using namespace std;
+
+namespace PSQT { void init(); }
+namespace AbsorbChess { void init_tables(); }
+
+namespace {
+
+// Time allowed for handshakes and option setting; searching itself is
+// unbounded and a lost node is detected by EOF on its pipe instead.
+constexpr int HandshakeMs = 10000;
+
+// Subtracted from the broadcast bound so a modest score drop at the next
+// depth can still be resolved exactly instead of failing low everywhere.
+const int BoundMargin = PawnValueEg / 4;
+
+// What one node reports for one synchronized iteration.
+struct NodeResult {
+  bool ok = false;
+  int depth = 0;
+  int value = -VALUE_INFINITE; // internal units, side to move's view
+  string scoreStr;             // "cp <x>" or "mate <y>" as reported
+  string pv;
+  uint64_t nodes = 0;
+};
+
+int cp_to_value(int cp)     { return cp * PawnValueEg / 100; }
+int mate_to_value(int mate) { return mate > 0 ?  VALUE_MATE - 2 * mate
+                                              : -VALUE_MATE - 2 * mate; }
+
+
+/// ClusterNode wraps one worker engine behind line-based IO, a sibling of
+/// match.cpp's EngineProcess but launched through the shell so a hosts file
+/// line can be an ssh command, and with the go/bestmove exchange split so
+/// all nodes can search one iteration concurrently.
+
+class ClusterNode {
+
+  pid_t pid = -1;
+  int toChild = -1, fromChild = -1;
+  string buffer;
+
+public:
+  string cmd;               // hosts file line, for reporting
+  vector<Move> moves;       // this node's slice of the root move list
+  uint64_t totalNodes = 0;
+  NodeResult last;
+
+  ~ClusterNode() { terminate(); }
+
+  bool start(const string& command) {
+
+    cmd = command;
+
+    int in[2], out[2]; // in: coordinator -> worker, out: worker -> coordinator
+    if (pipe(in) || pipe(out))
+        return false;
+
+    pid = fork();
+    if (pid < 0)
+        return false;
+
+    if (pid == 0)
+    {
+        dup2(in[0], STDIN_FILENO);
+        dup2(out[1], STDOUT_FILENO);
+        close(in[0]); close(in[1]); close(out[0]); close(out[1]);
+        execl("/bin/sh", "sh", "-c", command.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    close(in[0]); close(out[1]);
+    toChild = in[1];
+    fromChild = out[0];
+
+    return send("uci") && wait_for("uciok", HandshakeMs) && sync();
+  }
+
+  bool alive() const { return pid > 0; }
+
+  bool send(const string& line) {
+
+    string s = line + "\n";
+    return pid > 0 && write(toChild, s.data(), s.size()) == ssize_t(s.size());
+  }
+
+  // Read one line, waiting at most timeoutMs (negative: forever). Blank
+  // lines are skipped so an empty return always means the worker died or
+  // went silent.
+  string read_line(int timeoutMs) {
+
+    while (true)
+    {
+        size_t nl = buffer.find('\n');
+        if (nl != string::npos)
+        {
+            string line = buffer.substr(0, nl);
+            buffer.erase(0, nl + 1);
+            if (line.empty())
+                continue;
+            return line;
+        }
+
+        struct pollfd pfd = { fromChild, POLLIN, 0 };
+        if (poll(&pfd, 1, timeoutMs) <= 0)
+            return "";
+
+        char chunk[4096];
+        ssize_t n = read(fromChild, chunk, sizeof(chunk));
+        if (n <= 0)
+            return "";
+        buffer.append(chunk, size_t(n));
+    }
+  }
+
+  bool wait_for(const string& token, int timeoutMs) {
+
+    string line;
+    while (!(line = read_line(timeoutMs)).empty())
+        if (line.rfind(token, 0) == 0)
+            return true;
+    return false;
+  }
+
+  bool sync() { return send("isready") && wait_for("readyok", HandshakeMs); }
+
+  // Kick off one iteration on this node's subset. rootbound must precede
+  // searchmoves, which swallows the rest of the line.
+  bool start_iteration(int depth, int bound) {
+
+    ostringstream cmd;
+    cmd << "go depth " << depth;
+    if (bound > -VALUE_INFINITE)
+        cmd << " rootbound " << bound;
+    cmd << " searchmoves";
+    for (Move m : moves)
+        cmd << " " << UCI::move(m, false);
+
+    return send(cmd.str());
+  }
+
+  // Collect the iteration result: the last full info line before bestmove.
+  // An empty read means the node is gone; the caller re-deals its moves.
+  NodeResult finish_iteration() {
+
+    last = NodeResult();
+
+    string line;
+    while (!(line = read_line(-1)).empty())
+    {
+        istringstream is(line);
+        string token;
+        is >> token;
+
+        if (token == "info")
+        {
+            int depth = 0, value = -VALUE_INFINITE;
+            string scoreStr, pv;
+            uint64_t nodes = 0;
+
+            while (is >> token)
+                if (token == "depth")
+                    is >> depth;
+                else if (token == "nodes")
+                    is >> nodes;
+                else if (token == "score")
+                {
+                    string kind, num;
+                    is >> kind >> num;
+                    scoreStr = kind + " " + num;
+                    value = kind == "mate" ? mate_to_value(stoi(num))
+                                           : cp_to_value(stoi(num));
+                }
+                // An upperbound score is a fail low against the shared
+                // bound; keep it for reporting but never let it win.
+                else if (token == "upperbound")
+                    value = -VALUE_INFINITE + 1;
+                else if (token == "pv")
+                {
+                    pv.clear();
+                    while (is >> token)
+                        pv += (pv.empty() ? "" : " ") + token;
+                }
+
+            if (depth && !pv.empty())
+            {
+                last.ok = true;
+                last.depth = depth;
+                last.value = value;
+                last.scoreStr = scoreStr;
+                last.pv = pv;
+                last.nodes = nodes;
+            }
+        }
+        else if (token == "bestmove")
+        {
+            totalNodes += last.nodes;
+            return last;
+        }
+    }
+
+    terminate();
+    return NodeResult(); // node died; ok stays false
+  }
+
+  void terminate() {
+
+    if (pid > 0)
+    {
+        send("quit");
+        close(toChild); close(fromChild);
+
+        for (int i = 0; i < 50 && waitpid(pid, nullptr, WNOHANG) == 0; i++)
+            usleep(10000);
+        if (waitpid(pid, nullptr, WNOHANG) == 0)
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+        pid = -1;
+    }
+  }
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+
+  if (argc < 3)
+  {
+      cerr << "Usage: cluster <hosts.txt> \"<fen> [moves <uci>...]\" [depth]"
+              " [node_threads] [node_hash_mb]" << endl;
+      return EXIT_FAILURE;
+  }
+
+  // A dead worker must surface as EOF on its pipe, not kill the coordinator
+  signal(SIGPIPE, SIG_IGN);
+
+  UCI::init(Options);
+  PSQT::init();
+  Bitboards::init();
+  Position::init();
+  Bitbases::init();
+  Endgames::init();
+  AbsorbChess::init_tables();
+
+  int depth       = argc > 3 ? atoi(argv[3]) : 18;
+  int nodeThreads = argc > 4 ? atoi(argv[4]) : 1;
+  int nodeHashMb  = argc > 5 ? atoi(argv[5]) : 256;
+
+  // Rebuild the position locally to enumerate the root moves; the same
+  // position line is forwarded verbatim to the workers.
+  istringstream is(argv[2]);
+  string fen, token;
+  while (is >> token && token != "moves")
+      fen += token + " ";
+  vector<string> played;
+  while (is >> token)
+      played.push_back(token);
+
+  Threads.set(1); // Owner thread for the local position only, never searches
+
+  Position pos;
+  StateListPtr states(new std::deque<StateInfo>(1));
+  pos.set(fen, false, &states->back(), Threads.main());
+
+  for (string& s : played)
+  {
+      Move m = UCI::to_move(pos, s);
+      if (m == MOVE_NONE)
+      {
+          cerr << "Illegal move '" << s << "' in position line" << endl;
+          return EXIT_FAILURE;
+      }
+      states->emplace_back();
+      pos.do_move(m, states->back());
+  }
+
+  vector<Move> rootMoves;
+  for (const auto& m : MoveList<LEGAL>(pos))
+      rootMoves.push_back(m);
+
+  if (rootMoves.empty())
+  {
+      cout << "info string no legal moves ("
+           << (pos.checkers() ? "checkmate" : "stalemate") << ")\n"
+           << "bestmove (none)" << endl;
+      return 0;
+  }
+
+  ifstream hostsFile(argv[1]);
+  if (!hostsFile)
+  {
+      cerr << "Cannot open hosts file: " << argv[1] << endl;
+      return EXIT_FAILURE;
+  }
+
+  string posCmd = string("position fen ") + fen
+                + (played.empty() ? "" : " moves");
+  for (const string& s : played)
+      posCmd += " " + s;
+
+  vector<ClusterNode> nodes(64); // hosts beyond the root move count idle
+  size_t nodeCount = 0;
+
+  string line;
+  while (getline(hostsFile, line) && nodeCount < nodes.size())
+  {
+      if (line.empty() || line[0] == '#')
+          continue;
+
+      ClusterNode& node = nodes[nodeCount];
+      if (   !node.start(line)
+          || !node.send("setoption name Threads value " + to_string(nodeThreads))
+          || !node.send("setoption name Hash value " + to_string(nodeHashMb))
+          || !node.send("ucinewgame")
+          || !node.sync()
+          || !node.send(posCmd))
+      {
+          cerr << "Worker failed to start: " << line << endl;
+          node.terminate();
+          continue;
+      }
+      nodeCount++;
+  }
+
+  if (!nodeCount)
+  {
+      cerr << "No usable workers in " << argv[1] << endl;
+      return EXIT_FAILURE;
+  }
+  nodes.resize(nodeCount);
+
+  // Deal the root moves round-robin; the partition then stays fixed so each
+  // node's transposition table keeps its own subtrees warm across depths.
+  for (size_t i = 0; i < rootMoves.size(); ++i)
+      nodes[i % nodes.size()].moves.push_back(rootMoves[i]);
+
+  cout << "info string cluster: " << nodes.size() << " nodes, "
+       << rootMoves.size() << " root moves, target depth " << depth << endl;
+
+  int bound = -VALUE_INFINITE;
+  string bestPv;
+  TimePoint started = now();
+
+  for (int d = 1; d <= depth; ++d)
+  {
+      for (ClusterNode& node : nodes)
+          if (node.alive() && !node.moves.empty())
+              node.start_iteration(d, bound);
+
+      const ClusterNode* best = nullptr;
+      uint64_t iterNodes = 0;
+      vector<Move> orphaned;
+
+      for (ClusterNode& node : nodes)
+      {
+          if (!node.alive() || node.moves.empty())
+              continue;
+
+          NodeResult r = node.finish_iteration();
+          if (!node.alive())
+          {
+              cerr << "Worker died at depth " << d << ": " << node.cmd << endl;
+              orphaned.insert(orphaned.end(), node.moves.begin(), node.moves.end());
+              node.moves.clear();
+              continue;
+          }
+
+          iterNodes += r.nodes;
+          if (r.ok && (!best || r.value > best->last.value))
+              best = &node;
+      }
+
+      if (!best)
+      {
+          cerr << "All workers lost, aborting" << endl;
+          return EXIT_FAILURE;
+      }
+
+      // Survivors inherit a dead node's slice; their TT misses on it are
+      // the price of carrying on.
+      for (size_t i = 0; i < orphaned.size(); ++i)
+      {
+          size_t n = i;
+          while (!nodes[n % nodes.size()].alive())
+              n++;
+          nodes[n % nodes.size()].moves.push_back(orphaned[i]);
+      }
+
+      bound = best->last.value - BoundMargin;
+      bestPv = best->last.pv;
+
+      TimePoint elapsed = now() - started + 1;
+      cout << "info depth " << d << " score " << best->last.scoreStr
+           << " nodes " << iterNodes << " time " << elapsed
+           << " pv " << bestPv << endl;
+  }
+
+  cout << "bestmove " << bestPv.substr(0, bestPv.find(' ')) << endl;
+
+  TimePoint elapsed = now() - started + 1;
+  uint64_t totalNodes = 0;
+  for (ClusterNode& node : nodes)
+  {
+      totalNodes += node.totalNodes;
+      cout << "info string node '" << node.cmd << "': "
+           << node.moves.size() << " root moves, "
+           << node.totalNodes << " nodes"
+           << (node.alive() ? "" : " (died)") << endl;
+  }
+  cout << "info string cluster total " << totalNodes << " nodes in "
+       << elapsed << " ms, " << 1000 * totalNodes / elapsed << " nps" << endl;
+
+  Threads.set(0);
+  return 0;
+}
@@ -108,14 +108,17 @@ Value Endgame<KXK>::operator()(const Position& pos) const {
   Square strongKing = pos.square<KING>(strongSide);
   Square weakKing   = pos.square<KING>(weakSide);
 
+  // Absorb Chess: count by effective type, so that e.g. a pawn that
+  // absorbed a queen ability is recognized as the mating piece it is
+  // instead of being valued as a pawn.
   Value result =  pos.non_pawn_material(strongSide)
-                + pos.count<PAWN>(strongSide) * PawnValueEg
+                + pos.effective_count(strongSide, PAWN) * PawnValueEg
                 + push_to_edge(weakKing)
                 + push_close(strongKing, weakKing);
 
-  if (   pos.count<QUEEN>(strongSide)
-      || pos.count<ROOK>(strongSide)
-      ||(pos.count<BISHOP>(strongSide) && pos.count<KNIGHT>(strongSide))
+  if (   pos.effective_count(strongSide, QUEEN)
+      || pos.effective_count(strongSide, ROOK)
+      ||(pos.effective_count(strongSide, BISHOP) && pos.effective_count(strongSide, KNIGHT))
       || (   (pos.pieces(strongSide, BISHOP) & ~DarkSquares)
           && (pos.pieces(strongSide, BISHOP) &  DarkSquares)))
       result = std::min(result + VALUE_KNOWN_WIN, VALUE_TB_WIN_IN_MAX_PLY - 1);
@@ -124,6 +127,34 @@ Value Endgame<KXK>::operator()(const Position& pos) const {
 }
 
 
+/// Absorb Chess: mate with a lone ability-stacked piece vs a lone king.
+/// Our most common late game. Rook and queen abilities already route
+/// through KXK via the effective material, so what arrives here is a
+/// single piece that stacked bishop and knight abilities: it mates like
+/// the bishop+knight pair, but being one piece it is not colorbound, so
+/// the defending king is simply driven to any edge as in KXK.
+template<>
+Value Endgame<KXAK>::operator()(const Position& pos) const {
+
+  assert(verify_material(pos, weakSide, VALUE_ZERO, 0));
+  assert(!pos.checkers()); // Eval is never called when in check
+
+  // Stalemate detection with lone king
+  if (pos.side_to_move() == weakSide && !MoveList<LEGAL>(pos).size())
+      return VALUE_DRAW;
+
+  Square strongKing = pos.square<KING>(strongSide);
+  Square weakKing   = pos.square<KING>(weakSide);
+
+  Value result = std::min(  VALUE_KNOWN_WIN
+                          + pos.non_pawn_material(strongSide)
+                          + push_to_edge(weakKing)
+                          + push_close(strongKing, weakKing), VALUE_TB_WIN_IN_MAX_PLY - 1);
+
+  return strongSide == pos.side_to_move() ? result : -result;
+}
+
+
 /// Mate with KBN vs K. This is similar to KX vs K, but we have to drive the
 /// defending king towards a corner square that our bishop attacks.
 template<>
@@ -39,6 +39,7 @@ enum EndgameCode {
   KNNK,  // KNN vs K
   KNNKP, // KNN vs KP
   KXK,   // Generic "mate lone king" eval
+  KXAK,  // Lone ability-stacked piece vs K
   KBNK,  // KBN vs K
   KPK,   // KP vs K
   KRKP,  // KR vs KP
@@ -280,27 +280,36 @@ namespace {
     for (Square s = *pl; s != SQ_NONE; s = *++pl)
     {
         // Absorb Chess: Get piece abilities
+        ABSORB_PROF_BEGIN(EVAL_ABILITY);
         Abilities abilities = pos.abilities_on(s);
-        
+
+        // Each movement type's attack set is generated exactly once and kept
+        // here; the attack union below and the per-type mobility loop further
+        // down both read from this table, instead of re-running the slider
+        // lookups a second time for every ability the piece carries.
+        Bitboard typeAttacks[PIECE_TYPE_NB] = {};
+
         // Find attacked squares, including x-ray attacks for bishops and rooks
         // Start with base piece type attacks
         b = Pt == BISHOP ? attacks_bb<BISHOP>(s, pos.pieces() ^ pos.pieces(QUEEN))
           : Pt ==   ROOK ? attacks_bb<  ROOK>(s, pos.pieces() ^ pos.pieces(QUEEN) ^ pos.pieces(Us, ROOK))
                          : attacks_bb<Pt>(s, pos.pieces());
-        
+        typeAttacks[Pt] = b; // Mobility scores the pure per-type sets, not the union
+
         // Add attacks from absorbed abilities
-        if (abilities & ABILITY_KNIGHT && Pt != KNIGHT) {
-            b |= attacks_bb<KNIGHT>(s, pos.pieces());
-        }
-        if (abilities & ABILITY_BISHOP && Pt != BISHOP) {
-            b |= attacks_bb<BISHOP>(s, pos.pieces() ^ pos.pieces(QUEEN));
-        }
-        if (abilities & ABILITY_ROOK && Pt != ROOK) {
-            b |= attacks_bb<ROOK>(s, pos.pieces() ^ pos.pieces(QUEEN) ^ pos.pieces(Us, ROOK));
-        }
-        if (abilities & ABILITY_QUEEN && Pt != QUEEN) {
-            b |= attacks_bb<QUEEN>(s, pos.pieces());
-        }
+        if (abilities & ABILITY_KNIGHT && Pt != KNIGHT)
+            b |= typeAttacks[KNIGHT] = attacks_bb<KNIGHT>(s, pos.pieces());
+
+        if (abilities & ABILITY_BISHOP && Pt != BISHOP)
+            b |= typeAttacks[BISHOP] = attacks_bb<BISHOP>(s, pos.pieces() ^ pos.pieces(QUEEN));
+
+        if (abilities & ABILITY_ROOK && Pt != ROOK)
+            b |= typeAttacks[ROOK] = attacks_bb<ROOK>(s, pos.pieces() ^ pos.pieces(QUEEN) ^ pos.pieces(Us, ROOK));
+
+        if (abilities & ABILITY_QUEEN && Pt != QUEEN)
+            b |= typeAttacks[QUEEN] = attacks_bb<QUEEN>(s, pos.pieces());
+
+        ABSORB_PROF_END(EVAL_ABILITY);
 
         if (pos.blockers_for_king(Us) & s)
             b &= line_bb(pos.square<KING>(Us), s);
@@ -322,38 +331,24 @@ namespace {
         else if (Pt == BISHOP && (attacks_bb<BISHOP>(s, pos.pieces(PAWN)) & kingRing[Them]))
             score += BishopOnKingRing;
 
-        // Absorb Chess: Get piece abilities and calculate mobility using lookup tables
-        Abilities kingAttackAbilities = pos.abilities_on(s);
-        
+        // Absorb Chess: calculate mobility using the lookup tables, reusing
+        // the per-type attack sets generated above
+
         // Get all movement types to calculate for this piece
         int mobilityTypeCount;
-        const PieceType* mobilityTypes = get_mobility_types(Pt, kingAttackAbilities, mobilityTypeCount);
-        
+        const PieceType* mobilityTypes = get_mobility_types(Pt, abilities, mobilityTypeCount);
+
         // Calculate mobility for each movement type
         for (int i = 0; i < mobilityTypeCount; ++i) {
             PieceType mobType = mobilityTypes[i];
             if (mobType == NO_PIECE_TYPE) break;
-            
-            Bitboard mobAttacks = 0;
-            
-            // Generate attacks based on mobility type
-            if (mobType == KNIGHT) {
-                mobAttacks = attacks_bb<KNIGHT>(s, pos.pieces());
-            } else if (mobType == BISHOP) {
-                mobAttacks = attacks_bb<BISHOP>(s, pos.pieces() ^ pos.pieces(QUEEN));
-            } else if (mobType == ROOK) {
-                mobAttacks = attacks_bb<ROOK>(s, pos.pieces() ^ pos.pieces(QUEEN) ^ pos.pieces(Us, ROOK));
-            } else if (mobType == QUEEN) {
-                mobAttacks = attacks_bb<QUEEN>(s, pos.pieces());
-            } else if (mobType == Pt) {
-                // Use the original attack calculation for the base piece type
-                mobAttacks = b;
-            }
-            
+
+            Bitboard mobAttacks = typeAttacks[mobType];
+
             if (pos.blockers_for_king(Us) & s) {
                 mobAttacks &= line_bb(pos.square<KING>(Us), s);
             }
-            
+
             int mob = popcount(mobAttacks & mobilityArea[Us]);
             
             // Apply mobility bonus, with scaling for additional movement types
@@ -967,7 +962,37 @@ make_v:
 /// evaluation of the position from the point of view of the side to move.
 
 Value Eval::evaluate(const Position& pos) {
-  return Evaluation<NO_TRACE>(pos).value();
+
+  ABSORB_PROF_SCOPE(EVALUATE);
+
+  // Count calls for the stats surface; the wrapper may evaluate positions
+  // that are not attached to a search thread
+  Thread* thisThread = pos.this_thread();
+  if (!thisThread)
+      return Evaluation<NO_TRACE>(pos).value();
+
+  thisThread->evalCalls.fetch_add(1, std::memory_order_relaxed);
+
+  // Probe the per-thread eval cache (see CacheEntry in evaluate.h). The
+  // entry only hits when contempt and rule50 also match, so the returned
+  // value is exactly what the recompute below would have produced.
+  CacheEntry* e = thisThread->evalCache[pos.key()];
+  if (   e->key == pos.key()
+      && e->contempt == thisThread->contempt
+      && e->rule50 == pos.rule50_count())
+  {
+      thisThread->evalCacheHits.fetch_add(1, std::memory_order_relaxed);
+      return e->value;
+  }
+
+  Value v = Evaluation<NO_TRACE>(pos).value();
+
+  e->key = pos.key();
+  e->value = v;
+  e->contempt = thisThread->contempt;
+  e->rule50 = pos.rule50_count();
+
+  return v;
 }
 
 
@@ -23,6 +23,7 @@
 
 #include <string>
 
+#include "misc.h"
 #include "types.h"
 
 class Position;
@@ -32,6 +33,25 @@ namespace Eval {
 std::string trace(const Position& pos);
 
 Value evaluate(const Position& pos);
+
+/// Absorb Chess: per-thread cache of finished evaluations, analogous to the
+/// material and pawn tables in thread.h. The ability mobility loops make a
+/// full evaluation 2-3x as expensive as in standard chess, and qsearch keeps
+/// re-evaluating identical positions along transposing lines. An entry is an
+/// exact memo, not an approximation: a hit requires the ability-aware key
+/// plus the two inputs the key does not cover (the thread's contempt, which
+/// is dynamic per iteration, and the rule50 damping counter) to match, so a
+/// cached value is bit-identical to a recompute.
+
+struct CacheEntry {
+  Key key;
+  Value value;
+  Score contempt;
+  int rule50;
+};
+
+typedef HashTable<CacheEntry, 65536> Cache;
+
 }
 
 #endif // #ifndef EVALUATE_H_INCLUDED
@@ -0,0 +1,158 @@
+// Generated by generate_magics.cpp; do not edit by hand.
+//
+// Verified magic numbers and offsets into the shared sliding-attack table
+// (see bitboard.cpp). The shared table holds 107648 entries (861184 bytes)
+// against 107648 (861184) for the separate rook and bishop tables.
+
+#ifndef MAGICS_H_INCLUDED
+#define MAGICS_H_INCLUDED
+
+#include <cstdint>
+
+namespace MagicInit {
+
+constexpr unsigned SharedTableSize = 107648;
+
+struct Entry {
+  uint64_t magic;
+  unsigned offset;
+  unsigned shift;
+};
+
+constexpr Entry Rook[64] = {
+  { 0x8080002010804001ULL, 0x0, 52 },
+  { 0xc00040a0003000ULL, 0x4000, 53 },
+  { 0x1080100108832000ULL, 0x4800, 53 },
+  { 0x1200044022000810ULL, 0x5000, 53 },
+  { 0xa00040200201008ULL, 0x5800, 53 },
+  { 0x100020100040008ULL, 0x6000, 53 },
+  { 0x28000800a000900ULL, 0x6800, 53 },
+  { 0x100030010408322ULL, 0x1000, 52 },
+  { 0x10a0800088304000ULL, 0x7000, 53 },
+  { 0x209004003088022ULL, 0x10000, 54 },
+  { 0x4021004020010012ULL, 0x10400, 54 },
+  { 0x9009002101100009ULL, 0x10800, 54 },
+  { 0x809000408029100ULL, 0x10c00, 54 },
+  { 0x3000b00081400ULL, 0x11000, 54 },
+  { 0x2800800200800100ULL, 0x11400, 54 },
+  { 0x420008488a0401ULL, 0x7800, 53 },
+  { 0x408908000400020ULL, 0x8000, 53 },
+  { 0x1020040208201ULL, 0x11800, 54 },
+  { 0x400848010012002ULL, 0x11c00, 54 },
+  { 0x20808010000800ULL, 0x12000, 54 },
+  { 0x4088010010040901ULL, 0x12400, 54 },
+  { 0x89010008040002ULL, 0x12800, 54 },
+  { 0x240040070820801ULL, 0x12c00, 54 },
+  { 0x20481a0003806405ULL, 0x8800, 53 },
+  { 0x88308080004000ULL, 0x9000, 53 },
+  { 0x200280400081ULL, 0x13000, 54 },
+  { 0x810200080100080ULL, 0x13400, 54 },
+  { 0x100080800800ULL, 0x13800, 54 },
+  { 0x80100100501ULL, 0x13c00, 54 },
+  { 0xa020080800400ULL, 0x14000, 54 },
+  { 0x1200410400420810ULL, 0x14400, 54 },
+  { 0x411141200008041ULL, 0x9800, 53 },
+  { 0x410804010800020ULL, 0xa000, 53 },
+  { 0x200040401000ULL, 0x14800, 54 },
+  { 0x5000802000801000ULL, 0x14c00, 54 },
+  { 0x1000100101002008ULL, 0x15000, 54 },
+  { 0x48040080800800ULL, 0x15400, 54 },
+  { 0x102000812003084ULL, 0x15800, 54 },
+  { 0x20106214000188ULL, 0x15c00, 54 },
+  { 0x144522000084ULL, 0xa800, 53 },
+  { 0x40400080048022ULL, 0xb000, 53 },
+  { 0x88050002000400aULL, 0x16000, 54 },
+  { 0x2160044021050010ULL, 0x16400, 54 },
+  { 0x100008008080ULL, 0x16800, 54 },
+  { 0x410080011010004ULL, 0x16c00, 54 },
+  { 0x902001004020008ULL, 0x17000, 54 },
+  { 0x4602500801040082ULL, 0x17400, 54 },
+  { 0x1030c10040820004ULL, 0xb800, 53 },
+  { 0x80400080002080ULL, 0xc000, 53 },
+  { 0x80410020820200ULL, 0x17800, 54 },
+  { 0x405200011014100ULL, 0x17c00, 54 },
+  { 0x880010008280ULL, 0x18000, 54 },
+  { 0x8040800400080080ULL, 0x18400, 54 },
+  { 0x8109000284000900ULL, 0x18800, 54 },
+  { 0x1002000401080200ULL, 0x18c00, 54 },
+  { 0x1441000042008100ULL, 0xc800, 53 },
+  { 0x10401021008202ULL, 0x2000, 52 },
+  { 0x406004020801906ULL, 0xd000, 53 },
+  { 0x2024402001001009ULL, 0xd800, 53 },
+  { 0x3000041000210109ULL, 0xe000, 53 },
+  { 0x1000248005005ULL, 0xe800, 53 },
+  { 0x21000802040001ULL, 0xf000, 53 },
+  { 0x3208102100a20804ULL, 0xf800, 53 },
+  { 0x40100281040048b2ULL, 0x3000, 52 },
+};
+
+constexpr Entry Bishop[64] = {
+  { 0x2240820840982ULL, 0x19e00, 58 },
+  { 0x4044043420420004ULL, 0x19f00, 59 },
+  { 0x8241012200802080ULL, 0x19f20, 59 },
+  { 0x48084100182400ULL, 0x19f40, 59 },
+  { 0x20940421400005c8ULL, 0x19f60, 59 },
+  { 0x20101201060002aULL, 0x19f80, 59 },
+  { 0x20410860502020ULL, 0x19fa0, 59 },
+  { 0x3403201202004ULL, 0x19e40, 58 },
+  { 0x50208404888400ULL, 0x19fc0, 59 },
+  { 0xa6447408204300ULL, 0x19fe0, 59 },
+  { 0x4240422860020ULL, 0x1a000, 59 },
+  { 0x2001082080200000ULL, 0x1a020, 59 },
+  { 0x4010840420040011ULL, 0x1a040, 59 },
+  { 0x20200a0210852028ULL, 0x1a060, 59 },
+  { 0x20089300f0042010ULL, 0x1a080, 59 },
+  { 0x4110420100884520ULL, 0x1a0a0, 59 },
+  { 0x2240012084248080ULL, 0x1a0c0, 59 },
+  { 0x1104086001440120ULL, 0x1a0e0, 59 },
+  { 0xc281081000420040ULL, 0x19800, 57 },
+  { 0x2202a0202024020ULL, 0x19880, 57 },
+  { 0x6203400a01100ULL, 0x19900, 57 },
+  { 0x5003400808080c15ULL, 0x19980, 57 },
+  { 0x404342201010828ULL, 0x1a100, 59 },
+  { 0x800440907009000ULL, 0x1a120, 59 },
+  { 0x420209490820206ULL, 0x1a140, 59 },
+  { 0x8002880020681080ULL, 0x1a160, 59 },
+  { 0x18104008004440ULL, 0x19a00, 57 },
+  { 0x4480004012020ULL, 0x19000, 55 },
+  { 0x30040000802104ULL, 0x19200, 55 },
+  { 0x4844550022018600ULL, 0x19a80, 57 },
+  { 0x1002020000415000ULL, 0x1a180, 59 },
+  { 0x844c00a130c06ULL, 0x1a1a0, 59 },
+  { 0x1048200402084860ULL, 0x1a1c0, 59 },
+  { 0x9180202218404ULL, 0x1a1e0, 59 },
+  { 0x60104020c010805ULL, 0x19b00, 57 },
+  { 0x42008020720200ULL, 0x19400, 55 },
+  { 0x3000410040040040ULL, 0x19600, 55 },
+  { 0x1b00041c4520100ULL, 0x19b80, 57 },
+  { 0x1141c90400220200ULL, 0x1a200, 59 },
+  { 0x1040084002220ULL, 0x1a220, 59 },
+  { 0x4022012008002042ULL, 0x1a240, 59 },
+  { 0x8080882410100288ULL, 0x1a260, 59 },
+  { 0x22010402040101ULL, 0x19c00, 57 },
+  { 0x4100204200800808ULL, 0x19c80, 57 },
+  { 0x3008040104000610ULL, 0x19d00, 57 },
+  { 0x46200145020080ULL, 0x19d80, 57 },
+  { 0x20088101000054ULL, 0x1a280, 59 },
+  { 0x8170020208200c40ULL, 0x1a2a0, 59 },
+  { 0x1a080202100028ULL, 0x1a2c0, 59 },
+  { 0x400840101100002ULL, 0x1a2e0, 59 },
+  { 0x20042184502b01ULL, 0x1a300, 59 },
+  { 0x8000000205040204ULL, 0x1a320, 59 },
+  { 0x110410440080ULL, 0x1a340, 59 },
+  { 0x8008202002008480ULL, 0x1a360, 59 },
+  { 0x4a100418044102ULL, 0x1a380, 59 },
+  { 0x4100410408000ULL, 0x1a3a0, 59 },
+  { 0x4000240402011008ULL, 0x19e80, 58 },
+  { 0x480091101300210ULL, 0x1a3c0, 59 },
+  { 0xa480300100411000ULL, 0x1a3e0, 59 },
+  { 0x8400002088208808ULL, 0x1a400, 59 },
+  { 0x8000002020a02480ULL, 0x1a420, 59 },
+  { 0x80042008820820ULL, 0x1a440, 59 },
+  { 0x202121019081080ULL, 0x1a460, 59 },
+  { 0x240614800808080ULL, 0x19ec0, 58 },
+};
+
+} // namespace MagicInit
+
+#endif // #ifndef MAGICS_H_INCLUDED
@@ -26,6 +26,7 @@
 #include "search.h"
 #include "thread.h"
 #include "tt.h"
+#include "tune.h"
 #include "uci.h"
 
 namespace PSQT {
@@ -36,23 +37,27 @@ namespace AbsorbChess {
   void init_tables();
 }
 
+/// Entry point of the native server-side build. The WASM build uses the
+/// embind wrapper in absorb_chess_wasm.cpp instead and never links this file.
+
 int main(int argc, char* argv[]) {
 
-  // std::cout << engine_info() << std::endl;
+  std::cout << engine_info() << std::endl;
 
-  // UCI::init(Options);
-  // Tune::init();
-  // PSQT::init();
-  std::cout << "hi";
+  UCI::init(Options);
+  Tune::init();
+  PSQT::init();
   Bitboards::init();
-  std::cout << "hello";
-  // Position::init();
-  // Bitbases::init();
-  // Endgames::init();
-  // AbsorbChess::init_tables(); // Initialize absorb chess lookup tables
-  // Threads.set(size_t(Options["Threads"]));
-  // TT.resize(Options["Hash"]); // After threads are up
-  // Search::clear(); // After threads are up
+  Position::init();
+  Bitbases::init();
+  Endgames::init();
+  AbsorbChess::init_tables(); // Initialize absorb chess lookup tables
+  Threads.set(size_t(Options["Threads"]));
+  TT.resize(size_t(Options["Hash"]));
+  Search::clear(); // After threads are up
+
+  UCI::loop(argc, argv);
 
+  Threads.set(0);
   return 0;
 }
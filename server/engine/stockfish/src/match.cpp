@@ -0,0 +1,496 @@
+/*
+  Absorb Chess self-play match harness (native only, see ../build_match.sh).
+
+  Plays two UCI engine binaries against each other over the absorb bench
+  corpus (or the classical openings, or a given fen), with per-game clocks,
+  game pairs run concurrently across worker threads, and reports the Elo
+  difference with SPRT early stopping plus node/time statistics. bench
+  measures nodes per second; this is the tool that answers whether a change
+  actually bought strength per second.
+
+  Both engines must speak this tree's UCI dialect: the absorb corpus uses
+  the extended fen with '[...]' ability suffixes (see Position::set()), so a
+  reference build from before that dialect existed can only be matched over
+  the "default" corpus.
+
+  Usage: match <engineA> <engineB> [pairs] [threads] [tc_ms] [inc_ms]
+               [elo0] [elo1] [absorb | default | "<fen>"]
+
+  Every opening is played twice with colors swapped, so 'pairs' openings
+  give 2*pairs games. The SPRT tests H0: elo <= elo0 against H1: elo >= elo1
+  at alpha = beta = 0.05 and stops the match once either hypothesis is
+  accepted; otherwise it runs the full schedule and reports the LLR so far.
+*/
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "movegen.h"
+#include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "tt.h"
+#include "uci.h"
+
+using namespace std;
+
+extern const vector<string>& absorb_bench_positions();
+
+namespace {
+
+// Classical openings for matches against builds that predate the extended
+// fen dialect; same set as the perft defaults.
+const vector<string> MatchDefaults = {
+  "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 10",
+  "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 11"
+};
+
+// Hard cap on game length; adjudicated as a draw. Long enough that real
+// games never hit it, short enough that two shuffling engines cannot stall
+// a worker forever.
+constexpr int MaxGamePlies = 400;
+
+// Grace added to the clock when waiting for a bestmove before the engine is
+// declared hung; covers process scheduling, not engine thinking time.
+constexpr int ReadGraceMs = 5000;
+
+// Per-engine running totals, accumulated from the last "info ... nodes N"
+// line of each search and the measured think times.
+struct EngineTotals {
+  uint64_t nodes = 0;
+  uint64_t thinkMs = 0;
+  uint64_t moves = 0;
+};
+
+struct MatchState {
+  std::mutex mtx;
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> nextPair{0};
+  int wins = 0, draws = 0, losses = 0; // from engine A's point of view
+  int crashes = 0;                     // games decided by a dead/hung engine
+  EngineTotals totals[2];
+};
+
+
+/// EngineProcess wraps one UCI engine subprocess behind line-based IO. The
+/// harness trusts the engines to be well-behaved but not to be correct: a
+/// crash or a hang is detected and scored as a loss rather than taking the
+/// match down.
+
+class EngineProcess {
+
+  pid_t pid = -1;
+  int toChild = -1, fromChild = -1;
+  string buffer;
+
+public:
+  uint64_t lastNodes = 0; // nodes reported by the last completed search
+
+  ~EngineProcess() { terminate(); }
+
+  bool start(const string& path) {
+
+    int in[2], out[2]; // in: harness -> engine, out: engine -> harness
+    if (pipe(in) || pipe(out))
+        return false;
+
+    pid = fork();
+    if (pid < 0)
+        return false;
+
+    if (pid == 0)
+    {
+        dup2(in[0], STDIN_FILENO);
+        dup2(out[1], STDOUT_FILENO);
+        close(in[0]); close(in[1]); close(out[0]); close(out[1]);
+        execl(path.c_str(), path.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    close(in[0]); close(out[1]);
+    toChild = in[1];
+    fromChild = out[0];
+
+    return send("uci") && wait_for("uciok", ReadGraceMs) && sync();
+  }
+
+  bool send(const string& line) {
+
+    string s = line + "\n";
+    return pid > 0 && write(toChild, s.data(), s.size()) == ssize_t(s.size());
+  }
+
+  // Read one line, waiting at most timeoutMs. Blank lines are skipped so an
+  // empty return always means the engine died or went silent; the caller
+  // scores the game accordingly.
+  string read_line(int timeoutMs) {
+
+    while (true)
+    {
+        size_t nl = buffer.find('\n');
+        if (nl != string::npos)
+        {
+            string line = buffer.substr(0, nl);
+            buffer.erase(0, nl + 1);
+            if (line.empty())
+                continue;
+            return line;
+        }
+
+        struct pollfd pfd = { fromChild, POLLIN, 0 };
+        if (poll(&pfd, 1, timeoutMs) <= 0)
+            return "";
+
+        char chunk[4096];
+        ssize_t n = read(fromChild, chunk, sizeof(chunk));
+        if (n <= 0)
+            return "";
+        buffer.append(chunk, size_t(n));
+    }
+  }
+
+  bool wait_for(const string& token, int timeoutMs) {
+
+    string line;
+    while (!(line = read_line(timeoutMs)).empty())
+        if (line.rfind(token, 0) == 0)
+            return true;
+    return false;
+  }
+
+  bool sync() { return send("isready") && wait_for("readyok", ReadGraceMs); }
+
+  bool new_game() { return send("ucinewgame") && sync(); }
+
+  // Run a search under the given clocks and return the bestmove token, or
+  // an empty string on crash/hang. Tracks the node count from info lines.
+  string go(const string& posCmd, int wtime, int btime, int inc, int timeoutMs) {
+
+    ostringstream cmd;
+    cmd << "go wtime " << wtime << " btime " << btime
+        << " winc " << inc << " binc " << inc;
+
+    if (!send(posCmd) || !send(cmd.str()))
+        return "";
+
+    string line;
+    while (!(line = read_line(timeoutMs)).empty())
+    {
+        istringstream is(line);
+        string token;
+        is >> token;
+
+        if (token == "info")
+        {
+            while (is >> token)
+                if (token == "nodes" && (is >> token))
+                    lastNodes = stoull(token);
+        }
+        else if (token == "bestmove")
+        {
+            is >> token;
+            return token;
+        }
+    }
+    return "";
+  }
+
+  void terminate() {
+
+    if (pid > 0)
+    {
+        send("quit");
+        close(toChild); close(fromChild);
+
+        // Reap, escalating to SIGKILL if quit is ignored
+        for (int i = 0; i < 50 && waitpid(pid, nullptr, WNOHANG) == 0; i++)
+            usleep(10000);
+        if (waitpid(pid, nullptr, WNOHANG) == 0)
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+        pid = -1;
+    }
+  }
+};
+
+
+/// play_game() runs one game between 'white' and 'black' from the given
+/// opening fen, adjudicating with the harness's own (absorb-aware) movegen.
+/// Returns the result from white's point of view; 'crashed' is set when the
+/// game was decided by a dead engine or an illegal move rather than on the
+/// board.
+
+enum { WHITE_WINS, BLACK_WINS, DRAWN };
+
+int play_game(EngineProcess& white, EngineProcess& black, const string& fen,
+              int tc, int inc, EngineTotals& whiteTotals, EngineTotals& blackTotals,
+              bool& crashed) {
+
+  crashed = false;
+
+  Position pos;
+  StateListPtr states(new std::deque<StateInfo>(1));
+  pos.set(fen, false, &states->back(), Threads.main());
+
+  if (!white.new_game() || !black.new_game())
+      return crashed = true, DRAWN;
+
+  string movesPlayed;
+  int clocks[COLOR_NB] = { tc, tc };
+
+  for (int ply = 0; ply < MaxGamePlies; ply++)
+  {
+      Color us = pos.side_to_move();
+
+      if (MoveList<LEGAL>(pos).size() == 0)
+          return pos.checkers() ? (us == WHITE ? BLACK_WINS : WHITE_WINS) : DRAWN;
+
+      if (pos.is_draw(ply))
+          return DRAWN;
+
+      EngineProcess& engine = us == WHITE ? white : black;
+      EngineTotals& totals  = us == WHITE ? whiteTotals : blackTotals;
+
+      string posCmd = "position fen " + fen
+                    + (movesPlayed.empty() ? "" : " moves" + movesPlayed);
+
+      TimePoint start = now();
+      string bestmove = engine.go(posCmd, clocks[WHITE], clocks[BLACK], inc,
+                                  clocks[us] + ReadGraceMs);
+      int elapsed = int(now() - start);
+
+      totals.nodes += engine.lastNodes;
+      totals.thinkMs += uint64_t(elapsed);
+      totals.moves++;
+
+      if (bestmove.empty()) // Crashed or hung: forfeit
+          return crashed = true, us == WHITE ? BLACK_WINS : WHITE_WINS;
+
+      clocks[us] += inc - elapsed;
+      if (clocks[us] < 0) // Flag fell
+          return us == WHITE ? BLACK_WINS : WHITE_WINS;
+
+      Move m = UCI::to_move(pos, bestmove);
+      if (m == MOVE_NONE) // Illegal move: forfeit
+          return crashed = true, us == WHITE ? BLACK_WINS : WHITE_WINS;
+
+      // Capturing the king ends an absorb game immediately; such moves can
+      // be produced while check detection is not ability-aware, and
+      // do_move() cannot cope with the kingless board that results.
+      if (pos.capture(m) && type_of(m) == NORMAL
+          && type_of(pos.piece_on(to_sq(m))) == KING)
+          return us == WHITE ? WHITE_WINS : BLACK_WINS;
+
+      states->emplace_back();
+      pos.do_move(m, states->back());
+      movesPlayed += " " + bestmove;
+  }
+
+  return DRAWN;
+}
+
+
+// Logistic elo <-> expected score
+double expected_score(double elo) { return 1.0 / (1.0 + pow(10.0, -elo / 400.0)); }
+
+/// sprt_llr() computes the generalized SPRT log-likelihood ratio for
+/// H1: elo = elo1 against H0: elo = elo0 from a win/draw/loss tally, using
+/// the normal approximation on the observed score distribution.
+
+double sprt_llr(int wins, int draws, int losses, double elo0, double elo1) {
+
+  int n = wins + draws + losses;
+  if (n == 0 || wins == n || losses == n)
+      return 0.0;
+
+  double mean = (wins + 0.5 * draws) / n;
+  double var  = (  wins   * pow(1.0 - mean, 2)
+                 + draws  * pow(0.5 - mean, 2)
+                 + losses * pow(0.0 - mean, 2)) / n;
+
+  if (var < 1e-9)
+      return 0.0;
+
+  double s0 = expected_score(elo0), s1 = expected_score(elo1);
+  return (s1 - s0) * (2 * mean - s0 - s1) * n / (2 * var);
+}
+
+double elo_estimate(int wins, int draws, int losses) {
+
+  double mean = (wins + 0.5 * draws) / std::max(1, wins + draws + losses);
+  mean = std::min(std::max(mean, 1e-6), 1.0 - 1e-6);
+  return -400.0 * log10(1.0 / mean - 1.0);
+}
+
+void print_status(MatchState& ms, double elo0, double elo1,
+                  double lower, double upper) {
+
+  int n = ms.wins + ms.draws + ms.losses;
+  double llr = sprt_llr(ms.wins, ms.draws, ms.losses, elo0, elo1);
+
+  cout << "Games: " << n
+       << "  W/D/L: " << ms.wins << "/" << ms.draws << "/" << ms.losses
+       << "  Elo: " << elo_estimate(ms.wins, ms.draws, ms.losses)
+       << "  LLR: " << llr << " (" << lower << ", " << upper << ")";
+  if (ms.crashes)
+      cout << "  forfeits: " << ms.crashes;
+  cout << endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+
+  if (argc < 3)
+  {
+      cerr << "Usage: match <engineA> <engineB> [pairs] [threads] [tc_ms]"
+              " [inc_ms] [elo0] [elo1] [absorb | default | \"<fen>\"]" << endl;
+      return EXIT_FAILURE;
+  }
+
+  UCI::init(Options);
+  AbsorbChess::init_tables();
+  Bitboards::init();
+  Position::init();
+  Threads.set_synchronous(); // Engine threads stay unused; adjudication only
+
+  // A write to a crashed engine must fail with EPIPE, not kill the match
+  signal(SIGPIPE, SIG_IGN);
+
+  string engineA = argv[1];
+  string engineB = argv[2];
+  int pairs       = argc > 3 ? atoi(argv[3]) : 50;
+  int threadCount = argc > 4 ? atoi(argv[4])
+                             : std::max(1, int(std::thread::hardware_concurrency()) / 2);
+  int tc          = argc > 5 ? atoi(argv[5]) : 1000;
+  int inc         = argc > 6 ? atoi(argv[6]) : 10;
+  double elo0     = argc > 7 ? atof(argv[7]) : 0.0;
+  double elo1     = argc > 8 ? atof(argv[8]) : 5.0;
+  string corpus   = argc > 9 ? argv[9] : "absorb";
+
+  vector<string> openings;
+  if (corpus == "absorb")
+      openings = absorb_bench_positions();
+  else if (corpus == "default")
+      openings = MatchDefaults;
+  else
+      openings.push_back(corpus);
+
+  // alpha = beta = 0.05
+  const double lower = log(0.05 / 0.95), upper = log(0.95 / 0.05);
+
+  cout << "Match: " << engineA << " vs " << engineB
+       << "\nSchedule: " << pairs << " pairs (" << 2 * pairs << " games), "
+       << threadCount << " workers, tc " << tc << "+" << inc << "ms"
+       << "\nSPRT: H0 elo <= " << elo0 << ", H1 elo >= " << elo1
+       << ", LLR bounds (" << lower << ", " << upper << ")\n" << endl;
+
+  MatchState ms;
+
+  auto worker = [&]() {
+
+    // One engine pair per worker, reused across games via ucinewgame
+    EngineProcess a, b;
+    if (!a.start(engineA) || !b.start(engineB))
+    {
+        cerr << "Failed to start engines" << endl;
+        ms.stop = true;
+        return;
+    }
+
+    for (size_t i = ms.nextPair.fetch_add(1); i < size_t(pairs) && !ms.stop;
+         i = ms.nextPair.fetch_add(1))
+    {
+        const string& fen = openings[i % openings.size()];
+
+        // Both colors from the same opening cancel its bias
+        for (int rev = 0; rev < 2 && !ms.stop; rev++)
+        {
+            bool crashed;
+            EngineTotals tA, tB;
+            int result = rev == 0
+                ? play_game(a, b, fen, tc, inc, tA, tB, crashed)
+                : play_game(b, a, fen, tc, inc, tB, tA, crashed);
+
+            bool aIsWhite = rev == 0;
+            std::lock_guard<std::mutex> lock(ms.mtx);
+
+            if (result == DRAWN)
+                ms.draws++;
+            else if ((result == WHITE_WINS) == aIsWhite)
+                ms.wins++;
+            else
+                ms.losses++;
+            ms.crashes += crashed;
+
+            ms.totals[0].nodes += tA.nodes;   ms.totals[1].nodes += tB.nodes;
+            ms.totals[0].thinkMs += tA.thinkMs; ms.totals[1].thinkMs += tB.thinkMs;
+            ms.totals[0].moves += tA.moves;   ms.totals[1].moves += tB.moves;
+
+            print_status(ms, elo0, elo1, lower, upper);
+
+            double llr = sprt_llr(ms.wins, ms.draws, ms.losses, elo0, elo1);
+            if (llr <= lower || llr >= upper)
+                ms.stop = true;
+
+            // A forfeit leaves a dead engine behind; restart both rather
+            // than track which one went down
+            if (crashed && !ms.stop)
+            {
+                a.terminate();
+                b.terminate();
+                if (!a.start(engineA) || !b.start(engineB))
+                {
+                    cerr << "Failed to restart engines" << endl;
+                    ms.stop = true;
+                }
+            }
+        }
+    }
+  };
+
+  vector<std::thread> pool;
+  for (int t = 0; t < threadCount; t++)
+      pool.emplace_back(worker);
+  for (auto& th : pool)
+      th.join();
+
+  double llr = sprt_llr(ms.wins, ms.draws, ms.losses, elo0, elo1);
+
+  cout << "\nResult: ";
+  if (llr >= upper)
+      cout << "H1 accepted (elo >= " << elo1 << ")";
+  else if (llr <= lower)
+      cout << "H0 accepted (elo <= " << elo0 << ")";
+  else
+      cout << "inconclusive";
+  cout << " after " << ms.wins + ms.draws + ms.losses << " games" << endl;
+
+  const char* names[2] = { "A", "B" };
+  for (int e = 0; e < 2; e++)
+  {
+      const EngineTotals& t = ms.totals[e];
+      cout << "Engine " << names[e] << ": "
+           << t.nodes << " nodes, " << t.thinkMs << "ms thinking, "
+           << (t.thinkMs ? 1000 * t.nodes / t.thinkMs : 0) << " nps, "
+           << (t.moves ? t.thinkMs / t.moves : 0) << "ms/move" << endl;
+  }
+
+  Threads.set(0);
+  return 0;
+}
@@ -54,19 +54,40 @@ namespace {
 
   // Endgame evaluation and scaling functions are accessed directly and not through
   // the function maps because they correspond to more than one material hash key.
-  Endgame<KXK>    EvaluateKXK[] = { Endgame<KXK>(WHITE),    Endgame<KXK>(BLACK) };
+  Endgame<KXK>    EvaluateKXK[]  = { Endgame<KXK>(WHITE),   Endgame<KXK>(BLACK) };
+  Endgame<KXAK>   EvaluateKXAK[] = { Endgame<KXAK>(WHITE),  Endgame<KXAK>(BLACK) };
 
   Endgame<KBPsK>  ScaleKBPsK[]  = { Endgame<KBPsK>(WHITE),  Endgame<KBPsK>(BLACK) };
   Endgame<KQKRPs> ScaleKQKRPs[] = { Endgame<KQKRPs>(WHITE), Endgame<KQKRPs>(BLACK) };
   Endgame<KPsK>   ScaleKPsK[]   = { Endgame<KPsK>(WHITE),   Endgame<KPsK>(BLACK) };
   Endgame<KPKP>   ScaleKPKP[]   = { Endgame<KPKP>(WHITE),   Endgame<KPKP>(BLACK) };
 
-  // Helper used to detect a given material distribution
+  // Helper used to detect a given material distribution. The non-pawn
+  // material is effective-type based, so a lone pawn that absorbed a rook or
+  // queen ability qualifies. A defending king that absorbed an ability is
+  // excluded: it no longer moves like the lone king the evaluation assumes.
   bool is_KXK(const Position& pos, Color us) {
     return  !more_than_one(pos.pieces(~us))
+          && !pos.absorbed_abilities(pos.square<KING>(~us))
           && pos.non_pawn_material(us) >= RookValueMg;
   }
 
+  // Absorb Chess: a lone piece that stacked bishop and knight abilities vs a
+  // bare king. Rook and queen abilities already route through is_KXK via the
+  // effective non-pawn material, so this catches the remaining forced win.
+  bool is_KXAK(const Position& pos, Color us) {
+
+    Bitboard b = pos.pieces(us) ^ pos.pieces(us, KING);
+
+    if (!b || more_than_one(b) || more_than_one(pos.pieces(~us)))
+        return false;
+
+    Square s = lsb(b);
+    return   pos.has_ability(s, BISHOP)
+          && pos.has_ability(s, KNIGHT)
+          && !pos.absorbed_abilities(pos.square<KING>(~us));
+  }
+
   bool is_KBPsK(const Position& pos, Color us) {
     return   pos.non_pawn_material(us) == BishopValueMg
           && pos.count<PAWN  >(us) >= 1;
@@ -150,6 +171,13 @@ Entry* probe(const Position& pos) {
           return e;
       }
 
+  for (Color c : { WHITE, BLACK })
+      if (is_KXAK(pos, c))
+      {
+          e->evaluationFunction = &EvaluateKXAK[c];
+          return e;
+      }
+
   // OK, we didn't find any special evaluation function for the current material
   // configuration. Is there a suitable specialized scaling function?
   const auto* sf = Endgames::probe<ScaleFactor>(key);
@@ -206,24 +234,15 @@ Entry* probe(const Position& pos) {
       e->factor[BLACK] = uint8_t(npm_b <  RookValueMg   ? SCALE_FACTOR_DRAW :
                                  npm_w <= BishopValueMg ? 4 : 14);
 
-  // Absorb Chess: Calculate piece counts based on effective types using lookup tables
+  // Absorb Chess: effective-type piece counts are maintained incrementally by
+  // Position::do_move(), so no board scan is needed here (kings are tracked
+  // as KING and not counted in the imbalance)
   int effectivePieceCount[COLOR_NB][PIECE_TYPE_NB] = {};
-  
-  // Count pieces by their effective type considering absorbed abilities
+
   for (Color c : { WHITE, BLACK }) {
-    Bitboard pieces = pos.pieces(c);
-    while (pieces) {
-      Square sq = pop_lsb(&pieces);
-      Piece pc = pos.piece_on(sq);
-      PieceType basePt = type_of(pc);
-      
-      if (basePt != KING) { // Don't count kings in material
-        Abilities abilities = pos.abilities_on(sq);
-        PieceType effectivePt = get_effective_material_type(basePt, abilities);
-        effectivePieceCount[c][effectivePt]++;
-      }
-    }
-    
+    for (PieceType pt = PAWN; pt <= QUEEN; ++pt)
+        effectivePieceCount[c][pt] = pos.effective_count(c, pt);
+
     // Special case: Bishop pair bonus (if we have more than 1 bishop)
     effectivePieceCount[c][NO_PIECE_TYPE] = effectivePieceCount[c][BISHOP] > 1 ? 1 : 0;
   }
@@ -41,6 +41,10 @@ typedef bool(*fun3_t)(HANDLE, CONST GROUP_AFFINITY*, PGROUP_AFFINITY);
 }
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -50,6 +54,17 @@ typedef bool(*fun3_t)(HANDLE, CONST GROUP_AFFINITY*, PGROUP_AFFINITY);
 #if defined(__linux__) && !defined(__ANDROID__)
 #include <stdlib.h>
 #include <sys/mman.h>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+#endif
+
+#ifdef ABSORB_PROF
+#if defined(__EMSCRIPTEN__)
+#include <emscripten.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 #endif
 
 #include "misc.h"
@@ -246,6 +261,119 @@ void dbg_print() {
 }
 
 
+#ifdef ABSORB_PROF
+
+/// Tick counters for the absorb hot paths (see misc.h). Plain counters on
+/// purpose: only bench with Threads = 1 reads them.
+
+namespace Prof {
+
+namespace {
+
+  struct { uint64_t ticks = 0, hits = 0; } counters[REGION_NB];
+
+  const char* RegionNames[REGION_NB] = {
+    "search (total)", "qsearch trees", "evaluate", "eval ability attacks",
+    "movegen piece unions", "movegen pawn abilities", "do_move", "psq ability update"
+  };
+}
+
+uint64_t ticks() {
+#if defined(__EMSCRIPTEN__)
+  return uint64_t(emscripten_get_now() * 1e6); // performance.now(), as ns
+#elif defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+void add(Region r, uint64_t t) { counters[r].ticks += t; ++counters[r].hits; }
+
+void print() {
+
+  if (!counters[SEARCH].hits)
+      return;
+
+  cerr << "\nABSORB_PROF breakdown (rdtsc cycles natively, ns under wasm; inclusive)\n"
+       << std::left << std::setw(24) << "region"
+       << std::right << std::setw(14) << "Mticks" << std::setw(14) << "hits"
+       << std::setw(12) << "ticks/hit" << std::setw(10) << "% search" << '\n';
+
+  for (int r = 0; r < REGION_NB; ++r)
+  {
+      if (!counters[r].hits)
+          continue;
+
+      cerr << std::left << std::setw(24) << RegionNames[r]
+           << std::right << std::setw(14) << counters[r].ticks / 1000000
+           << std::setw(14) << counters[r].hits
+           << std::setw(12) << counters[r].ticks / counters[r].hits
+           << std::setw(9) << 100 * counters[r].ticks / counters[SEARCH].ticks << "%\n";
+  }
+}
+
+}
+
+#endif // ABSORB_PROF
+
+
+/// Per-search bump arena (see misc.h). The cursor is atomic because in the
+/// threaded WASM build the Lazy SMP helpers update their PVs concurrently;
+/// reset() itself needs no synchronization as it only ever runs between
+/// searches.
+
+namespace Arena {
+
+namespace {
+
+  constexpr size_t Alignment = alignof(std::max_align_t);
+
+  char* block = nullptr;
+  size_t capacity = 0;
+  std::atomic<size_t> cursor(0);
+  std::atomic<size_t> overflowed(0);
+}
+
+void init(size_t bytes) {
+
+  if (block)
+      free(block);
+
+  block = static_cast<char*>(malloc(bytes));
+  capacity = block ? bytes : 0;
+  cursor = 0;
+  overflowed = 0;
+}
+
+void reset() { cursor = 0; }
+
+void* alloc(size_t bytes) {
+
+  if (!block)
+      return nullptr;
+
+  bytes = (bytes + Alignment - 1) & ~(Alignment - 1);
+  size_t offset = cursor.fetch_add(bytes, std::memory_order_relaxed);
+  if (offset + bytes > capacity)
+  {
+      overflowed.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+  }
+  return block + offset;
+}
+
+bool contains(const void* p) {
+  return block && p >= block && p < block + capacity;
+}
+
+size_t used() { return std::min(cursor.load(), capacity); }
+
+size_t overflows() { return overflowed.load(); }
+
+}
+
+
 /// Used to serialize access to std::cout to avoid multiple threads writing at
 /// the same time.
 
@@ -422,7 +550,23 @@ void aligned_ttmem_free(void *mem) {
 
 namespace WinProcGroup {
 
-#ifndef _WIN32
+#if defined(__linux__) && !defined(__ANDROID__)
+
+/// bindThisThread() pins the thread with the given index to a fixed CPU, so
+/// that on multi-socket boxes the Lazy SMP helpers stay on the core whose
+/// caches they have warmed and, through first-touch allocation, on the NUMA
+/// node holding their working set. Distribution across sockets is left to the
+/// kernel's CPU enumeration; we only stop threads from migrating.
+
+void bindThisThread(size_t idx) {
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(idx % std::thread::hardware_concurrency(), &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+}
+
+#elif !defined(_WIN32)
 
 void bindThisThread(size_t) {}
 
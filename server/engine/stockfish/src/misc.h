@@ -41,6 +41,110 @@ void dbg_hit_on(bool c, bool b);
 void dbg_mean_of(int v);
 void dbg_print();
 
+
+/// Scoped tick counters for the absorb hot paths, compiled in only with
+/// -DABSORB_PROF. Without the flag every ABSORB_PROF_* macro expands to
+/// nothing, so the shipped binary is untouched. Ticks are rdtsc cycles
+/// natively and a performance.now() bridge (nanoseconds) under Emscripten.
+/// The counters are plain, not atomic: the numbers are only meaningful with
+/// Threads = 1, which is what bench uses. Regions nest (a PSQ_UPDATE tick is
+/// also a DO_MOVE and a SEARCH tick), so the table reports inclusive time.
+/// Note that abilities_on() itself is too small to wrap - a counter would
+/// cost more than the scan - so its share shows up inside the eval and
+/// movegen regions that call it.
+namespace Prof {
+
+#ifdef ABSORB_PROF
+
+enum Region {
+  SEARCH,           // one whole bench search, the denominator (uci.cpp)
+  QSEARCH,          // qsearch trees entered at the horizon (search.cpp)
+  EVALUATE,         // Eval::evaluate() (evaluate.cpp)
+  EVAL_ABILITY,     // per-piece typeAttacks build in Evaluation::pieces()
+  MOVEGEN_PIECES,   // fused ability unions in generate_moves()
+  MOVEGEN_PAWN_AB,  // pawn absorbed-ability loop in generate_pawn_moves()
+  DO_MOVE,          // Position::do_move()
+  PSQ_UPDATE,       // Position::update_psq_for_abilities()
+  REGION_NB
+};
+
+uint64_t ticks();
+void add(Region r, uint64_t t);
+void print();
+
+struct Scope {
+  explicit Scope(Region r) : region(r), start(ticks()) {}
+  ~Scope() { add(region, ticks() - start); }
+  Region region;
+  uint64_t start;
+};
+
+#define ABSORB_PROF_CAT2(a, b) a##b
+#define ABSORB_PROF_CAT(a, b) ABSORB_PROF_CAT2(a, b)
+
+// RAII region for a whole block, and a BEGIN/END pair for a region in the
+// middle of a function where adding braces would disturb the shipped code
+#define ABSORB_PROF_SCOPE(r) Prof::Scope ABSORB_PROF_CAT(profScope, __LINE__)(Prof::r)
+#define ABSORB_PROF_BEGIN(r) uint64_t profTick_##r = Prof::ticks()
+#define ABSORB_PROF_END(r)   Prof::add(Prof::r, Prof::ticks() - profTick_##r)
+#define ABSORB_PROF_PRINT()  Prof::print()
+
+#else
+
+#define ABSORB_PROF_SCOPE(r)
+#define ABSORB_PROF_BEGIN(r)
+#define ABSORB_PROF_END(r)
+#define ABSORB_PROF_PRINT()
+
+#endif
+
+}
+
+/// Bump allocator backing the per-search dynamic structures (the RootMoves
+/// vector and the PVs inside it). Until init() runs every allocation falls
+/// through to operator new, so the native builds are untouched; the WASM
+/// wrapper activates it so that a search never asks the system allocator for
+/// memory and, in the fixed-heap build, never grows the linear memory mid
+/// search (see build_wasm.sh --fixed-heap). The arena is recycled wholesale
+/// at the start of the next search (ThreadPool::start_thinking()), which is
+/// the only point where no arena-backed structure is live; deallocate() of
+/// an arena block is therefore a no-op. Exhaustion is not an error, just a
+/// fallback to operator new, counted for getSearchStats().
+
+namespace Arena {
+
+void init(size_t bytes);
+void reset();
+void* alloc(size_t bytes);        // nullptr when inactive or exhausted
+bool contains(const void* p);
+size_t used();
+size_t overflows();               // allocations that fell back since init()
+
+template<typename T>
+struct Allocator {
+
+  using value_type = T;
+
+  Allocator() = default;
+  template<typename U> Allocator(const Allocator<U>&) {}
+
+  T* allocate(size_t n) {
+    if (void* p = alloc(n * sizeof(T)))
+        return static_cast<T*>(p);
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t) {
+    if (!contains(p))
+        ::operator delete(p);
+  }
+
+  template<typename U> bool operator==(const Allocator<U>&) const { return true; }
+  template<typename U> bool operator!=(const Allocator<U>&) const { return false; }
+};
+
+}
+
 typedef std::chrono::milliseconds::rep TimePoint; // A value in milliseconds
 
 static_assert(sizeof(TimePoint) == sizeof(int64_t), "TimePoint should be 64 bits");
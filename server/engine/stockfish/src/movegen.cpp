@@ -20,6 +20,7 @@
 
 #include <cassert>
 
+#include "misc.h"
 #include "movegen.h"
 #include "position.h"
 
@@ -35,7 +36,7 @@ namespace {
             *moveList++ = make<PROMOTION>(to - D, to, KNIGHT);
     }
 
-    if (Type == QUIETS || Type == EVASIONS || Type == NON_EVASIONS)
+    if (Type == QUIETS || Type == QUIETS_BASE || Type == EVASIONS || Type == NON_EVASIONS)
     {
         *moveList++ = make<PROMOTION>(to - D, to, ROOK);
         *moveList++ = make<PROMOTION>(to - D, to, BISHOP);
@@ -57,6 +58,11 @@ namespace {
     constexpr Direction UpRight  = (Us == WHITE ? NORTH_EAST : SOUTH_WEST);
     constexpr Direction UpLeft   = (Us == WHITE ? NORTH_WEST : SOUTH_EAST);
 
+    // Absorb Chess: which slice of the moves to emit. QUIETS_BASE/QUIETS_ABILITY
+    // partition QUIETS so the move picker can defer the ability slice.
+    constexpr bool BaseMoves    = Type != QUIETS_ABILITY;
+    constexpr bool AbilityMoves = Type != QUIETS_BASE;
+
     const Square ksq = pos.square<KING>(Them);
     Bitboard emptySquares;
 
@@ -67,9 +73,10 @@ namespace {
                         Type == CAPTURES ? target : pos.pieces(Them));
 
     // Single and double pawn pushes, no promotions
-    if (Type != CAPTURES)
+    if (BaseMoves && Type != CAPTURES)
     {
-        emptySquares = (Type == QUIETS || Type == QUIET_CHECKS ? target : ~pos.pieces());
+        emptySquares = (Type == QUIETS || Type == QUIETS_BASE || Type == QUIET_CHECKS ? target
+                                                                                     : ~pos.pieces());
 
         Bitboard b1 = shift<Up>(pawnsNotOn7)   & emptySquares;
         Bitboard b2 = shift<Up>(b1 & TRank3BB) & emptySquares;
@@ -114,7 +121,7 @@ namespace {
     }
 
     // Promotions and underpromotions
-    if (pawnsOn7)
+    if (BaseMoves && pawnsOn7)
     {
         if (Type == CAPTURES)
             emptySquares = ~pos.pieces();
@@ -175,7 +182,7 @@ namespace {
 
     // Absorb Chess: Generate pawn-like moves for non-pawn pieces that gained pawn ability
     // Rule: non-pawn pieces with pawn ability can only single-push and capture diagonally.
-    Bitboard piecesWithPawnAbilityAll = pos.pieces_with_ability(Us, PAWN);
+    Bitboard piecesWithPawnAbilityAll = AbilityMoves ? pos.pieces_with_ability(Us, PAWN) : 0;
     for (PieceType pt = KNIGHT; pt <= QUEEN; ++pt) {
         Bitboard piecesWithPawnAbility = piecesWithPawnAbilityAll & pos.pieces(Us, pt);
         if (!piecesWithPawnAbility)
@@ -187,7 +194,8 @@ namespace {
         // Single pushes only (no double push)
         if (Type != CAPTURES)
         {
-            Bitboard emptySquaresLocal = (Type == QUIETS || Type == QUIET_CHECKS ? target : ~pos.pieces());
+            Bitboard emptySquaresLocal = (Type == QUIETS || Type == QUIETS_ABILITY || Type == QUIET_CHECKS ? target
+                                                                                                          : ~pos.pieces());
 
             Bitboard b1 = shift<Up>(piecesNotOn7) & emptySquaresLocal;
 
@@ -218,10 +226,16 @@ namespace {
             Bitboard c2 = shift<UpLeft >(piecesOn7) & enemies;
 
             while (c1)
-                *moveList++ = make_move(pop_lsb(&c1) - UpRight, pop_lsb(&c1));
+            {
+                Square to = pop_lsb(&c1);
+                *moveList++ = make_move(to - UpRight, to);
+            }
 
             while (c2)
-                *moveList++ = make_move(pop_lsb(&c2) - UpLeft, pop_lsb(&c2));
+            {
+                Square to = pop_lsb(&c2);
+                *moveList++ = make_move(to - UpLeft, to);
+            }
         }
         
         // Captures for pieces not on 7th
@@ -245,44 +259,56 @@ namespace {
     }
 
     // Absorb Chess: Generate additional ability moves for pawns (e.g., pawn that gained knight/rook/etc.)
-    Bitboard allPawns = pawnsOn7 | pawnsNotOn7;
+    ABSORB_PROF_BEGIN(MOVEGEN_PAWN_AB);
+    Bitboard allPawns = AbilityMoves ? pawnsOn7 | pawnsNotOn7 : 0;
     while (allPawns) {
         Square from = pop_lsb(&allPawns);
-        // For each ability other than PAWN and KING, generate the corresponding moves
-        for (PieceType absorbedPt = KNIGHT; absorbedPt <= QUEEN; ++absorbedPt) {
-            if (!pos.has_ability(from, absorbedPt)) continue;
-
-            Bitboard abilMoves = 0;
-            if (absorbedPt == KNIGHT) {
-                abilMoves = attacks_bb<KNIGHT>(from) & target;
-            } else {
-                abilMoves = attacks_bb(absorbedPt, from, pos.pieces()) & target;
-            }
 
-            if (Type == EVASIONS)
-                abilMoves &= pos.check_squares(absorbedPt);
+        // Abilities other than PAWN and KING, fused into one attack union
+        Abilities ab = pos.abilities_on(from) & ~(ABILITY_PAWN | ABILITY_KING);
+        if (!ab) continue;
 
-            while (abilMoves)
-                *moveList++ = make_move(from, pop_lsb(&abilMoves));
-        }
+        Bitboard abilMoves = attacks_bb_multi(PAWN, ab, from, pos.pieces()) & target;
+
+        // Quiet checks keep the check_squares() masking of the per-type
+        // code, now as one AND with the precomputed fused mask. Evasions
+        // are deliberately not masked: check squares describe checks given
+        // to the enemy king, and requiring them would drop legal blocking
+        // evasions; like generate_moves(), evasions rely on 'target' plus
+        // the legal() filter.
+        if (Type == QUIET_CHECKS)
+            abilMoves &= pos.check_squares_multi(from);
+
+        while (abilMoves)
+            *moveList++ = make_move(from, pop_lsb(&abilMoves));
     }
+    ABSORB_PROF_END(MOVEGEN_PAWN_AB);
 
     return moveList;
   }
 
 
-  template<Color Us, PieceType Pt, bool Checks>
+  // Absorb Chess: which slice of the fused attack union to emit, so the move
+  // picker can defer the absorbed-ability quiets to a later generation stage
+  enum AbilitySplit { ALL_ABILITIES, BASE_ONLY, ABSORBED_ONLY };
+
+  template<Color Us, PieceType Pt, bool Checks, AbilitySplit Split>
   ExtMove* generate_moves(const Position& pos, ExtMove* moveList, Bitboard target) {
 
     static_assert(Pt != KING && Pt != PAWN, "Unsupported piece type in generate_moves()");
 
+    ABSORB_PROF_SCOPE(MOVEGEN_PIECES);
+
     const Square* pl = pos.squares<Pt>(Us);
 
     for (Square from = *pl; from != SQ_NONE; from = *++pl)
     {
         if (Checks)
         {
+            // The pseudo-attack prune only covers the base type, so keep
+            // pieces with absorbed abilities in play
             if (    (Pt == BISHOP || Pt == ROOK || Pt == QUEEN)
+                && !pos.absorbed_abilities(from)
                 && !(attacks_bb<Pt>(from) & target & pos.check_squares(Pt)))
                 continue;
 
@@ -290,33 +316,37 @@ namespace {
                 continue;
         }
 
-        Bitboard b = attacks_bb<Pt>(from, pos.pieces()) & target;
+        if (!Checks)
+        {
+            // Absorb Chess: base attacks and all absorbed non-pawn abilities
+            // in one fused union (pawn-like moves are handled separately in
+            // generate_pawn_moves). attacks_bb_multi() folds the base type
+            // in, so the base and absorbed slices partition the union.
+            if (Split == ABSORBED_ONLY && !pos.absorbed_abilities(from))
+                continue;
 
-        if (Checks)
-            b &= pos.check_squares(Pt);
+            Bitboard b = Split == BASE_ONLY
+                        ?  attacks_bb<Pt>(from, pos.pieces()) & target
+                        : Split == ABSORBED_ONLY
+                        ?  attacks_bb_multi(Pt, pos.abilities_on(from), from, pos.pieces())
+                         & ~attacks_bb<Pt>(from, pos.pieces()) & target
+                        :  attacks_bb_multi(Pt, pos.abilities_on(from), from, pos.pieces()) & target;
+
+            while (b)
+                *moveList++ = make_move(from, pop_lsb(&b));
+
+            continue;
+        }
+
+        // Absorb Chess: one fused attack union against the precomputed fused
+        // check mask. Destinations in the union of any held ability's check
+        // squares give check, because from there the piece attacks with all
+        // of its abilities at once.
+        Bitboard b = attacks_bb_multi(Pt, pos.abilities_on(from), from, pos.pieces())
+                   & target & pos.check_squares_multi(from);
 
         while (b)
             *moveList++ = make_move(from, pop_lsb(&b));
-        
-        // Absorb Chess: Generate moves for absorbed abilities
-        for (PieceType absorbedPt = PAWN; absorbedPt <= KING; ++absorbedPt) {
-            if (absorbedPt != Pt && pos.has_ability(from, absorbedPt)) {
-                Bitboard absorbedMoves = 0;
-                
-                if (absorbedPt == PAWN) {
-                    // Pawn moves are complex and handled separately
-                    continue;
-                } else {
-                    absorbedMoves = attacks_bb(absorbedPt, from, pos.pieces()) & target;
-                }
-                
-                if (Checks)
-                    absorbedMoves &= pos.check_squares(absorbedPt);
-                    
-                while (absorbedMoves)
-                    *moveList++ = make_move(from, pop_lsb(&absorbedMoves));
-            }
-        }
     }
 
     return moveList;
@@ -326,6 +356,8 @@ namespace {
   template<Color Us, GenType Type>
   ExtMove* generate_all(const Position& pos, ExtMove* moveList) {
     constexpr bool Checks = Type == QUIET_CHECKS; // Reduce template instantations
+    constexpr AbilitySplit Split = Type == QUIETS_BASE    ? BASE_ONLY
+                                 : Type == QUIETS_ABILITY ? ABSORBED_ONLY : ALL_ABILITIES;
     Bitboard target;
 
     switch (Type)
@@ -334,6 +366,8 @@ namespace {
             target =  pos.pieces(~Us);
             break;
         case QUIETS:
+        case QUIETS_BASE:
+        case QUIETS_ABILITY:
         case QUIET_CHECKS:
             target = ~pos.pieces();
             break;
@@ -351,44 +385,42 @@ namespace {
     }
 
     moveList = generate_pawn_moves<Us, Type>(pos, moveList, target);
-    
-    moveList = generate_moves<Us, KNIGHT, Checks>(pos, moveList, target);
-    moveList = generate_moves<Us, BISHOP, Checks>(pos, moveList, target);
-    moveList = generate_moves<Us,   ROOK, Checks>(pos, moveList, target);
-    moveList = generate_moves<Us,  QUEEN, Checks>(pos, moveList, target);
+
+    moveList = generate_moves<Us, KNIGHT, Checks, Split>(pos, moveList, target);
+    moveList = generate_moves<Us, BISHOP, Checks, Split>(pos, moveList, target);
+    moveList = generate_moves<Us,   ROOK, Checks, Split>(pos, moveList, target);
+    moveList = generate_moves<Us,  QUEEN, Checks, Split>(pos, moveList, target);
 
     if (Type != QUIET_CHECKS && Type != EVASIONS)
     {
         Square ksq = pos.square<KING>(Us);
-        Bitboard b = attacks_bb<KING>(ksq) & target;
+
+        // Absorb Chess: base king attacks and absorbed non-pawn abilities in
+        // one fused union, sliced the same way as in generate_moves()
+        Bitboard b = Split == BASE_ONLY
+                    ?  attacks_bb<KING>(ksq) & target
+                    : Split == ABSORBED_ONLY
+                    ?  attacks_bb_multi(KING, pos.abilities_on(ksq), ksq, pos.pieces())
+                     & ~attacks_bb<KING>(ksq) & target
+                    :  attacks_bb_multi(KING, pos.abilities_on(ksq), ksq, pos.pieces()) & target;
         while (b)
             *moveList++ = make_move(ksq, pop_lsb(&b));
 
-        // Absorb Chess: Generate moves for king's absorbed abilities  
-        for (PieceType absorbedPt = PAWN; absorbedPt <= QUEEN; ++absorbedPt) {
-            if (pos.has_ability(ksq, absorbedPt)) {
-                Bitboard absorbedMoves = 0;
-                
-                if (absorbedPt == PAWN) {
-                    // Handle pawn-like moves for king (forward pushes and captures)
-                    Direction up = pawn_push(Us);
-                    Square forward = ksq + up;
-                    if (distance(ksq, forward) == 1 && pos.empty(forward) && (target & forward))
-                        *moveList++ = make_move(ksq, forward);
-                        
-                    // Pawn captures
-                    Bitboard pawnCaptures = pawn_attacks_bb(Us, ksq) & target;
-                    while (pawnCaptures)
-                        *moveList++ = make_move(ksq, pop_lsb(&pawnCaptures));
-                } else {
-                    absorbedMoves = attacks_bb(absorbedPt, ksq, pos.pieces()) & target;
-                    while (absorbedMoves)
-                        *moveList++ = make_move(ksq, pop_lsb(&absorbedMoves));
-                }
-            }
+        // Absorb Chess: pawn-like moves for a king with the pawn ability
+        // (forward push and diagonal captures)
+        if (Split != BASE_ONLY && pos.has_ability(ksq, PAWN))
+        {
+            Direction up = pawn_push(Us);
+            Square forward = ksq + up;
+            if (distance(ksq, forward) == 1 && pos.empty(forward) && (target & forward))
+                *moveList++ = make_move(ksq, forward);
+
+            Bitboard pawnCaptures = pawn_attacks_bb(Us, ksq) & target;
+            while (pawnCaptures)
+                *moveList++ = make_move(ksq, pop_lsb(&pawnCaptures));
         }
 
-        if ((Type != CAPTURES) && pos.can_castle(Us & ANY_CASTLING))
+        if ((Type != CAPTURES && Type != QUIETS_ABILITY) && pos.can_castle(Us & ANY_CASTLING))
             for(CastlingRights cr : { Us & KING_SIDE, Us & QUEEN_SIDE } )
                 if (!pos.castling_impeded(cr) && pos.can_castle(cr))
                     *moveList++ = make<CASTLING>(ksq, pos.castling_rook_square(cr));
@@ -400,16 +432,19 @@ namespace {
 } // namespace
 
 
-/// <CAPTURES>     Generates all pseudo-legal captures plus queen and checking knight promotions
-/// <QUIETS>       Generates all pseudo-legal non-captures and underpromotions(except checking knight)
-/// <NON_EVASIONS> Generates all pseudo-legal captures and non-captures
+/// <CAPTURES>        Generates all pseudo-legal captures plus queen and checking knight promotions
+/// <QUIETS>          Generates all pseudo-legal non-captures and underpromotions(except checking knight)
+/// <QUIETS_BASE>     Absorb Chess: the base-type slice of <QUIETS>
+/// <QUIETS_ABILITY>  Absorb Chess: the absorbed-ability slice of <QUIETS>
+/// <NON_EVASIONS>    Generates all pseudo-legal captures and non-captures
 ///
 /// Returns a pointer to the end of the move list.
 
 template<GenType Type>
 ExtMove* generate(const Position& pos, ExtMove* moveList) {
 
-  static_assert(Type == CAPTURES || Type == QUIETS || Type == NON_EVASIONS, "Unsupported type in generate()");
+  static_assert(   Type == CAPTURES || Type == QUIETS || Type == QUIETS_BASE
+                || Type == QUIETS_ABILITY || Type == NON_EVASIONS, "Unsupported type in generate()");
   assert(!pos.checkers());
 
   Color us = pos.side_to_move();
@@ -421,6 +456,8 @@ ExtMove* generate(const Position& pos, ExtMove* moveList) {
 // Explicit template instantiations
 template ExtMove* generate<CAPTURES>(const Position&, ExtMove*);
 template ExtMove* generate<QUIETS>(const Position&, ExtMove*);
+template ExtMove* generate<QUIETS_BASE>(const Position&, ExtMove*);
+template ExtMove* generate<QUIETS_ABILITY>(const Position&, ExtMove*);
 template ExtMove* generate<NON_EVASIONS>(const Position&, ExtMove*);
 
 
@@ -463,19 +500,41 @@ ExtMove* generate<EVASIONS>(const Position& pos, ExtMove* moveList) {
   Color us = pos.side_to_move();
   Square ksq = pos.square<KING>(us);
   Bitboard sliderAttacks = 0;
-  Bitboard sliders = pos.checkers() & ~pos.pieces(KNIGHT, PAWN);
-
-  // Find all the squares attacked by slider checkers. We will remove them from
-  // the king evasions in order to skip known illegal moves, which avoids any
-  // useless legality checks later on.
+  Bitboard sliders = pos.checkers();
+
+  // Find all the squares attacked by checkers that check along a ray. We will
+  // remove them from the king evasions in order to skip known illegal moves,
+  // which avoids any useless legality checks later on. With absorbed abilities
+  // the base type does not tell ray checks apart from jump checks (a knight
+  // that absorbed a rook checks down a file; a blocked rook can check with an
+  // absorbed knight jump), so classify each checker by the ray families it
+  // carries and whether such a ray actually reaches the king.
   while (sliders)
-      sliderAttacks |= line_bb(ksq, pop_lsb(&sliders)) & ~pos.checkers();
+  {
+      Square checksq = pop_lsb(&sliders);
+      Abilities ab = pos.abilities_on(checksq);
+
+      if (   (   (ab & (ABILITY_ROOK | ABILITY_QUEEN))
+              && (attacks_bb<ROOK>(checksq, pos.pieces()) & ksq))
+          || (   (ab & (ABILITY_BISHOP | ABILITY_QUEEN))
+              && (attacks_bb<BISHOP>(checksq, pos.pieces()) & ksq)))
+          sliderAttacks |= line_bb(ksq, checksq) & ~pos.checkers();
+  }
 
-  // Generate evasions for king, capture and non capture moves
-  Bitboard b = attacks_bb<KING>(ksq) & ~pos.pieces(us) & ~sliderAttacks;
+  // Generate evasions for king, capture and non capture moves. The fused
+  // union covers the king's absorbed abilities too: a jump never lands on
+  // the checking line, and an ability slide along it is pruned by
+  // sliderAttacks exactly like the base step, so no legal escape is lost
+  // (everything else is vetted by legal(), as for the other evasions).
+  Bitboard b = attacks_bb_multi(KING, pos.abilities_on(ksq), ksq, pos.pieces())
+             & ~pos.pieces(us) & ~sliderAttacks;
   while (b)
       *moveList++ = make_move(ksq, pop_lsb(&b));
 
+  // No separate pawn-ability block as in generate_all(): a pawn push or
+  // capture is one step, so the base-king ring of the fused union already
+  // covers it.
+
   if (more_than_one(pos.checkers()))
       return moveList; // Double check, only a king move can save the day
 
@@ -501,6 +560,15 @@ ExtMove* generate<LEGAL>(const Position& pos, ExtMove* moveList) {
       if (   (pinned || from_sq(*cur) == ksq || type_of(*cur) == ENPASSANT)
           && !pos.legal(*cur))
           *cur = (--moveList)->move;
+      // The attack oracles are ability-aware, but gives_check() still
+      // approximates a few corners (see Position::legal()), so a missed
+      // check one ply back can leave a king en prise here, and do_move()
+      // cannot cope with the kingless board. Filter such captures like
+      // perft does; unpinned non-king moves skip legal() above, so this
+      // guard cannot be folded into it.
+      else if (   pos.capture(*cur) && type_of(*cur) == NORMAL
+               && type_of(pos.piece_on(to_sq(*cur))) == KING)
+          *cur = (--moveList)->move;
       else
           ++cur;
 
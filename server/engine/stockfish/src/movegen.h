@@ -30,6 +30,8 @@ class Position;
 enum GenType {
   CAPTURES,
   QUIETS,
+  QUIETS_BASE,    // Absorb Chess: QUIETS without the absorbed-ability moves
+  QUIETS_ABILITY, // Absorb Chess: only the absorbed-ability quiets
   QUIET_CHECKS,
   EVASIONS,
   NON_EVASIONS,
@@ -25,7 +25,8 @@
 namespace {
 
   enum Stages {
-    MAIN_TT, CAPTURE_INIT, GOOD_CAPTURE, REFUTATION, QUIET_INIT, QUIET, BAD_CAPTURE,
+    MAIN_TT, CAPTURE_INIT, GOOD_CAPTURE, REFUTATION, QUIET_INIT, QUIET,
+    QUIET_ABILITY_INIT, QUIET_ABILITY, BAD_CAPTURE,
     EVASION_TT, EVASION_INIT, EVASION,
     PROBCUT_TT, PROBCUT_INIT, PROBCUT,
     QSEARCH_TT, QCAPTURE_INIT, QCAPTURE, QCHECK_INIT, QCHECK
@@ -99,27 +100,29 @@ void MovePicker::score() {
 
   static_assert(Type == CAPTURES || Type == QUIETS || Type == EVASIONS, "Wrong type");
 
+  // Absorb Chess: the piece-indexed tables and the victim values use the
+  // effective piece, so absorb pieces build their own ordering statistics
   for (auto& m : *this)
       if (Type == CAPTURES)
-          m.value =  int(PieceValue[MG][pos.piece_on(to_sq(m))]) * 6
-                   + (*captureHistory)[pos.moved_piece(m)][to_sq(m)][type_of(pos.piece_on(to_sq(m)))];
+          m.value =  int(PieceValue[MG][pos.effective_piece_on(to_sq(m))]) * 6
+                   + (*captureHistory)[pos.effective_moved_piece(m)][to_sq(m)][type_of(pos.effective_piece_on(to_sq(m)))];
 
       else if (Type == QUIETS)
           m.value =      (*mainHistory)[pos.side_to_move()][from_to(m)]
-                   + 2 * (*continuationHistory[0])[pos.moved_piece(m)][to_sq(m)]
-                   + 2 * (*continuationHistory[1])[pos.moved_piece(m)][to_sq(m)]
-                   + 2 * (*continuationHistory[3])[pos.moved_piece(m)][to_sq(m)]
-                   +     (*continuationHistory[5])[pos.moved_piece(m)][to_sq(m)]
+                   + 2 * (*continuationHistory[0])[pos.effective_moved_piece(m)][to_sq(m)]
+                   + 2 * (*continuationHistory[1])[pos.effective_moved_piece(m)][to_sq(m)]
+                   + 2 * (*continuationHistory[3])[pos.effective_moved_piece(m)][to_sq(m)]
+                   +     (*continuationHistory[5])[pos.effective_moved_piece(m)][to_sq(m)]
                    + (ply < MAX_LPH ? std::min(4, depth / 3) * (*lowPlyHistory)[ply][from_to(m)] : 0);
 
       else // Type == EVASIONS
       {
           if (pos.capture(m))
-              m.value =  PieceValue[MG][pos.piece_on(to_sq(m))]
-                       - Value(type_of(pos.moved_piece(m)));
+              m.value =  PieceValue[MG][pos.effective_piece_on(to_sq(m))]
+                       - Value(type_of(pos.effective_moved_piece(m)));
           else
               m.value =  (*mainHistory)[pos.side_to_move()][from_to(m)]
-                       + (*continuationHistory[0])[pos.moved_piece(m)][to_sq(m)]
+                       + (*continuationHistory[0])[pos.effective_moved_piece(m)][to_sq(m)]
                        - (1 << 28);
       }
 }
@@ -195,10 +198,13 @@ top:
       /* fallthrough */
 
   case QUIET_INIT:
+      // Absorb Chess: only the base-type quiets; the absorbed-ability quiets
+      // are deferred to their own stage below, since a cutoff usually arrives
+      // before they would ever be scored
       if (!skipQuiets)
       {
           cur = endBadCaptures;
-          endMoves = generate<QUIETS>(pos, cur);
+          endMoves = generate<QUIETS_BASE>(pos, cur);
 
           score<QUIETS>();
           partial_insertion_sort(cur, endMoves, -3000 * depth);
@@ -214,6 +220,31 @@ top:
                                       && *cur != refutations[2].move;}))
           return *(cur - 1);
 
+      ++stage;
+      /* fallthrough */
+
+  case QUIET_ABILITY_INIT:
+      // Absorb Chess: the deferred absorbed-ability quiets, appended after
+      // the exhausted base quiets (ability captures were already part of the
+      // capture stages, ordered by the ability-aware SEE)
+      if (!skipQuiets)
+      {
+          endMoves = generate<QUIETS_ABILITY>(pos, cur);
+
+          score<QUIETS>();
+          partial_insertion_sort(cur, endMoves, -3000 * depth);
+      }
+
+      ++stage;
+      /* fallthrough */
+
+  case QUIET_ABILITY:
+      if (   !skipQuiets
+          && select<Next>([&](){return   *cur != refutations[0].move
+                                      && *cur != refutations[1].move
+                                      && *cur != refutations[2].move;}))
+          return *(cur - 1);
+
       // Prepare the pointers to loop over the bad captures
       cur = moves;
       endMoves = endBadCaptures;
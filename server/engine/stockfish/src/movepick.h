@@ -96,6 +96,9 @@ typedef Stats<int16_t, 10692, MAX_LPH, int(SQUARE_NB) * int(SQUARE_NB)> LowPlyHi
 
 /// CounterMoveHistory stores counter moves indexed by [piece][to] of the previous
 /// move, see www.chessprogramming.org/Countermove_Heuristic
+/// Absorb Chess: all piece-indexed tables below are addressed with the
+/// effective piece (Position::effective_piece_on), so pieces with absorbed
+/// abilities build their own statistics instead of sharing the base type's.
 typedef Stats<Move, NOT_USED, PIECE_NB, SQUARE_NB> CounterMoveHistory;
 
 /// CapturePieceToHistory is addressed by a move's [piece][to][captured piece type]
@@ -107,6 +107,18 @@ namespace {
 
         Rank r = relative_rank(Us, s);
 
+        // Absorb Chess: an absorbed ability can carry a pawn onto the last
+        // rank without promoting, or let it retreat to the first. There is no
+        // pawn structure to score there and s +/- Up would step off the board.
+        if (r == RANK_1 || r == RANK_8)
+            continue;
+
+        // Absorb Chess: a pawn that absorbed another piece's movement can
+        // defend itself, retreat and regroup, so the structural weakness
+        // penalties below do not apply to it. The ability terms of the pawn
+        // key keep the cached entries distinct.
+        bool absorbed = pos.absorbed_abilities(s);
+
         // Flag the pawn
         opposed    = theirPawns & forward_file_bb(Us, s);
         blocked    = theirPawns & (s + Up);
@@ -154,7 +166,7 @@ namespace {
             score += make_score(v, v * (r - 2) / 4);
         }
 
-        else if (!neighbours)
+        else if (!neighbours && !absorbed)
         {
             if (     opposed
                 &&  (ourPawns & forward_file_bb(Them, s))
@@ -165,11 +177,11 @@ namespace {
                         + WeakUnopposed * !opposed;
         }
 
-        else if (backward)
+        else if (backward && !absorbed)
             score -=  Backward
                     + WeakUnopposed * !opposed;
 
-        if (!support)
+        if (!support && !absorbed)
             score -=  Doubled * doubled
                     + WeakLever * more_than_one(lever);
 
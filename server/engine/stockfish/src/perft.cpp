@@ -0,0 +1,230 @@
+/*
+  Absorb Chess parallel perft tool (native only, see ../build_perft.sh).
+
+  Runs a multithreaded perft with per-root-move divide output over the absorb
+  bench corpus (or a given fen), as a correctness gate for the absorbed-ability
+  move generator and as the standard microbenchmark for movegen + do/undo
+  throughput: unlike bench it contains no search, so every cycle is spent in
+  move generation and make/unmake.
+
+  Usage: perft [depth] [threads] ["<fen> [moves ...]" | absorb | default]
+*/
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "movegen.h"
+#include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "tt.h"
+#include "uci.h"
+
+using namespace std;
+
+extern const vector<string>& absorb_bench_positions();
+
+namespace {
+
+// Default positions mirror the classical perft suite; the absorb corpus is
+// shared with bench (benchmark.cpp).
+const vector<string> PerftDefaults = {
+  "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 10",
+  "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 11"
+};
+
+// Perft transposition table keyed by the ability-aware Zobrist key: two
+// positions with identical placement but different absorbed abilities have
+// different subtrees, so the ability terms of the key matter. One table per
+// worker thread, no locking.
+struct PerftEntry {
+  Key      key;
+  int      depth;
+  uint64_t nodes;
+};
+
+class PerftTable {
+
+  vector<PerftEntry> table;
+
+public:
+  explicit PerftTable(size_t mb) : table(mb * 1024 * 1024 / sizeof(PerftEntry)) {}
+
+  bool probe(Key k, int depth, uint64_t& nodes) const {
+    const PerftEntry& e = table[k % table.size()];
+    if (e.key != k || e.depth != depth)
+        return false;
+    nodes = e.nodes;
+    return true;
+  }
+
+  void store(Key k, int depth, uint64_t nodes) {
+    PerftEntry& e = table[k % table.size()];
+    e.key = k;
+    e.depth = depth;
+    e.nodes = nodes;
+  }
+};
+
+uint64_t perft(Position& pos, int depth, PerftTable& tt) {
+
+  // The attack oracles are ability-aware, but gives_check() still misses a
+  // few corners (see Position::legal()), so in absorb positions a "legal"
+  // line can in principle still capture a king; do_move() cannot cope with a
+  // kingless board, so such moves are skipped rather than made. The filter
+  // never triggers on lines where check detection is exact, so the counts
+  // are unaffected there.
+  auto king_capture = [&pos](Move m) {
+    return pos.capture(m) && type_of(m) == NORMAL
+        && type_of(pos.piece_on(to_sq(m))) == KING;
+  };
+
+  if (depth == 1)
+  {
+      uint64_t cnt = 0;
+      for (const auto& m : MoveList<LEGAL>(pos))
+          cnt += !king_capture(m);
+      return cnt;
+  }
+
+  uint64_t nodes;
+  if (depth >= 3 && tt.probe(pos.key(), depth, nodes))
+      return nodes;
+
+  nodes = 0;
+  StateInfo st;
+  for (const auto& m : MoveList<LEGAL>(pos))
+  {
+      if (king_capture(m))
+          continue;
+
+      pos.do_move(m, st);
+      nodes += perft(pos, depth - 1, tt);
+      pos.undo_move(m);
+  }
+
+  if (depth >= 3)
+      tt.store(pos.key(), depth, nodes);
+
+  return nodes;
+}
+
+// Set up one corpus entry ("<fen> [moves ...]") into pos. The extended fen
+// dialect carries absorbed abilities directly ('[...]' suffixes, parsed by
+// Position::set()), so the bench corpus no longer needs replay; the moves
+// branch remains for hand-given entries on the command line.
+void setup(Position& pos, StateListPtr& states, const string& entry) {
+
+  istringstream is(entry);
+  string fen, token;
+
+  while (is >> token && token != "moves")
+      fen += token + " ";
+
+  states = StateListPtr(new std::deque<StateInfo>(1));
+  // do_move() bumps thisThread->nodes, so the position must be attached to a
+  // real thread; the main thread's counter is shared by all workers
+  pos.set(fen, false, &states->back(), Threads.main());
+
+  while (is >> token)
+  {
+      Move m = UCI::to_move(pos, token);
+      if (m == MOVE_NONE)
+      {
+          cerr << "Illegal move '" << token << "' in: " << entry << endl;
+          exit(EXIT_FAILURE);
+      }
+      states->emplace_back();
+      pos.do_move(m, states->back());
+  }
+}
+
+void run_entry(const string& entry, int depth, int threadCount) {
+
+  Position rootPos;
+  StateListPtr rootStates;
+  setup(rootPos, rootStates, entry);
+
+  cout << "\nPosition: " << entry << endl;
+
+  vector<ExtMove> rootMoves;
+  for (const auto& m : MoveList<LEGAL>(rootPos))
+      // Same king-capture filter as perft() above
+      if (!(rootPos.capture(m) && type_of(m.move) == NORMAL
+            && type_of(rootPos.piece_on(to_sq(m))) == KING))
+          rootMoves.push_back(m);
+
+  vector<uint64_t> counts(rootMoves.size(), 0);
+  std::atomic<size_t> next(0);
+
+  TimePoint elapsed = now();
+
+  auto worker = [&]() {
+    Position pos;
+    StateListPtr states;
+    setup(pos, states, entry);
+    PerftTable tt(16);
+
+    for (size_t i = next.fetch_add(1); i < rootMoves.size(); i = next.fetch_add(1))
+    {
+        StateInfo st;
+        pos.do_move(rootMoves[i].move, st);
+        counts[i] = depth > 1 ? perft(pos, depth - 1, tt) : 1;
+        pos.undo_move(rootMoves[i].move);
+    }
+  };
+
+  vector<std::thread> pool;
+  for (int t = 0; t < threadCount; t++)
+      pool.emplace_back(worker);
+  for (auto& th : pool)
+      th.join();
+
+  elapsed = now() - elapsed + 1;
+
+  uint64_t nodes = 0;
+  for (size_t i = 0; i < rootMoves.size(); i++)
+  {
+      cout << UCI::move(rootMoves[i].move, rootPos.is_chess960())
+           << ": " << counts[i] << endl;
+      nodes += counts[i];
+  }
+
+  cout << "Nodes: " << nodes
+       << "\nTime (ms): " << elapsed
+       << "\nNodes/second: " << 1000 * nodes / elapsed << endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+
+  UCI::init(Options);
+  AbsorbChess::init_tables();
+  Bitboards::init();
+  Position::init();
+  Threads.set_synchronous(); // Engine threads stay unused; workers are local
+
+  int depth       = argc > 1 ? atoi(argv[1]) : 5;
+  int threadCount = argc > 2 ? atoi(argv[2]) : int(std::thread::hardware_concurrency());
+  string corpus   = argc > 3 ? argv[3] : "absorb";
+
+  vector<string> entries;
+  if (corpus == "absorb")
+      entries = absorb_bench_positions();
+  else if (corpus == "default")
+      entries = PerftDefaults;
+  else
+      entries.push_back(corpus);
+
+  for (const string& entry : entries)
+      run_entry(entry, depth, threadCount);
+
+  Threads.set(0);
+  return 0;
+}
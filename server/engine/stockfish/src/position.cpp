@@ -41,6 +41,10 @@ namespace Zobrist {
   Key enpassant[FILE_NB];
   Key castling[CASTLING_RIGHT_NB];
   Key side, noPawns;
+
+  // Absorb Chess: one key per (color, ability, square) so that positions
+  // differing only in which piece holds an absorbed ability hash differently
+  Key ability[COLOR_NB][PIECE_TYPE_NB][SQUARE_NB];
 }
 
 namespace {
@@ -49,6 +53,33 @@ const string PieceToChar(" PNBRQK  pnbrqk");
 
 constexpr Piece Pieces[] = { W_PAWN, W_KNIGHT, W_BISHOP, W_ROOK, W_QUEEN, W_KING,
                              B_PAWN, B_KNIGHT, B_BISHOP, B_ROOK, B_QUEEN, B_KING };
+
+// Absorb Chess: effective material type of a piece given its ability mask.
+// Kings stay KING regardless of absorbed abilities.
+PieceType effective_material_type(PieceType basePt, Abilities abilities) {
+  return basePt == KING ? KING : get_effective_material_type(basePt, abilities);
+}
+
+// Exchange value of a piece for see_ge(): what its effective material type is
+// worth. Kings keep value zero as in the classical code.
+Value see_value(Piece pc, Abilities abilities) {
+  return pc == NO_PIECE ? VALUE_ZERO
+                        : PieceValue[MG][effective_material_type(type_of(pc), abilities)];
+}
+
+// Absorb Chess: ability terms of a pawn for the pawn hash key, one per set
+// ability bit. A pawn's absorbed abilities change how it moves and attacks,
+// so pawn structures that differ only in them must not share a pawn-table
+// entry. Reuses the Zobrist::ability values of the main key.
+Key pawn_ability_key(Color c, Abilities abilities, Square s) {
+
+  Key k = 0;
+  for (PieceType pt = PAWN; pt <= KING; ++pt)
+      if (abilities & (1 << (pt - 1)))
+          k ^= Zobrist::ability[c][pt][s];
+  return k;
+}
+
 } // namespace
 
 
@@ -110,6 +141,11 @@ void Position::init() {
   Zobrist::side = rng.rand<Key>();
   Zobrist::noPawns = rng.rand<Key>();
 
+  for (Color c : { WHITE, BLACK })
+      for (PieceType pt = PAWN; pt <= KING; ++pt)
+          for (Square s = SQ_A1; s <= SQ_H8; ++s)
+              Zobrist::ability[c][pt][s] = rng.rand<Key>();
+
   // Prepare the cuckoo tables
   std::memset(cuckoo, 0, sizeof(cuckoo));
   std::memset(cuckooMove, 0, sizeof(cuckooMove));
@@ -120,7 +156,13 @@ void Position::init() {
               if ((type_of(pc) != PAWN) && (attacks_bb(type_of(pc), s1, 0) & s2))
               {
                   Move move = make_move(s1, s2);
-                  Key key = Zobrist::psq[pc][s1] ^ Zobrist::psq[pc][s2] ^ Zobrist::side;
+                  // Absorb Chess: the base ability travels with the piece, so
+                  // the reversible-move key includes its ability terms. Moves
+                  // of pieces holding absorbed abilities simply never match.
+                  Key key =  Zobrist::psq[pc][s1] ^ Zobrist::psq[pc][s2]
+                           ^ Zobrist::ability[color_of(pc)][type_of(pc)][s1]
+                           ^ Zobrist::ability[color_of(pc)][type_of(pc)][s2]
+                           ^ Zobrist::side;
                   int i = H1(key);
                   while (true)
                   {
@@ -174,6 +216,12 @@ Position& Position::set(const string& fenStr, bool isChess960, StateInfo* si, Th
 
    6) Fullmove number. The number of the full move. It starts at 1, and is
       incremented after Black's move.
+
+   Absorb Chess extends field 1: a piece may carry a '[...]' suffix listing
+   its absorbed abilities in lowercase piece letters, e.g. "Q[n]" for a queen
+   that absorbed a knight or "P[rb]" for a pawn with rook and bishop
+   abilities. fen() emits the suffix, so positions round-trip losslessly;
+   plain FEN parses unchanged (no suffix means base abilities only).
 */
 
   unsigned char col, row, token;
@@ -200,6 +248,17 @@ Position& Position::set(const string& fenStr, bool isChess960, StateInfo* si, Th
       else if ((idx = PieceToChar.find(token)) != string::npos)
       {
           put_piece(Piece(idx), sq);
+
+          // Absorb Chess: optional '[...]' ability suffix, see the dialect
+          // note above. put_piece() already gave the piece its base ability.
+          if (ss.peek() == '[')
+          {
+              ss >> token; // Consume '['
+              while ((ss >> token) && token != ']')
+                  if ((idx = PieceToChar.find(char(tolower(token)))) != string::npos)
+                      add_ability(sq, type_of(Piece(idx)));
+          }
+
           ++sq;
       }
   }
@@ -267,14 +326,12 @@ Position& Position::set(const string& fenStr, bool isChess960, StateInfo* si, Th
 
   chess960 = isChess960;
   thisThread = th;
-  
-  // Absorb Chess: Initialize abilities - pieces start with their own base abilities
-  for (Color c : {WHITE, BLACK}) {
-    for (PieceType pt = PAWN; pt <= KING; ++pt) {
-      abilityBB[c][pt] = pieces(c, pt);
-    }
-  }
-  
+
+  // Absorb Chess: put_piece() seeded every piece with its base ability and
+  // the placement loop added the absorbed ones from the '[...]' suffixes, so
+  // abilityBB/abilityOf are already consistent. set_state() below recomputes
+  // the keys from scratch, discarding whatever the incremental updates wrote
+  // into the zeroed StateInfo.
   set_state(st);
 
   assert(pos_is_ok());
@@ -283,6 +340,18 @@ Position& Position::set(const string& fenStr, bool isChess960, StateInfo* si, Th
 }
 
 
+/// Position::refresh() recomputes the derived StateInfo data (hash keys,
+/// effective material counts, checkers) from the current board and ability
+/// occupancy. set() parses the '[...]' ability suffixes itself, so the usual
+/// setup path no longer needs this; it remains for callers that poke
+/// abilities into an existing position with set_abilities() and then have to
+/// bring the material key and the effective-type counts back in sync.
+
+void Position::refresh() {
+  set_state(st);
+}
+
+
 /// Position::set_castling_right() is a helper function used to set castling
 /// rights given the corresponding color and the rook starting square.
 
@@ -319,6 +388,27 @@ void Position::set_check_info(StateInfo* si) const {
   si->checkSquares[ROOK]   = attacks_bb<ROOK>(ksq, pieces());
   si->checkSquares[QUEEN]  = si->checkSquares[BISHOP] | si->checkSquares[ROOK];
   si->checkSquares[KING]   = 0;
+
+  // Absorb Chess: precompute the fused check mask for every friendly piece
+  // that absorbed an ability, so check_squares_multi() stays one lookup.
+  // Pieces whose ability mask holds only their base type are left to the
+  // plain checkSquares[] fallback.
+  si->absorbCheckCandidates = 0;
+  for (PieceType pt = PAWN; pt <= KING; ++pt)
+      si->absorbCheckCandidates |= abilityBB[sideToMove][pt] & ~pieces(pt);
+
+  for (Bitboard b = si->absorbCheckCandidates; b; )
+  {
+      Square s = pop_lsb(&b);
+      Abilities ab = abilities_on(s) | (1 << (type_of(piece_on(s)) - 1));
+
+      Bitboard mask = 0;
+      for (PieceType pt = PAWN; pt <= KING; ++pt)
+          if (ab & (1 << (pt - 1)))
+              mask |= si->checkSquares[pt];
+
+      si->absorbCheckSquares[s] = mask;
+  }
 }
 
 
@@ -332,7 +422,7 @@ void Position::set_state(StateInfo* si) const {
   si->key = si->materialKey = 0;
   si->pawnKey = Zobrist::noPawns;
   si->nonPawnMaterial[WHITE] = si->nonPawnMaterial[BLACK] = VALUE_ZERO;
-  si->checkersBB = attackers_to(square<KING>(sideToMove)) & pieces(~sideToMove);
+  si->checkersBB = attackers_to(square<KING>(sideToMove), pieces()) & pieces(~sideToMove);
 
   set_check_info(si);
 
@@ -343,16 +433,16 @@ void Position::set_state(StateInfo* si) const {
       si->key ^= Zobrist::psq[pc][s];
 
       if (type_of(pc) == PAWN)
-          si->pawnKey ^= Zobrist::psq[pc][s];
-
-      else if (type_of(pc) != KING)
-      {
-          // Absorb Chess: count non-pawn material using effective piece types
-          Abilities abilities = abilities_on(s);
-          PieceType effectivePt = get_effective_material_type(type_of(pc), abilities);
-          Piece effectivePc = make_piece(color_of(pc), effectivePt);
-          si->nonPawnMaterial[color_of(pc)] += PieceValue[MG][effectivePc];
-      }
+          si->pawnKey ^= Zobrist::psq[pc][s]
+                       ^ pawn_ability_key(color_of(pc), abilities_on(s), s);
+
+      // Absorb Chess: non-pawn material counts effective piece types, so a
+      // pawn that absorbed a piece-moving ability weighs in as that piece.
+      // The lazy-eval thresholds and the null-move/endgame conditions keyed
+      // on this counter then see the board's real strength, not base types.
+      PieceType effectivePt = effective_material_type(type_of(pc), abilities_on(s));
+      if (effectivePt != PAWN && effectivePt != KING)
+          si->nonPawnMaterial[color_of(pc)] += PieceValue[MG][effectivePt];
   }
 
   if (si->epSquare != SQ_NONE)
@@ -363,9 +453,39 @@ void Position::set_state(StateInfo* si) const {
 
   si->key ^= Zobrist::castling[si->castlingRights];
 
-  for (Piece pc : Pieces)
-      for (int cnt = 0; cnt < pieceCount[pc]; ++cnt)
-          si->materialKey ^= Zobrist::psq[pc][cnt];
+  // Absorb Chess: fold the ability occupancy into the position key so that
+  // positions differing only in absorbed abilities get distinct TT entries
+  si->abilityKey = 0;
+  for (Color c : { WHITE, BLACK })
+      for (PieceType pt = PAWN; pt <= KING; ++pt)
+          for (Bitboard b = abilityBB[c][pt]; b; )
+              si->abilityKey ^= Zobrist::ability[c][pt][pop_lsb(&b)];
+
+  si->key ^= si->abilityKey;
+
+  // Absorb Chess: the material key and the effective-type counts are both
+  // based on effective material types, so positions whose pieces differ only
+  // in absorbed abilities get distinct material entries. For pieces with base
+  // abilities only this reduces to the plain per-piece-count key.
+  std::memset(si->effectiveCount, 0, sizeof(si->effectiveCount));
+  for (Bitboard b = pieces(); b; )
+  {
+      Square s = pop_lsb(&b);
+      Piece pc = piece_on(s);
+      PieceType effPt = effective_material_type(type_of(pc), abilities_on(s));
+      si->materialKey ^= Zobrist::psq[make_piece(color_of(pc), effPt)]
+                                     [si->effectiveCount[color_of(pc)][effPt]++];
+  }
+
+  // Kings keep effective type KING, so a king that absorbed an ability would
+  // otherwise share its material key with a plain-king position and the
+  // endgame map could serve an exact plain-king evaluation (KXK, the KPK
+  // bitbase) for a king that no longer moves like one. Fold the absorbed
+  // abilities in separately; the king count slot only ever uses index 0, so
+  // the ability mask (1..63) addresses otherwise unused Zobrist entries.
+  for (Color c : { WHITE, BLACK })
+      if (Abilities a = absorbed_abilities(square<KING>(c)))
+          si->materialKey ^= Zobrist::psq[make_piece(c, KING)][a];
 }
 
 
@@ -411,7 +531,21 @@ const string Position::fen() const {
               ss << emptyCnt;
 
           if (f <= FILE_H)
-              ss << PieceToChar[piece_on(make_square(f, r))];
+          {
+              Square s = make_square(f, r);
+              ss << PieceToChar[piece_on(s)];
+
+              // Absorb Chess: absorbed abilities as a '[...]' suffix in
+              // lowercase piece letters, so set() round-trips the position
+              if (Abilities a = absorbed_abilities(s))
+              {
+                  ss << '[';
+                  for (PieceType pt = PAWN; pt <= KING; ++pt)
+                      if (a & (1 << (pt - 1)))
+                          ss << PieceToChar[make_piece(BLACK, pt)];
+                  ss << ']';
+              }
+          }
       }
 
       if (r > RANK_1)
@@ -454,9 +588,17 @@ Bitboard Position::slider_blockers(Bitboard sliders, Square s, Bitboard& pinners
   Bitboard blockers = 0;
   pinners = 0;
 
-  // Snipers are sliders that attack 's' when a piece and other snipers are removed
-  Bitboard snipers = (  (attacks_bb<  ROOK>(s) & pieces(QUEEN, ROOK))
-                      | (attacks_bb<BISHOP>(s) & pieces(QUEEN, BISHOP))) & sliders;
+  // Snipers are sliders that attack 's' when a piece and other snipers are
+  // removed. A piece snipes along every ray family it carries, so the family
+  // masks union the base boards with the ability boards of both colors (the
+  // 'sliders' argument then restricts to the attacking side): a knight that
+  // absorbed a rook pins down a file like a rook does.
+  Bitboard queens  = pieces(QUEEN)  | abilityBB[WHITE][QUEEN]  | abilityBB[BLACK][QUEEN];
+  Bitboard rooks   = pieces(ROOK)   | abilityBB[WHITE][ROOK]   | abilityBB[BLACK][ROOK]   | queens;
+  Bitboard bishops = pieces(BISHOP) | abilityBB[WHITE][BISHOP] | abilityBB[BLACK][BISHOP] | queens;
+
+  Bitboard snipers = (  (attacks_bb<  ROOK>(s) & rooks)
+                      | (attacks_bb<BISHOP>(s) & bishops)) & sliders;
   Bitboard occupancy = pieces() ^ snipers;
 
   while (snipers)
@@ -496,15 +638,36 @@ Bitboard Position::slider_blockers(Bitboard sliders, Square s, Bitboard& pinners
 
 /// Position::attackers_to() computes a bitboard of all pieces which attack a
 /// given square. Slider attacks use the occupied bitboard to indicate occupancy.
+/// In absorb chess a piece attacks through every movement type it carries, so
+/// each family mask is the union of the base pieces and the ability boards of
+/// both colors. Pawn attacks stay color-dependent even when absorbed. The union
+/// combines a dozen boards, so it goes through Bitboard2 pairs: under
+/// USE_WASM_SIMD each or2()/and2() is one 128-bit instruction, and without the
+/// flag the helpers flatten back into the plain scalar expression.
 
 Bitboard Position::attackers_to(Square s, Bitboard occupied) const {
 
-  return  (pawn_attacks_bb(BLACK, s)       & pieces(WHITE, PAWN))
-        | (pawn_attacks_bb(WHITE, s)       & pieces(BLACK, PAWN))
-        | (attacks_bb<KNIGHT>(s)           & pieces(KNIGHT))
-        | (attacks_bb<  ROOK>(s, occupied) & pieces(  ROOK, QUEEN))
-        | (attacks_bb<BISHOP>(s, occupied) & pieces(BISHOP, QUEEN))
-        | (attacks_bb<KING>(s)             & pieces(KING));
+  Bitboard queens = pieces(QUEEN) | abilityBB[WHITE][QUEEN] | abilityBB[BLACK][QUEEN];
+
+  // Lanes are (rook family, bishop family) and (knight family, king family)
+  Bitboard2 rb = or2(or2(make_bitboard2(pieces(ROOK), pieces(BISHOP)),
+                         make_bitboard2(abilityBB[WHITE][ROOK], abilityBB[WHITE][BISHOP])),
+                     or2(make_bitboard2(abilityBB[BLACK][ROOK], abilityBB[BLACK][BISHOP]),
+                         make_bitboard2(queens, queens)));
+
+  Bitboard2 nk = or2(or2(make_bitboard2(pieces(KNIGHT), pieces(KING)),
+                         make_bitboard2(abilityBB[WHITE][KNIGHT], abilityBB[WHITE][KING])),
+                     make_bitboard2(abilityBB[BLACK][KNIGHT], abilityBB[BLACK][KING]));
+
+  // Lanes are (white pawn attackers, black pawn attackers)
+  Bitboard2 pawns = and2(make_bitboard2(pawn_attacks_bb(BLACK, s), pawn_attacks_bb(WHITE, s)),
+                         or2(make_bitboard2(pieces(WHITE, PAWN), pieces(BLACK, PAWN)),
+                             make_bitboard2(abilityBB[WHITE][PAWN], abilityBB[BLACK][PAWN])));
+
+  return fold_or(or2(pawns,
+                     or2(and2(make_bitboard2(attacks_bb<ROOK>(s, occupied),
+                                             attacks_bb<BISHOP>(s, occupied)), rb),
+                         and2(make_bitboard2(attacks_bb<KNIGHT>(s), attacks_bb<KING>(s)), nk))));
 }
 
 
@@ -521,6 +684,16 @@ bool Position::legal(Move m) const {
   assert(color_of(moved_piece(m)) == us);
   assert(piece_on(square<KING>(us)) == make_piece(us, KING));
 
+  // With ability-aware attack oracles a king should never stand en prise,
+  // but gives_check() still approximates a few corners (an en-passant or
+  // promotion whose absorbed abilities strike through the squares the move
+  // itself vacates), and a missed check means the next ply generates
+  // non-evasions that can include the king's capture; do_move() cannot cope
+  // with the kingless board that results. Keep this cheap last-line guard
+  // (generate<LEGAL> and perft filter likewise).
+  if (capture(m) && type_of(m) == NORMAL && type_of(piece_on(to)) == KING)
+      return false;
+
   // En passant captures are a tricky special case. Because they are rather
   // uncommon, we do it simply by testing whether the king is attacked after
   // the move is made.
@@ -535,8 +708,11 @@ bool Position::legal(Move m) const {
       assert(piece_on(capsq) == make_piece(~us, PAWN));
       assert(piece_on(to) == NO_PIECE);
 
-      return   !(attacks_bb<  ROOK>(ksq, occupied) & pieces(~us, QUEEN, ROOK))
-            && !(attacks_bb<BISHOP>(ksq, occupied) & pieces(~us, QUEEN, BISHOP));
+      // The full ability-aware oracle rather than the classical rook/bishop
+      // rays: with absorbed abilities any piece may attack through the two
+      // vacated squares. Masking by 'occupied' drops the captured pawn,
+      // whose piece board still holds it.
+      return !(attackers_to(ksq, occupied) & pieces(~us) & occupied);
   }
 
   // Castling moves generation does not check if the castling path is clear of
@@ -653,8 +829,14 @@ bool Position::gives_check(Move m) const {
   Square from = from_sq(m);
   Square to = to_sq(m);
 
-  // Is there a direct check?
-  if (check_squares(type_of(piece_on(from))) & to)
+  // Is there a direct check? The fused mask covers the mover's base type
+  // and absorbed abilities; a capture also absorbs the victim's base type,
+  // which can itself deliver the check from the arrival square.
+  Bitboard directChecks = check_squares_multi(from);
+  if (type_of(m) == NORMAL && piece_on(to) != NO_PIECE)
+      directChecks |= check_squares(type_of(piece_on(to)));
+
+  if (directChecks & to)
       return true;
 
   // Is there a discovered check?
@@ -673,14 +855,14 @@ bool Position::gives_check(Move m) const {
   // En passant capture with check? We have already handled the case
   // of direct checks and ordinary discovered check, so the only case we
   // need to handle is the unusual case of a discovered check through
-  // the captured pawn.
+  // the captured pawn. The ability-aware oracle covers discoverers of any
+  // base type; masking by 'b' drops the two pawns the move removes.
   case ENPASSANT:
   {
       Square capsq = make_square(file_of(to), rank_of(from));
       Bitboard b = (pieces() ^ from ^ capsq) | to;
 
-      return  (attacks_bb<  ROOK>(square<KING>(~sideToMove), b) & pieces(sideToMove, QUEEN, ROOK))
-            | (attacks_bb<BISHOP>(square<KING>(~sideToMove), b) & pieces(sideToMove, QUEEN, BISHOP));
+      return attackers_to(square<KING>(~sideToMove), b) & pieces(sideToMove) & b;
   }
   case CASTLING:
   {
@@ -708,6 +890,8 @@ void Position::do_move(Move m, StateInfo& newSt, bool givesCheck) {
   assert(is_ok(m));
   assert(&newSt != st);
 
+  ABSORB_PROF_SCOPE(DO_MOVE);
+
   thisThread->nodes.fetch_add(1, std::memory_order_relaxed);
   Key k = st->key ^ Zobrist::side;
 
@@ -735,14 +919,26 @@ void Position::do_move(Move m, StateInfo& newSt, bool givesCheck) {
   assert(captured == NO_PIECE || color_of(captured) == (type_of(m) != CASTLING ? them : us));
   assert(type_of(captured) != KING);
 
+  // Absorb Chess: Remember the mover's abilities for exact restoration on undo
+  st->moverAbilities = abilities_on(from);
+
   if (type_of(m) == CASTLING)
   {
       assert(pc == make_piece(us, KING));
       assert(captured == make_piece(us, ROOK));
 
+      // Absorb Chess: do_castling() rebuilds both pieces with their base
+      // abilities only, so save and carry any absorbed ones across
+      st->capturedAbilities = abilities_on(to);
+
       Square rfrom, rto;
       do_castling<true>(us, from, to, rfrom, rto);
 
+      if (abilities_on(to) != st->moverAbilities)
+          set_abilities(to, st->moverAbilities);
+      if (abilities_on(rto) != st->capturedAbilities)
+          set_abilities(rto, st->capturedAbilities);
+
       k ^= Zobrist::psq[captured][rfrom] ^ Zobrist::psq[captured][rto];
       captured = NO_PIECE;
   }
@@ -766,23 +962,37 @@ void Position::do_move(Move m, StateInfo& newSt, bool givesCheck) {
               assert(piece_on(capsq) == make_piece(them, PAWN));
           }
 
-          st->pawnKey ^= Zobrist::psq[captured][capsq];
+          // The victim may be our own pawn when absorbing a friendly piece,
+          // so take the color from the piece rather than assuming 'them'
+          st->pawnKey ^= Zobrist::psq[captured][capsq]
+                       ^ pawn_ability_key(color_of(captured), abilities_on(capsq), capsq);
       }
-      else
-          st->nonPawnMaterial[them] -= PieceValue[MG][captured];
 
       // Absorb Chess: Save captured piece's abilities for restoration on undo
       st->capturedAbilities = abilities_on(capsq);
 
+      // The victim leaves non-pawn material at its effective value, under
+      // its own color (the victim may be ours when absorbing a friendly
+      // piece). An ability-carrying pawn leaves like the piece it moved as.
+      PieceType effCap = effective_material_type(type_of(captured), st->capturedAbilities);
+      if (effCap != PAWN && effCap != KING)
+          st->nonPawnMaterial[color_of(captured)] -= PieceValue[MG][effCap];
+
       // Update board and piece lists
       remove_piece(capsq);
 
       if (type_of(m) == ENPASSANT)
           board[capsq] = NO_PIECE;
 
-      // Update material hash key and prefetch access to materialTable
+      // Update material hash key and prefetch access to materialTable. The
+      // material key tracks effective types, so remove the victim with the
+      // abilities it held, under its own color (it may be ours when
+      // absorbing a friendly piece).
       k ^= Zobrist::psq[captured][capsq];
-      st->materialKey ^= Zobrist::psq[captured][pieceCount[captured]];
+      Color capColor = color_of(captured);
+      PieceType effCaptured = effective_material_type(type_of(captured), st->capturedAbilities);
+      st->materialKey ^= Zobrist::psq[make_piece(capColor, effCaptured)]
+                                     [--st->effectiveCount[capColor][effCaptured]];
       prefetch(thisThread->materialTable[st->materialKey]);
 
       // Reset rule 50 counter
@@ -822,8 +1032,12 @@ void Position::do_move(Move m, StateInfo& newSt, bool givesCheck) {
   // If the moving piece is a pawn do some special extra work
   if (type_of(pc) == PAWN)
   {
-      // Set en-passant square if the moved pawn can be captured
-      if (   (int(to) ^ int(from)) == 16
+      // Set en-passant square if the moved pawn can be captured.
+      // Absorb Chess: a pawn with an absorbed slider ability can also move
+      // two squares vertically (even backwards), so the upstream xor test is
+      // not enough: require a genuine double push from the starting rank.
+      if (   to == from + 2 * pawn_push(us)
+          && relative_rank(us, from) == RANK_2
           && (pawn_attacks_bb(us, to - pawn_push(us)) & pieces(them, PAWN)))
       {
           st->epSquare = to - pawn_push(us);
@@ -840,31 +1054,79 @@ void Position::do_move(Move m, StateInfo& newSt, bool givesCheck) {
           remove_piece(to);
           put_piece(promotion, to);
 
-          // Update hash keys
+          // Update hash keys. The material and non-pawn-material changes are
+          // handled below together with absorption, as both alter the
+          // effective type.
           k ^= Zobrist::psq[pc][to] ^ Zobrist::psq[promotion][to];
           st->pawnKey ^= Zobrist::psq[pc][to];
-          st->materialKey ^=  Zobrist::psq[promotion][pieceCount[promotion]-1]
-                            ^ Zobrist::psq[pc][pieceCount[pc]];
-
-          // Update material
-          st->nonPawnMaterial[us] += PieceValue[MG][promotion];
       }
 
-      // Update pawn hash key
-      st->pawnKey ^= Zobrist::psq[pc][from] ^ Zobrist::psq[pc][to];
+      // Update pawn hash key. The ability terms mirror the piece term: the
+      // from-terms go out with the abilities the pawn left with, the to-terms
+      // come in with the abilities it holds after any absorption. A promoted
+      // pawn leaves the pawn key entirely, so it gets no to-terms (its psq
+      // to-term cancels against the one removed in the promotion block above).
+      st->pawnKey ^= Zobrist::psq[pc][from] ^ Zobrist::psq[pc][to]
+                   ^ pawn_ability_key(us, st->moverAbilities, from);
+
+      if (type_of(m) != PROMOTION)
+          st->pawnKey ^= pawn_ability_key(us, abilities_on(to), to);
 
       // Reset rule 50 draw counter
       st->rule50 = 0;
   }
 
+  // Absorb Chess: absorption and promotion can change the mover's effective
+  // material type; update the count and the material key accordingly. Quiet
+  // moves and castling leave the ability mask, and with it the effective
+  // type, unchanged. Undo restores both via the saved StateInfo.
+  if (type_of(m) != CASTLING)
+  {
+      PieceType oldEff = effective_material_type(type_of(pc), st->moverAbilities);
+      PieceType newEff = effective_material_type(type_of(piece_on(to)), abilities_on(to));
+
+      if (oldEff != newEff)
+      {
+          st->materialKey ^= Zobrist::psq[make_piece(us, oldEff)]
+                                         [--st->effectiveCount[us][oldEff]];
+          st->materialKey ^= Zobrist::psq[make_piece(us, newEff)]
+                                         [st->effectiveCount[us][newEff]++];
+
+          // Non-pawn material follows the effective type as well; this
+          // covers promotion, absorption and their combination in one place
+          if (oldEff != PAWN && oldEff != KING)
+              st->nonPawnMaterial[us] -= PieceValue[MG][oldEff];
+          if (newEff != PAWN && newEff != KING)
+              st->nonPawnMaterial[us] += PieceValue[MG][newEff];
+      }
+
+      // A king's effective type never changes, so its absorbed abilities are
+      // folded into the material key as a separate term; see set_state()
+      if (type_of(piece_on(to)) == KING)
+      {
+          Abilities oldAbs = Abilities(st->moverAbilities & ~ABILITY_KING);
+          Abilities newAbs = Abilities(abilities_on(to)   & ~ABILITY_KING);
+
+          if (oldAbs != newAbs)
+          {
+              if (oldAbs)
+                  st->materialKey ^= Zobrist::psq[make_piece(us, KING)][oldAbs];
+              if (newAbs)
+                  st->materialKey ^= Zobrist::psq[make_piece(us, KING)][newAbs];
+          }
+      }
+  }
+
   // Set capture piece
   st->capturedPiece = captured;
 
-  // Update the key with the final value
-  st->key = k;
+  // Update the key with the final value. The ability component is maintained
+  // incrementally in st->abilityKey by the ability helpers, so swap the old
+  // component out of k and the new one in.
+  st->key = k ^ st->previous->abilityKey ^ st->abilityKey;
 
   // Calculate checkers bitboard (if move gives check)
-  st->checkersBB = givesCheck ? attackers_to(square<KING>(them)) & pieces(us) : 0;
+  st->checkersBB = givesCheck ? attackers_to(square<KING>(them), pieces()) & pieces(us) : 0;
 
   sideToMove = ~sideToMove;
 
@@ -926,6 +1188,12 @@ void Position::undo_move(Move m) {
   {
       Square rfrom, rto;
       do_castling<false>(us, from, to, rfrom, rto);
+
+      // Absorb Chess: Restore any absorbed abilities of king and rook
+      if (abilities_on(from) != st->moverAbilities)
+          set_abilities(from, st->moverAbilities);
+      if (abilities_on(rfrom) != st->capturedAbilities)
+          set_abilities(rfrom, st->capturedAbilities);
   }
   else
   {
@@ -950,11 +1218,13 @@ void Position::undo_move(Move m) {
 
           // Absorb Chess: Restore captured piece's abilities
           set_abilities(capsq, st->capturedAbilities);
-          
-          // Absorb Chess: Remove absorbed ability from the moving piece
-          PieceType capturedType = type_of(st->capturedPiece);
-          remove_ability_from_square(from, capturedType);
       }
+
+      // Absorb Chess: Restore the mover's pre-move abilities exactly. This
+      // undoes absorption without touching the base ability on a same-type
+      // capture, and recovers abilities a promotion discarded.
+      if (abilities_on(from) != st->moverAbilities)
+          set_abilities(from, st->moverAbilities);
   }
 
   // Finally point our state pointer back to the previous state
@@ -1041,7 +1311,7 @@ Key Position::key_after(Move m) const {
   if (captured)
       k ^= Zobrist::psq[captured][to];
 
-  return k ^ Zobrist::psq[pc][to] ^ Zobrist::psq[pc][from];
+  return k ^ Zobrist::psq[pc][to] ^ Zobrist::psq[pc][from] ^ ttTag;
 }
 
 
@@ -1059,18 +1329,25 @@ bool Position::see_ge(Move m, Value threshold) const {
 
   Square from = from_sq(m), to = to_sq(m);
 
-  int swap = PieceValue[MG][piece_on(to)] - threshold;
+  // Capturing a piece also absorbs its abilities, so keep a running union of
+  // everything piled up on 'to': each attacker is valued as the piece it will
+  // have become by the time it can be taken back.
+  Abilities acquired = abilities_on(to);
+
+  int swap = see_value(piece_on(to), acquired) - threshold;
   if (swap < 0)
       return false;
 
-  swap = PieceValue[MG][piece_on(from)] - swap;
+  swap = see_value(piece_on(from), abilities_on(from) | acquired) - swap;
   if (swap <= 0)
       return true;
 
+  acquired |= abilities_on(from);
+
   Bitboard occupied = pieces() ^ from ^ to;
   Color stm = color_of(piece_on(from));
-  Bitboard attackers = attackers_to(to, occupied);
-  Bitboard stmAttackers, bb;
+  Bitboard attackers = attackers_to(to, occupied) & occupied;
+  Bitboard stmAttackers, b;
   int res = 1;
 
   while (true)
@@ -1092,57 +1369,50 @@ bool Position::see_ge(Move m, Value threshold) const {
 
       res ^= 1;
 
-      // Locate and remove the next least valuable attacker, and add to
-      // the bitboard 'attackers' any X-ray attackers behind it.
-      if ((bb = stmAttackers & pieces(PAWN)))
-      {
-          if ((swap = PawnValueMg - swap) < res)
-              break;
-
-          occupied ^= lsb(bb);
-          attackers |= attacks_bb<BISHOP>(to, occupied) & pieces(BISHOP, QUEEN);
-      }
+      // Locate the least valuable attacker. With absorbed abilities the
+      // classical base-type stages no longer give the value order, and the
+      // attacker sets are small, so just scan them. The king is kept for
+      // last whatever abilities it carries: it cannot be recaptured.
+      Square lva = SQ_NONE;
+      int lvaValue = 0;
+      bool lvaIsKing = true;
 
-      else if ((bb = stmAttackers & pieces(KNIGHT)))
+      for (b = stmAttackers; b; )
       {
-          if ((swap = KnightValueMg - swap) < res)
-              break;
-
-          occupied ^= lsb(bb);
-      }
+          Square s = pop_lsb(&b);
 
-      else if ((bb = stmAttackers & pieces(BISHOP)))
-      {
-          if ((swap = BishopValueMg - swap) < res)
-              break;
+          if (type_of(piece_on(s)) == KING)
+          {
+              if (lva == SQ_NONE)
+                  lva = s;
+              continue;
+          }
 
-          occupied ^= lsb(bb);
-          attackers |= attacks_bb<BISHOP>(to, occupied) & pieces(BISHOP, QUEEN);
+          int v = see_value(piece_on(s), abilities_on(s) | acquired);
+          if (lva == SQ_NONE || lvaIsKing || v < lvaValue)
+          {
+              lva = s;
+              lvaValue = v;
+              lvaIsKing = false;
+          }
       }
 
-      else if ((bb = stmAttackers & pieces(ROOK)))
-      {
-          if ((swap = RookValueMg - swap) < res)
-              break;
-
-          occupied ^= lsb(bb);
-          attackers |= attacks_bb<ROOK>(to, occupied) & pieces(ROOK, QUEEN);
-      }
+      if (lvaIsKing)
+          // If we "capture" with the king but opponent still has attackers,
+          // reverse the result.
+          return (attackers & ~pieces(stm)) ? res ^ 1 : res;
 
-      else if ((bb = stmAttackers & pieces(QUEEN)))
-      {
-          if ((swap = QueenValueMg - swap) < res)
-              break;
+      if ((swap = lvaValue - swap) < res)
+          break;
 
-          occupied ^= lsb(bb);
-          attackers |=  (attacks_bb<BISHOP>(to, occupied) & pieces(BISHOP, QUEEN))
-                      | (attacks_bb<ROOK  >(to, occupied) & pieces(ROOK  , QUEEN));
-      }
+      acquired |= abilities_on(lva);
+      occupied ^= lva;
 
-      else // KING
-           // If we "capture" with the king but opponent still has attackers,
-           // reverse the result.
-          return (attackers & ~pieces(stm)) ? res ^ 1 : res;
+      // Recompute the attackers instead of patching in X-rays: any piece may
+      // slide through the vacated square on any line it has an ability for,
+      // so the classical "add the slider behind" bookkeeping does not cover
+      // all cases anymore.
+      attackers = attackers_to(to, occupied) & occupied;
   }
 
   return bool(res);
@@ -1338,21 +1608,15 @@ bool Position::pos_is_ok() const {
 
 // ========== ABSORB CHESS: ABILITY MANAGEMENT ==========
 
-Abilities Position::abilities_on(Square s) const {
-  Abilities result = NO_ABILITY;
-  for (PieceType pt = PAWN; pt <= KING; ++pt) {
-    for (Color c : {WHITE, BLACK}) {
-      if (abilityBB[c][pt] & s) {
-        result |= (1 << (pt - 1)); // Convert PieceType to ability flag
-      }
-    }
-  }
-  return result;
-}
-
-bool Position::has_ability(Square s, PieceType pt) const {
-  Color pieceColor = (pieces(WHITE) & s) ? WHITE : BLACK;
-  return abilityBB[pieceColor][pt] & s;
+// Every toggle of an abilityBB bit goes through here so that the packed
+// per-square mirror abilityOf[] and st->abilityKey (and with it st->key)
+// always match the ability occupancy. Inside do_move() st->key is overwritten
+// at the end anyway; for direct calls from the outside (e.g. the WASM wrapper
+// seeding a position) the update keeps st->key valid.
+void Position::xor_ability_key(Color c, PieceType pt, Square s) {
+  abilityOf[s] ^= (1 << (pt - 1));
+  st->abilityKey ^= Zobrist::ability[c][pt][s];
+  st->key ^= Zobrist::ability[c][pt][s];
 }
 
 Bitboard Position::pieces_with_ability(Color c, PieceType ability) const {
@@ -1360,57 +1624,73 @@ Bitboard Position::pieces_with_ability(Color c, PieceType ability) const {
 }
 
 void Position::set_abilities(Square s, Abilities abilities) {
+  Abilities oldAbilities = abilities_on(s);
+
   // First clear all abilities for this square
   remove_abilities(s);
-  
+
   // Get the color of the piece on this square
   Color pieceColor = (pieces(WHITE) & s) ? WHITE : BLACK;
-  
+
   // Set the new abilities
   for (PieceType pt = PAWN; pt <= KING; ++pt) {
     if (abilities & (1 << (pt - 1))) {
       abilityBB[pieceColor][pt] |= s;
+      xor_ability_key(pieceColor, pt, s);
     }
   }
-  
+
   // Update psq evaluation based on new effective piece type
-  update_psq_for_abilities(s);
+  update_psq_for_abilities(s, oldAbilities);
 }
 
 void Position::add_ability(Square s, PieceType ability) {
+  Abilities oldAbilities = abilities_on(s);
+
   // Get the color of the piece on this square
   Color pieceColor = (pieces(WHITE) & s) ? WHITE : BLACK;
-  abilityBB[pieceColor][ability] |= s;
-  
+  if (!(abilityBB[pieceColor][ability] & s)) {
+    abilityBB[pieceColor][ability] |= s;
+    xor_ability_key(pieceColor, ability, s);
+  }
+
   // Update psq evaluation based on new effective piece type
-  update_psq_for_abilities(s);
+  update_psq_for_abilities(s, oldAbilities);
 }
 
 void Position::remove_abilities(Square s) {
   for (Color c : {WHITE, BLACK}) {
     for (PieceType pt = PAWN; pt <= KING; ++pt) {
-      abilityBB[c][pt] &= ~s;
+      if (abilityBB[c][pt] & s) {
+        abilityBB[c][pt] ^= s;
+        xor_ability_key(c, pt, s);
+      }
     }
   }
 }
 
 void Position::remove_ability_from_square(Square s, PieceType ability) {
   for (Color c : {WHITE, BLACK}) {
-    abilityBB[c][ability] &= ~s;
+    if (abilityBB[c][ability] & s) {
+      abilityBB[c][ability] ^= s;
+      xor_ability_key(c, ability, s);
+    }
   }
 }
 
-void Position::update_psq_for_abilities(Square s) {
+void Position::update_psq_for_abilities(Square s, Abilities oldAbilities) {
+
+  ABSORB_PROF_SCOPE(PSQ_UPDATE);
+
   if (board[s] == NO_PIECE) return;
-  
+
   Piece pc = board[s];
-  Abilities abilities = abilities_on(s);
-  
-  // Remove old psq value based on base piece type
-  psq -= PSQT::psq[pc][s];
-  
-  // Add new psq value based on effective piece type using lookup table
-  PieceType effectivePt = get_effective_psqt_type(type_of(pc), abilities);
-  Piece effectivePiece = make_piece(color_of(pc), effectivePt);
-  psq += PSQT::psq[effectivePiece][s];
+
+  // psq credits occupied squares with their effective piece type (see
+  // put_piece), so account only for the old -> new effective type delta.
+  PieceType oldEffectivePt = get_effective_psqt_type(type_of(pc), oldAbilities);
+  psq -= PSQT::psq[make_piece(color_of(pc), oldEffectivePt)][s];
+
+  PieceType effectivePt = get_effective_psqt_type(type_of(pc), abilities_on(s));
+  psq += PSQT::psq[make_piece(color_of(pc), effectivePt)][s];
 }
@@ -59,6 +59,11 @@ struct StateInfo {
   Key    pawnKey;
   Key    materialKey;
   Value  nonPawnMaterial[COLOR_NB];
+
+  // Absorb Chess: Piece counts by effective material type, kept in sync with
+  // absorption and promotion by do_move() so Material::probe() needs no board
+  // scan. Kings always count as KING.
+  uint8_t effectiveCount[COLOR_NB][PIECE_TYPE_NB];
   int    castlingRights;
   int    rule50;
   int    pliesFromNull;
@@ -67,6 +72,15 @@ struct StateInfo {
   // Absorb Chess: Abilities for captured piece (to restore on undo)
   Abilities capturedAbilities;
 
+  // Absorb Chess: Abilities of the moving piece before the move, so that undo
+  // restores them exactly (a same-type capture absorbs nothing, and promotion
+  // discards the pawn's absorbed abilities)
+  Abilities moverAbilities;
+
+  // Absorb Chess: XOR of Zobrist::ability[][][] over all set abilityBB bits.
+  // Copied on do_move and then updated incrementally together with st->key.
+  Key abilityKey;
+
   // Not copied when making a move (will be recomputed anyhow)
   Key        key;
   Bitboard   checkersBB;
@@ -75,6 +89,13 @@ struct StateInfo {
   Bitboard   blockersForKing[COLOR_NB];
   Bitboard   pinners[COLOR_NB];
   Bitboard   checkSquares[PIECE_TYPE_NB];
+
+  // Absorb Chess: squares of the side to move's pieces with absorbed
+  // abilities, and per such square the union of checkSquares[] over the full
+  // ability mask, so gives_check() and quiet-check generation remain single
+  // AND operations even for multi-ability pieces
+  Bitboard   absorbCheckCandidates;
+  Bitboard   absorbCheckSquares[SQUARE_NB];
   int        repetition;
 };
 
@@ -104,16 +125,19 @@ public:
   Position& set(const std::string& fenStr, bool isChess960, StateInfo* si, Thread* th);
   Position& set(const std::string& code, Color c, StateInfo* si);
   const std::string fen() const;
+  void refresh();
 
   // Absorb Chess: Add ability queries and manipulation
   Abilities abilities_on(Square s) const;
+  Abilities absorbed_abilities(Square s) const;
   bool has_ability(Square s, PieceType pt) const;
   Bitboard pieces_with_ability(Color c, PieceType ability) const;
+  int effective_count(Color c, PieceType pt) const;
   void set_abilities(Square s, Abilities abilities);
   void add_ability(Square s, PieceType ability);
   void remove_abilities(Square s);
   void remove_ability_from_square(Square s, PieceType ability);
-  void update_psq_for_abilities(Square s); // Update psq when abilities change
+  void update_psq_for_abilities(Square s, Abilities oldAbilities); // Update psq when abilities change
 
   // Position representation
   Bitboard pieces(PieceType pt) const;
@@ -140,6 +164,7 @@ public:
   Bitboard checkers() const;
   Bitboard blockers_for_king(Color c) const;
   Bitboard check_squares(PieceType pt) const;
+  Bitboard check_squares_multi(Square s) const;
   bool is_discovery_check_on_king(Color c, Move m) const;
 
   // Attacks to/from a given square
@@ -155,6 +180,8 @@ public:
   bool gives_check(Move m) const;
   bool advanced_pawn_push(Move m) const;
   Piece moved_piece(Move m) const;
+  Piece effective_piece_on(Square s) const;
+  Piece effective_moved_piece(Move m) const;
   Piece captured_piece() const;
 
   // Piece specific
@@ -177,6 +204,7 @@ public:
   Key key_after(Move m) const;
   Key material_key() const;
   Key pawn_key() const;
+  void set_tt_tag(Key tag);
 
   // Other properties of the position
   Color side_to_move() const;
@@ -202,6 +230,7 @@ private:
   void set_check_info(StateInfo* si) const;
 
   // Other helpers
+  void xor_ability_key(Color c, PieceType pt, Square s);
   void put_piece(Piece pc, Square s);
   void remove_piece(Square s);
   void move_piece(Square from, Square to);
@@ -221,17 +250,25 @@ private:
   int gamePly;
   Color sideToMove;
   Score psq;
+  // Absorb Chess: per-game salt mixed into key() so that the contexts of the
+  // multi-game server mode can share one transposition table without ever
+  // hitting each other's entries. Zero (no tagging) outside of server mode.
+  Key ttTag;
   Thread* thisThread;
   StateInfo* st;
   bool chess960;
 
   // Absorb Chess: Ability tracking
-  // abilityBB[color][ability_type] tracks which squares have that ability
+  // abilityBB[color][ability_type] tracks which squares have that ability.
+  // abilityOf[] mirrors it as packed per-square flags so that abilities_on()
+  // is a single byte load instead of a 12-bitboard scan; both are kept in
+  // sync by xor_ability_key().
   Bitboard abilityBB[COLOR_NB][PIECE_TYPE_NB];
+  Abilities abilityOf[SQUARE_NB];
 };
 
 namespace PSQT {
-  extern Score psq[PIECE_NB][SQUARE_NB];
+  extern const Score (&psq)[PIECE_NB][SQUARE_NB]; // Compile-time data, see psqt.cpp
 }
 
 extern std::ostream& operator<<(std::ostream& os, const Position& pos);
@@ -249,10 +286,45 @@ inline bool Position::empty(Square s) const {
   return piece_on(s) == NO_PIECE;
 }
 
+inline Abilities Position::abilities_on(Square s) const {
+  assert(is_ok(s));
+  return abilityOf[s];
+}
+
+// Like abilities_on() but without the piece's own base type, so it is
+// non-zero exactly for pieces that absorbed something.
+inline Abilities Position::absorbed_abilities(Square s) const {
+  assert(is_ok(s));
+  return empty(s) ? Abilities(0)
+                  : Abilities(abilityOf[s] & ~(1 << (type_of(piece_on(s)) - 1)));
+}
+
+inline bool Position::has_ability(Square s, PieceType pt) const {
+  return abilityOf[s] & (1 << (pt - 1));
+}
+
+inline int Position::effective_count(Color c, PieceType pt) const {
+  return st->effectiveCount[c][pt];
+}
+
 inline Piece Position::moved_piece(Move m) const {
   return piece_on(from_sq(m));
 }
 
+// Absorb Chess: the piece with its absorbed abilities folded into the
+// effective PSQT type. The piece-indexed history tables use this so that
+// e.g. a pawn-with-queen-ability learns its own move ordering statistics
+// instead of sharing them with ordinary pawns.
+inline Piece Position::effective_piece_on(Square s) const {
+  Piece pc = piece_on(s);
+  return pc == NO_PIECE ? NO_PIECE
+       : make_piece(color_of(pc), get_effective_psqt_type(type_of(pc), abilities_on(s)));
+}
+
+inline Piece Position::effective_moved_piece(Move m) const {
+  return effective_piece_on(from_sq(m));
+}
+
 inline Bitboard Position::pieces(PieceType pt = ALL_PIECES) const {
   return byTypeBB[pt];
 }
@@ -334,6 +406,15 @@ inline Bitboard Position::check_squares(PieceType pt) const {
   return st->checkSquares[pt];
 }
 
+// Absorb Chess: fused check squares of the piece on s, covering its base
+// type and all absorbed abilities. Precomputed by set_check_info() for the
+// pieces that actually absorbed something; everything else falls back to
+// the plain base-type mask.
+inline Bitboard Position::check_squares_multi(Square s) const {
+  return st->absorbCheckCandidates & s ? st->absorbCheckSquares[s]
+                                       : st->checkSquares[type_of(piece_on(s))];
+}
+
 inline bool Position::is_discovery_check_on_king(Color c, Move m) const {
   return st->blockersForKing[c] & from_sq(m);
 }
@@ -352,7 +433,11 @@ inline int Position::pawns_on_same_color_squares(Color c, Square s) const {
 }
 
 inline Key Position::key() const {
-  return st->key;
+  return st->key ^ ttTag;
+}
+
+inline void Position::set_tt_tag(Key tag) {
+  ttTag = tag;
 }
 
 inline Key Position::pawn_key() const {
@@ -423,7 +508,8 @@ inline void Position::put_piece(Piece pc, Square s) {
   
   // Absorb Chess: Give piece its base ability first, then update psq
   abilityBB[color_of(pc)][type_of(pc)] |= s;
-  
+  xor_ability_key(color_of(pc), type_of(pc), s);
+
   // Calculate psq based on effective piece type (initially just base type)
   Abilities abilities = abilities_on(s);
   PieceType effectivePt = get_effective_psqt_type(type_of(pc), abilities);
@@ -472,12 +558,13 @@ inline void Position::move_piece(Square from, Square to) {
   index[to] = index[from];
   pieceList[pc][index[to]] = to;
   
-  // Absorb Chess: Calculate psq difference based on effective piece type using lookup
+  // Absorb Chess: remove the effective value at from and credit the plain
+  // base value at to; set_abilities() below lifts it back to the effective
+  // piece type once the abilities have arrived on the destination square.
   Abilities oldAbilities = abilities_on(from);
   PieceType effectivePt = get_effective_psqt_type(type_of(pc), oldAbilities);
-  Piece effectivePiece = make_piece(color_of(pc), effectivePt);
-  psq += PSQT::psq[effectivePiece][to] - PSQT::psq[effectivePiece][from];
-  
+  psq += PSQT::psq[pc][to] - PSQT::psq[make_piece(color_of(pc), effectivePt)][from];
+
   // Move abilities from source to destination
   remove_abilities(from);
   set_abilities(to, oldAbilities);
@@ -99,13 +99,18 @@ constexpr Score PBonus[RANK_NB][FILE_NB] =
 
 #undef S
 
-Score psq[PIECE_NB][SQUARE_NB];
+namespace {
 
+// compute_psq() fills the piece-square tables: the white halves of the tables
+// are copied from Bonus[] and PBonus[], adding the piece value, then the black
+// halves of the tables are initialized by flipping and changing the sign of
+// the white scores. Evaluated at compile time, so the tables are constant data
+// in the binary and module startup does no work for them.
+struct Table { Score psq[PIECE_NB][SQUARE_NB]; };
 
-// PSQT::init() initializes piece-square tables: the white halves of the tables are
-// copied from Bonus[] and PBonus[], adding the piece value, then the black halves of
-// the tables are initialized by flipping and changing the sign of the white scores.
-void init() {
+constexpr Table compute_psq() {
+
+  Table t = Table();
 
   for (Piece pc : {W_PAWN, W_KNIGHT, W_BISHOP, W_ROOK, W_QUEEN, W_KING})
   {
@@ -114,11 +119,24 @@ void init() {
       for (Square s = SQ_A1; s <= SQ_H8; ++s)
       {
           File f = File(edge_distance(file_of(s)));
-          psq[ pc][s] = score + (type_of(pc) == PAWN ? PBonus[rank_of(s)][file_of(s)]
-                                                     : Bonus[pc][rank_of(s)][f]);
-          psq[~pc][flip_rank(s)] = -psq[pc][s];
+          t.psq[ pc][s] = score + (type_of(pc) == PAWN ? PBonus[rank_of(s)][file_of(s)]
+                                                       : Bonus[pc][rank_of(s)][f]);
+          t.psq[~pc][flip_rank(s)] = -t.psq[pc][s];
       }
   }
+
+  return t;
 }
 
+constexpr Table T = compute_psq();
+
+} // namespace
+
+const Score (&psq)[PIECE_NB][SQUARE_NB] = T.psq;
+
+// A no-op now that the tables are compile-time data. This also closes a long
+// standing hole: the WASM wrapper never called init(), so the WASM engine was
+// evaluating with all-zero piece-square tables.
+void init() {}
+
 } // namespace PSQT
@@ -199,6 +199,102 @@ void Search::clear() {
 }
 
 
+namespace {
+
+  // History tables travel as length-prefixed raw dumps; the length guards
+  // against restoring a snapshot from a build with different table shapes.
+  template<typename T>
+  void write_table(std::ostream& os, const T& t) {
+    uint32_t bytes = uint32_t(sizeof(T));
+    os.write(reinterpret_cast<const char*>(&bytes), sizeof(bytes));
+    os.write(reinterpret_cast<const char*>(&t), sizeof(T));
+  }
+
+  template<typename T>
+  bool read_table(std::istream& is, T& t) {
+    uint32_t bytes;
+    is.read(reinterpret_cast<char*>(&bytes), sizeof(bytes));
+    if (!is || bytes != sizeof(T))
+        return false;
+    is.read(reinterpret_cast<char*>(&t), sizeof(T));
+    return bool(is);
+  }
+}
+
+
+/// Search::save_state() serializes a warm-start snapshot: the compacted
+/// transposition table (entries of at least minDepth, see
+/// TranspositionTable::save_compact()) plus the main thread's butterfly,
+/// countermove, capture and continuation history tables. Every engine start
+/// otherwise begins stone cold and the early searches of a session redo work
+/// done thousands of times before; the always-on bot workers restart on each
+/// deploy and recover their accumulated search effort by restoring one of
+/// these at startup. lowPlyHistory is left out deliberately: it is reseeded
+/// from the previous search of the same game and is stale across sessions.
+
+bool Search::save_state(std::ostream& os, Depth minDepth) {
+
+  Threads.main()->wait_for_search_finished();
+
+  os.write("ABSS", 4);
+  uint8_t version = 1, reserved[3] = {};
+  os.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  os.write(reinterpret_cast<const char*>(reserved), sizeof(reserved));
+
+  TT.save_compact(os, minDepth);
+
+  Thread* th = Threads.main();
+  write_table(os, th->mainHistory);
+  write_table(os, th->counterMoves);
+  write_table(os, th->captureHistory);
+  write_table(os, th->continuationHistory);
+
+  return bool(os);
+}
+
+
+/// Search::load_state() restores a save_state() snapshot: the TT entries are
+/// merged into the current table and the history tables are copied into every
+/// thread of the pool. Returns false on a truncated or incompatible blob, in
+/// which case the state may be partially restored; follow with 'ucinewgame'
+/// if that matters.
+
+bool Search::load_state(std::istream& is) {
+
+  Threads.main()->wait_for_search_finished();
+
+  char magic[4];
+  uint8_t version, reserved[3];
+  is.read(magic, 4);
+  is.read(reinterpret_cast<char*>(&version), sizeof(version));
+  is.read(reinterpret_cast<char*>(reserved), sizeof(reserved));
+  if (!is || memcmp(magic, "ABSS", 4) || version != 1)
+      return false;
+
+  TT.load_compact(is);
+
+  Thread* main = Threads.main();
+  if (   !read_table(is, main->mainHistory)
+      || !read_table(is, main->counterMoves)
+      || !read_table(is, main->captureHistory)
+      || !read_table(is, main->continuationHistory))
+      return false;
+
+  for (Thread* th : Threads)
+      if (th != main)
+      {
+          th->mainHistory    = main->mainHistory;
+          th->counterMoves   = main->counterMoves;
+          th->captureHistory = main->captureHistory;
+          for (bool inCheck : { false, true })
+              for (StatsType c : { NoCaptures, Captures })
+                  th->continuationHistory[inCheck][c] = main->continuationHistory[inCheck][c];
+      }
+
+  return true;
+}
+
+
 /// MainThread::search() is started when the program receives the UCI 'go'
 /// command. It searches from the root position and outputs the "bestmove".
 
@@ -306,6 +402,13 @@ void Thread::search() {
   bestValue = delta = alpha = -VALUE_INFINITE;
   beta = VALUE_INFINITE;
 
+  // Cluster-shared lower bound on the root score (see cluster.cpp). The
+  // aspiration window never opens below it, so a root-move subset that is
+  // dominated by a move held on another node fails low once and cheaply
+  // instead of widening all the way down to an exact score.
+  Value rootBound = Limits.rootBound != VALUE_NONE ? Value(Limits.rootBound)
+                                                   : -VALUE_INFINITE;
+
   if (mainThread)
   {
       if (mainThread->bestPreviousScore == VALUE_INFINITE)
@@ -361,7 +464,8 @@ void Thread::search() {
   // Iterative deepening loop until requested to stop or the target depth is reached
   while (   ++rootDepth < MAX_PLY
          && !Threads.stop
-         && !(Limits.depth && mainThread && rootDepth > Limits.depth))
+         && !(Limits.depth && mainThread && rootDepth > Limits.depth)
+         && !(depthLimit && rootDepth > depthLimit))
   {
       // Age out PV variability metric
       if (mainThread)
@@ -395,8 +499,8 @@ void Thread::search() {
           {
               Value prev = rootMoves[pvIdx].previousScore;
               delta = Value(19);
-              alpha = std::max(prev - delta,-VALUE_INFINITE);
-              beta  = std::min(prev + delta, VALUE_INFINITE);
+              alpha = std::max(prev - delta, rootBound);
+              beta  = std::min(std::max(prev, rootBound) + delta, VALUE_INFINITE);
 
               // Adjust contempt based on root move's previousScore (dynamic contempt)
               int dct = ct + (110 - ct / 2) * prev / (abs(prev) + 140);
@@ -440,8 +544,14 @@ void Thread::search() {
               // re-search, otherwise exit the loop.
               if (bestValue <= alpha)
               {
+                  // A fail low against the shared cluster bound is final:
+                  // this subset cannot beat the best move elsewhere, and the
+                  // floored window could never resolve an exact score anyway.
+                  if (rootBound > -VALUE_INFINITE && alpha <= rootBound)
+                      break;
+
                   beta = (alpha + beta) / 2;
-                  alpha = std::max(bestValue - delta, -VALUE_INFINITE);
+                  alpha = std::max(bestValue - delta, rootBound);
 
                   failedHighCnt = 0;
                   if (mainThread)
@@ -574,7 +684,10 @@ namespace {
 
     // Dive into quiescence search when the depth reaches zero
     if (depth <= 0)
+    {
+        ABSORB_PROF_SCOPE(QSEARCH);
         return qsearch<NT>(pos, ss, alpha, beta);
+    }
 
     assert(-VALUE_INFINITE <= alpha && alpha < beta && beta <= VALUE_INFINITE);
     assert(PvNode || (alpha == beta - 1));
@@ -697,7 +810,7 @@ namespace {
             {
                 int penalty = -stat_bonus(depth);
                 thisThread->mainHistory[us][from_to(ttMove)] << penalty;
-                update_continuation_histories(ss, pos.moved_piece(ttMove), to_sq(ttMove), penalty);
+                update_continuation_histories(ss, pos.effective_moved_piece(ttMove), to_sq(ttMove), penalty);
             }
         }
 
@@ -750,7 +863,10 @@ namespace {
     if (   !rootNode // The required rootNode PV handling is not available in qsearch
         &&  depth == 1
         &&  eval <= alpha - RazorMargin)
+    {
+        ABSORB_PROF_SCOPE(QSEARCH);
         return qsearch<NT>(pos, ss, alpha, beta);
+    }
 
     improving =  (ss-2)->staticEval == VALUE_NONE ? (ss->staticEval > (ss-4)->staticEval
               || (ss-4)->staticEval == VALUE_NONE) : ss->staticEval > (ss-2)->staticEval;
@@ -850,7 +966,7 @@ namespace {
                 ss->currentMove = move;
                 ss->continuationHistory = &thisThread->continuationHistory[ss->inCheck]
                                                                           [captureOrPromotion]
-                                                                          [pos.moved_piece(move)]
+                                                                          [pos.effective_moved_piece(move)]
                                                                           [to_sq(move)];
 
                 pos.do_move(move, st);
@@ -893,7 +1009,7 @@ moves_loop: // When in check, search starts from here
                                           nullptr                   , (ss-4)->continuationHistory,
                                           nullptr                   , (ss-6)->continuationHistory };
 
-    Move countermove = thisThread->counterMoves[pos.piece_on(prevSq)][prevSq];
+    Move countermove = thisThread->counterMoves[pos.effective_piece_on(prevSq)][prevSq];
 
     MovePicker mp(pos, ttMove, depth, &thisThread->mainHistory,
                                       &thisThread->lowPlyHistory,
@@ -938,7 +1054,9 @@ moves_loop: // When in check, search starts from here
 
       extension = 0;
       captureOrPromotion = pos.capture_or_promotion(move);
-      movedPiece = pos.moved_piece(move);
+      // Absorb Chess: history tables and value heuristics below are keyed
+      // by the effective piece so absorb pieces learn their own statistics
+      movedPiece = pos.effective_moved_piece(move);
       givesCheck = pos.gives_check(move);
 
       // Calculate new depth for this move
@@ -983,17 +1101,17 @@ moves_loop: // When in check, search starts from here
               // Capture history based pruning when the move doesn't give check
               if (   !givesCheck
                   && lmrDepth < 1
-                  && captureHistory[movedPiece][to_sq(move)][type_of(pos.piece_on(to_sq(move)))] < 0)
+                  && captureHistory[movedPiece][to_sq(move)][type_of(pos.effective_piece_on(to_sq(move)))] < 0)
                   continue;
 
               // Futility pruning for captures
               if (   !givesCheck
                   && lmrDepth < 6
                   && !(PvNode && abs(bestValue) < 2)
-                  && PieceValue[MG][type_of(movedPiece)] >= PieceValue[MG][type_of(pos.piece_on(to_sq(move)))]
+                  && PieceValue[MG][type_of(movedPiece)] >= PieceValue[MG][type_of(pos.effective_piece_on(to_sq(move)))]
                   && !ss->inCheck
                   && ss->staticEval + 267 + 391 * lmrDepth
-                     + PieceValue[MG][type_of(pos.piece_on(to_sq(move)))] <= alpha)
+                     + PieceValue[MG][type_of(pos.effective_piece_on(to_sq(move)))] <= alpha)
                   continue;
 
               // See based pruning
@@ -1507,7 +1625,7 @@ moves_loop: // When in check, search starts from here
       ss->currentMove = move;
       ss->continuationHistory = &thisThread->continuationHistory[ss->inCheck]
                                                                 [captureOrPromotion]
-                                                                [pos.moved_piece(move)]
+                                                                [pos.effective_moved_piece(move)]
                                                                 [to_sq(move)];
 
       // Make and search the move
@@ -1616,8 +1734,8 @@ moves_loop: // When in check, search starts from here
     Color us = pos.side_to_move();
     Thread* thisThread = pos.this_thread();
     CapturePieceToHistory& captureHistory = thisThread->captureHistory;
-    Piece moved_piece = pos.moved_piece(bestMove);
-    PieceType captured = type_of(pos.piece_on(to_sq(bestMove)));
+    Piece moved_piece = pos.effective_moved_piece(bestMove);
+    PieceType captured = type_of(pos.effective_piece_on(to_sq(bestMove)));
 
     bonus1 = stat_bonus(depth + 1);
     bonus2 = bestValue > beta + PawnValueMg ? bonus1               // larger bonus
@@ -1631,7 +1749,7 @@ moves_loop: // When in check, search starts from here
         for (int i = 0; i < quietCount; ++i)
         {
             thisThread->mainHistory[us][from_to(quietsSearched[i])] << -bonus2;
-            update_continuation_histories(ss, pos.moved_piece(quietsSearched[i]), to_sq(quietsSearched[i]), -bonus2);
+            update_continuation_histories(ss, pos.effective_moved_piece(quietsSearched[i]), to_sq(quietsSearched[i]), -bonus2);
         }
     }
     else
@@ -1640,13 +1758,13 @@ moves_loop: // When in check, search starts from here
     // Extra penalty for a quiet TT or main killer move in previous ply when it gets refuted
     if (   ((ss-1)->moveCount == 1 || ((ss-1)->currentMove == (ss-1)->killers[0]))
         && !pos.captured_piece())
-            update_continuation_histories(ss-1, pos.piece_on(prevSq), prevSq, -bonus1);
+            update_continuation_histories(ss-1, pos.effective_piece_on(prevSq), prevSq, -bonus1);
 
     // Decrease all the non-best capture moves
     for (int i = 0; i < captureCount; ++i)
     {
-        moved_piece = pos.moved_piece(capturesSearched[i]);
-        captured = type_of(pos.piece_on(to_sq(capturesSearched[i])));
+        moved_piece = pos.effective_moved_piece(capturesSearched[i]);
+        captured = type_of(pos.effective_piece_on(to_sq(capturesSearched[i])));
         captureHistory[moved_piece][to_sq(capturesSearched[i])][captured] << -bonus1;
     }
   }
@@ -1680,15 +1798,15 @@ moves_loop: // When in check, search starts from here
     Color us = pos.side_to_move();
     Thread* thisThread = pos.this_thread();
     thisThread->mainHistory[us][from_to(move)] << bonus;
-    update_continuation_histories(ss, pos.moved_piece(move), to_sq(move), bonus);
+    update_continuation_histories(ss, pos.effective_moved_piece(move), to_sq(move), bonus);
 
-    if (type_of(pos.moved_piece(move)) != PAWN)
+    if (type_of(pos.effective_moved_piece(move)) != PAWN)
         thisThread->mainHistory[us][from_to(reverse_move(move))] << -bonus;
 
     if (is_ok((ss-1)->currentMove))
     {
         Square prevSq = to_sq((ss-1)->currentMove);
-        thisThread->counterMoves[pos.piece_on(prevSq)][prevSq] = move;
+        thisThread->counterMoves[pos.effective_piece_on(prevSq)][prevSq] = move;
     }
 
     if (depth > 11 && ss->ply < MAX_LPH)
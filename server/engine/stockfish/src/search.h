@@ -21,6 +21,7 @@
 #ifndef SEARCH_H_INCLUDED
 #define SEARCH_H_INCLUDED
 
+#include <iosfwd>
 #include <vector>
 
 #include "misc.h"
@@ -71,10 +72,14 @@ struct RootMove {
   Value previousScore = -VALUE_INFINITE;
   int selDepth = 0;
   int bestMoveCount = 0;
-  std::vector<Move> pv;
+  std::vector<Move, Arena::Allocator<Move>> pv;
 };
 
-typedef std::vector<RootMove> RootMoves;
+// Root moves and their PVs are the structures a running search grows, so
+// they draw from the per-search arena (a plain heap vector until
+// Arena::init() runs, see misc.h). The arena is recycled at the top of
+// ThreadPool::start_thinking().
+typedef std::vector<RootMove, Arena::Allocator<RootMove>> RootMoves;
 
 
 /// LimitsType struct stores information sent by GUI about available time to
@@ -86,6 +91,7 @@ struct LimitsType {
     time[WHITE] = time[BLACK] = inc[WHITE] = inc[BLACK] = npmsec = movetime = TimePoint(0);
     movestogo = depth = mate = perft = infinite = 0;
     nodes = 0;
+    rootBound = VALUE_NONE;
   }
 
   bool use_time_management() const {
@@ -96,6 +102,13 @@ struct LimitsType {
   TimePoint time[COLOR_NB], inc[COLOR_NB], npmsec, movetime, startTime;
   int movestogo, depth, mate, perft, infinite;
   int64_t nodes;
+
+  // External lower bound on the root score, in internal Value units, set by
+  // "go rootbound <v>". The cluster coordinator (cluster.cpp) shares the best
+  // score found so far across nodes this way: a root-move subset whose best
+  // move cannot beat it fails low once instead of resolving an exact score.
+  // VALUE_NONE (the default) disables it.
+  int rootBound;
 };
 
 extern LimitsType Limits;
@@ -103,6 +116,12 @@ extern LimitsType Limits;
 void init();
 void clear();
 
+// Warm-start snapshot: the compacted transposition table plus the history
+// tables, as one binary blob. Natively moved through files by the 'snapshot'
+// UCI command, through IndexedDB by the WASM wrapper.
+bool save_state(std::ostream& os, Depth minDepth);
+bool load_state(std::istream& is);
+
 } // namespace Search
 
 #endif // #ifndef SEARCH_H_INCLUDED
@@ -33,7 +33,9 @@ ThreadPool Threads; // Global object
 /// Thread constructor launches the thread and waits until it goes to sleep
 /// in idle_loop(). Note that 'searching' and 'exit' should be already set.
 
-Thread::Thread(size_t n) : idx(n), stdThread(&Thread::idle_loop, this) {
+Thread::Thread(size_t n) : Thread(n, true) {}
+
+Thread::Thread(size_t n, bool spawnWorker) : idx(n), stdThread(nullptr) {
 
   // (A) Upstream does wait_for_search_finished() directly here.
   //
@@ -46,6 +48,17 @@ Thread::Thread(size_t n) : idx(n), stdThread(&Thread::idle_loop, this) {
   //
   // Instead we introduced threadStarted (B) and retry uci_command with
   // exponential backoff until all threads have started.
+  //
+  // (C) In the single-threaded WASM build no worker can be created at all,
+  // so with spawnWorker == false we skip idle_loop() entirely and searches
+  // run on the caller's stack via ThreadPool::start_thinking_sync().
+  if (spawnWorker)
+      stdThread = new NativeThread(&Thread::idle_loop, this);
+  else
+  {
+      searching = false;
+      threadStarted = true;
+  }
 }
 
 
@@ -56,9 +69,13 @@ Thread::~Thread() {
 
   assert(!searching);
 
-  exit = true;
-  start_searching();
-  stdThread.join();
+  if (stdThread)
+  {
+      exit = true;
+      start_searching();
+      stdThread->join();
+      delete stdThread;
+  }
 }
 
 
@@ -118,6 +135,15 @@ void Thread::wait_for_search_finished() {
 
 void Thread::idle_loop() {
 
+  // If OS already scheduled us on a different group than 0 then don't overwrite
+  // the choice, eventually we are one of many one-threaded processes running on
+  // some Windows NUMA hardware, for instance in fishtest. To make it simple,
+  // just check if running threads are below a threshold, in this case all this
+  // NUMA machinery is not needed. A no-op in the WASM build, where the browser
+  // owns worker scheduling.
+  if (Options["Threads"] > 8)
+      WinProcGroup::bindThisThread(idx);
+
   while (true)
   {
       std::unique_lock<std::mutex> lk(mutex);
@@ -140,9 +166,10 @@ void Thread::idle_loop() {
 /// Created and launched threads will immediately go to sleep in idle_loop.
 /// Upon resizing, threads are recreated to allow for binding if necessary.
 ///
-/// stockfish.wasm: Unlike upstream, we reuse existing threads, because
-/// we do not care about thread binding. For the same reason, we also do not
-/// reallocate the transposition table.
+/// stockfish.wasm: Unlike upstream, we reuse existing threads instead of
+/// recreating the pool, and we do not reallocate the transposition table.
+/// Binding still works for the native build because a thread's index never
+/// changes once created, so the pin applied in idle_loop() stays valid.
 
 void ThreadPool::set(size_t requested) {
 
@@ -167,6 +194,24 @@ void ThreadPool::set(size_t requested) {
 }
 
 
+/// ThreadPool::set_synchronous() sets up a pool with a single main thread that
+/// has no worker behind it (see note (C) in the Thread constructor). Searches
+/// must then be started with start_thinking_sync(), which runs them on the
+/// caller's stack. This is the only mode available to the single-threaded
+/// WASM build.
+
+void ThreadPool::set_synchronous() {
+
+  assert(empty());
+
+  push_back(new MainThread(0, false));
+  clear();
+
+  // Init thread number dependent search params.
+  Search::init();
+}
+
+
 /// ThreadPool::clear() sets threadPool data to initial values
 
 void ThreadPool::clear() {
@@ -192,6 +237,14 @@ void ThreadPool::start_thinking(Position& pos, StateListPtr& states,
   increaseDepth = true;
   main()->ponder = ponderMode;
   Search::Limits = limits;
+
+  // Recycle the per-search arena (a no-op until Arena::init() ran). Every
+  // arena-backed structure of the previous search must be dropped first or
+  // its memory would be handed out a second time.
+  for (Thread* th : *this)
+      Search::RootMoves().swap(th->rootMoves);
+  Arena::reset();
+
   Search::RootMoves rootMoves;
 
   for (const auto& m : MoveList<LEGAL>(pos))
@@ -215,7 +268,7 @@ void ThreadPool::start_thinking(Position& pos, StateListPtr& states,
 
   for (Thread* th : *this)
   {
-      th->nodes = th->nmpMinPly = th->bestMoveChanges = 0;
+      th->nodes = th->evalCalls = th->evalCacheHits = th->nmpMinPly = th->bestMoveChanges = 0;
       th->rootDepth = th->completedDepth = 0;
       th->rootMoves = rootMoves;
       th->rootPos.set(pos.fen(), pos.is_chess960(), &setupStates->back(), th);
@@ -226,6 +279,52 @@ void ThreadPool::start_thinking(Position& pos, StateListPtr& states,
   main()->start_searching();
 }
 
+/// ThreadPool::start_thinking_sync() mirrors start_thinking() but runs the
+/// search on the caller's thread and only returns once it has completed. The
+/// result is left in main()->rootMoves as usual. Unlike start_thinking() we do
+/// not take ownership of 'states': the search is over before we return, so the
+/// caller's list outlives every rootPos that references it.
+
+void ThreadPool::start_thinking_sync(Position& pos, StateListPtr& states,
+                                     const Search::LimitsType& limits) {
+
+  main()->stopOnPonderhit = stop = false;
+  increaseDepth = true;
+  main()->ponder = false;
+  Search::Limits = limits;
+
+  // Recycle the per-search arena, as in start_thinking()
+  for (Thread* th : *this)
+      Search::RootMoves().swap(th->rootMoves);
+  Arena::reset();
+
+  Search::RootMoves rootMoves;
+
+  for (const auto& m : MoveList<LEGAL>(pos))
+      if (   limits.searchmoves.empty()
+          || std::count(limits.searchmoves.begin(), limits.searchmoves.end(), m))
+          rootMoves.emplace_back(m);
+
+  assert(states.get());
+
+  // Position::set() clears the StateInfo fields that cannot be deduced from
+  // a fen string (previous, pliesFromNull, capturedPiece), so as in
+  // start_thinking() we backup and restore states->back().
+  StateInfo tmp = states->back();
+
+  for (Thread* th : *this)
+  {
+      th->nodes = th->evalCalls = th->evalCacheHits = th->nmpMinPly = th->bestMoveChanges = 0;
+      th->rootDepth = th->completedDepth = 0;
+      th->rootMoves = rootMoves;
+      th->rootPos.set(pos.fen(), pos.is_chess960(), &states->back(), th);
+  }
+
+  states->back() = tmp;
+
+  main()->search();
+}
+
 Thread* ThreadPool::get_best_thread() const {
 
     Thread* bestThread = front();
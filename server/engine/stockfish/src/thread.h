@@ -27,6 +27,7 @@
 #include <thread>
 #include <vector>
 
+#include "evaluate.h"
 #include "material.h"
 #include "movepick.h"
 #include "pawns.h"
@@ -46,10 +47,11 @@ class Thread {
   std::condition_variable cv;
   size_t idx;
   bool exit = false, searching = true; // Set before starting std::thread
-  NativeThread stdThread;
+  NativeThread* stdThread;
 
 public:
   explicit Thread(size_t);
+  Thread(size_t, bool spawnWorker);
   virtual ~Thread();
   virtual void search();
   void clear();
@@ -60,16 +62,23 @@ public:
 
   Pawns::Table pawnsTable;
   Material::Table materialTable;
+  Eval::Cache evalCache;
   size_t pvIdx, pvLast;
   uint64_t ttHitAverage;
   int selDepth, nmpMinPly;
   Color nmpColor;
   std::atomic_bool threadStarted;
-  std::atomic<uint64_t> nodes, bestMoveChanges;
+  std::atomic<uint64_t> nodes, evalCalls, evalCacheHits, bestMoveChanges;
 
   Position rootPos;
   Search::RootMoves rootMoves;
   Depth rootDepth, completedDepth;
+
+  // Per-thread depth cap for tools that drive pool threads as independent
+  // workers on their own positions instead of Lazy SMP helpers (see
+  // analyze.cpp). 0 - always, during normal play - disables it: helpers then
+  // stop only on Threads.stop as before.
+  Depth depthLimit = 0;
   CounterMoveHistory counterMoves;
   ButterflyHistory mainHistory;
   LowPlyHistory lowPlyHistory;
@@ -104,11 +113,15 @@ struct MainThread : public Thread {
 struct ThreadPool : public std::vector<Thread*> {
 
   void start_thinking(Position&, StateListPtr&, const Search::LimitsType&, bool = false);
+  void start_thinking_sync(Position&, StateListPtr&, const Search::LimitsType&);
   void clear();
   void set(size_t);
+  void set_synchronous();
 
   MainThread* main()        const { return static_cast<MainThread*>(front()); }
   uint64_t nodes_searched() const { return accumulate(&Thread::nodes); }
+  uint64_t eval_calls()     const { return accumulate(&Thread::evalCalls); }
+  uint64_t eval_cache_hits() const { return accumulate(&Thread::evalCacheHits); }
   Thread* get_best_thread() const;
   void start_searching();
   void wait_for_search_finished() const;
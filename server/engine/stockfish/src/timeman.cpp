@@ -77,9 +77,22 @@ void TimeManagement::init(Search::LimitsType& limits, Color us, int ply) {
   // game time for the current move, so also cap to 20% of available game time.
   if (limits.movestogo == 0)
   {
-      opt_scale = std::min(0.008 + std::pow(ply + 3.0, 0.5) / 250.0,
-                           0.2 * limits.time[us] / double(timeLeft));
-      max_scale = std::min(7.0, 4.0 + ply / 12.0);
+      // Sudden-death blitz profile: on a short clock every move also pays
+      // the WebSocket round trip already reserved as Move Overhead, and a
+      // single overlong think is fatal. Spend flatter across the game and
+      // keep a harder per-move cap against flagging late.
+      if (limits.time[us] + 40 * limits.inc[us] < 180000)
+      {
+          opt_scale = std::min(0.010 + std::pow(ply + 3.0, 0.45) / 290.0,
+                               0.15 * limits.time[us] / double(timeLeft));
+          max_scale = std::min(4.0, 2.5 + ply / 20.0);
+      }
+      else
+      {
+          opt_scale = std::min(0.008 + std::pow(ply + 3.0, 0.5) / 250.0,
+                               0.2 * limits.time[us] / double(timeLeft));
+          max_scale = std::min(7.0, 4.0 + ply / 12.0);
+      }
   }
 
   // x moves in y seconds (+ z increment)
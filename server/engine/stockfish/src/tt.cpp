@@ -18,6 +18,7 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cstring>   // For std::memset
 #include <iostream>
 #include <thread>
@@ -84,7 +85,137 @@ void TranspositionTable::resize(size_t mbSize) {
 
 void TranspositionTable::clear() {
 
+  if (!mem)  // Search::clear() can run before the first resize()
+      return;
+
   std::memset(mem, 0, clusterCount * sizeof(Cluster) + CacheLineSize - 1);
+  clearCursor = 0;
+}
+
+
+/// TranspositionTable::clear_chunk() zeroes the next mbChunk megabytes of the
+/// table and remembers where it stopped, so a single-threaded host (the WASM
+/// wrapper) can spread a large clear over idle slices instead of taking one
+/// long blocking memset. Returns true once the whole table has been cleared
+/// and the cursor has wrapped around for the next round.
+
+bool TranspositionTable::clear_chunk(size_t mbChunk) {
+
+  if (!mem)
+      return true;
+
+  size_t step = std::max<size_t>(1, mbChunk * 1024 * 1024 / sizeof(Cluster));
+  size_t end  = std::min(clusterCount, clearCursor + step);
+
+  std::memset(&table[clearCursor], 0, (end - clearCursor) * sizeof(Cluster));
+  clearCursor = end;
+
+  if (clearCursor < clusterCount)
+      return false;
+
+  clearCursor = 0;
+  return true;
+}
+
+
+/// TranspositionTable::save_compact() streams the table's valuable entries -
+/// those carrying a real bound and at least minDepth of search behind them -
+/// as (cluster, entry) records for a warm-start snapshot (see
+/// Search::save_state()). The cluster count heads the stream because an
+/// entry only stores the low 16 bits of its key: the rest of the key lives
+/// in the entry's position, so a snapshot can be restored only into a table
+/// of the same geometry. Returns the number of entries written.
+
+size_t TranspositionTable::save_compact(std::ostream& os, Depth minDepth) const {
+
+  auto keep = [minDepth](const TTEntry& e) {
+      return (e.genBound8 & 0x3) != BOUND_NONE
+          && e.depth8 + DEPTH_OFFSET >= minDepth;
+  };
+
+  // The record count heads the stream, so count in a first pass rather than
+  // requiring a seekable sink.
+  uint32_t count = 0;
+  for (size_t c = 0; mem && c < clusterCount; ++c)
+      for (int i = 0; i < ClusterSize; ++i)
+          count += keep(table[c].entry[i]);
+
+  uint64_t clusters = clusterCount;
+  os.write(reinterpret_cast<const char*>(&clusters), sizeof(clusters));
+  os.write(reinterpret_cast<const char*>(&count),    sizeof(count));
+
+  for (size_t c = 0; mem && c < clusterCount; ++c)
+      for (int i = 0; i < ClusterSize; ++i)
+          if (keep(table[c].entry[i]))
+          {
+              uint32_t idx = uint32_t(c);
+              os.write(reinterpret_cast<const char*>(&idx), sizeof(idx));
+              os.write(reinterpret_cast<const char*>(&table[c].entry[i]),
+                       sizeof(TTEntry));
+          }
+
+  return count;
+}
+
+
+/// TranspositionTable::load_compact() merges a save_compact() stream into the
+/// table, refreshing each entry's generation so the restored knowledge is not
+/// aged out by the first new_search(). A snapshot taken from a table of a
+/// different size is consumed but skipped, since its entries cannot be
+/// re-placed (see save_compact()). Returns the number of entries applied.
+
+size_t TranspositionTable::load_compact(std::istream& is) {
+
+  uint64_t clusters;
+  uint32_t count;
+  is.read(reinterpret_cast<char*>(&clusters), sizeof(clusters));
+  is.read(reinterpret_cast<char*>(&count),    sizeof(count));
+  if (!is)
+      return 0;
+
+  constexpr size_t RecordSize = sizeof(uint32_t) + sizeof(TTEntry);
+
+  if (!mem || clusters != clusterCount)
+  {
+      is.ignore(std::streamsize(count * RecordSize));
+      return 0;
+  }
+
+  size_t applied = 0;
+  for (uint32_t r = 0; r < count && is; ++r)
+  {
+      uint32_t idx;
+      TTEntry e;
+      is.read(reinterpret_cast<char*>(&idx), sizeof(idx));
+      is.read(reinterpret_cast<char*>(&e),   sizeof(e));
+      if (!is || idx >= clusterCount)
+          break;
+
+      // Land in the slot holding the same position, else the shallowest one,
+      // and only ever deepen it; live entries beat snapshot entries of equal
+      // depth.
+      TTEntry* slot = &table[idx].entry[0];
+      for (int i = 0; i < ClusterSize; ++i)
+      {
+          TTEntry& cand = table[idx].entry[i];
+          if (!cand.key16 || cand.key16 == e.key16)
+          {
+              slot = &cand;
+              break;
+          }
+          if (cand.depth8 < slot->depth8)
+              slot = &cand;
+      }
+
+      if (slot->key16 && slot->depth8 >= e.depth8)
+          continue;
+
+      e.genBound8 = uint8_t(generation8 | (e.genBound8 & 0x7));
+      *slot = e;
+      applied++;
+  }
+
+  return applied;
 }
 
 
@@ -21,6 +21,8 @@
 #ifndef TT_H_INCLUDED
 #define TT_H_INCLUDED
 
+#include <iosfwd>
+
 #include "misc.h"
 #include "types.h"
 
@@ -82,6 +84,9 @@ public:
   int hashfull() const;
   void resize(size_t mbSize);
   void clear();
+  bool clear_chunk(size_t mbChunk);
+  size_t save_compact(std::ostream& os, Depth minDepth) const;
+  size_t load_compact(std::istream& is);
 
   TTEntry* first_entry(const Key key) const {
     return &table[mul_hi64(key, clusterCount)].entry[0];
@@ -91,9 +96,12 @@ private:
   friend struct TTEntry;
 
   size_t clusterCount;
+  size_t clearCursor = 0; // Next cluster clear_chunk() will zero
   Cluster* table;
   void* mem;
-  uint8_t generation8; // Size must be not bigger than TTEntry::genBound8
+  // Size must be not bigger than TTEntry::genBound8. Starts nonzero so that
+  // zeroed (empty) entries never match the live generation in hashfull().
+  uint8_t generation8 = 8;
 };
 
 extern TranspositionTable TT;
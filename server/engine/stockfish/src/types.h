@@ -222,18 +222,22 @@ namespace AbsorbChess {
   // Maximum ability combinations (2^6 = 64 combinations)
   constexpr int MAX_ABILITY_COMBINATIONS = 64;
   
+  // The tables are computed at compile time (see absorb_tables.cpp); the
+  // names below are read-only views into that constant data.
+
   // Mobility table: [base_piece_type][abilities] -> array of piece types to check for mobility
   // Each entry contains which piece movement patterns to include
-  extern PieceType MobilityTypes[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS][4]; // Max 4 movement types
-  extern int MobilityTypeCount[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS];
-  
+  extern const PieceType (&MobilityTypes)[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS][4]; // Max 4 movement types
+  extern const int (&MobilityTypeCount)[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS];
+
   // Material table: [base_piece_type][abilities] -> effective piece type for material calculation
-  extern PieceType EffectiveMaterialType[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS];
-  
+  extern const PieceType (&EffectiveMaterialType)[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS];
+
   // Piece-square table: [base_piece_type][abilities] -> effective piece type for psqt
-  extern PieceType EffectivePSQTType[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS];
-  
-  // Initialize lookup tables
+  extern const PieceType (&EffectivePSQTType)[PIECE_TYPE_NB][MAX_ABILITY_COMBINATIONS];
+
+  // A no-op since the tables became compile-time data; kept so the WASM
+  // wrapper's and native main()'s init sequences need no changes.
   void init_tables();
 }
 
@@ -337,8 +341,8 @@ inline T& operator+=(T& d1, int d2) { return d1 = d1 + d2; }         \
 inline T& operator-=(T& d1, int d2) { return d1 = d1 - d2; }
 
 #define ENABLE_INCR_OPERATORS_ON(T)                                \
-inline T& operator++(T& d) { return d = T(int(d) + 1); }           \
-inline T& operator--(T& d) { return d = T(int(d) - 1); }
+constexpr T& operator++(T& d) { return d = T(int(d) + 1); }        \
+constexpr T& operator--(T& d) { return d = T(int(d) - 1); }
 
 #define ENABLE_FULL_OPERATORS_ON(T)                                \
 ENABLE_BASE_OPERATORS_ON(T)                                        \
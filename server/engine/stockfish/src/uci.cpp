@@ -20,11 +20,19 @@
 
 #include <cassert>
 #include <cmath>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
+#ifdef __EMSCRIPTEN__
 #include <emscripten.h>
+#else
+#define EMSCRIPTEN_KEEPALIVE
+#endif
 
+#include "book.h"
 #include "evaluate.h"
 #include "movegen.h"
 #include "position.h"
@@ -47,7 +55,9 @@ namespace {
   // position() is called when engine receives the "position" UCI command.
   // The function sets up the position described in the given FEN string ("fen")
   // or the starting position ("startpos") and then makes the moves given in the
-  // following move list ("moves").
+  // following move list ("moves"). The fen may use the extended absorb dialect
+  // with '[...]' ability suffixes; they contain no spaces, so the plain
+  // token-by-token collection below passes them through to Position::set().
 
   void position(Position& pos, istringstream& is, StateListPtr& states) {
 
@@ -130,9 +140,21 @@ namespace {
         else if (token == "movetime")  is >> limits.movetime;
         else if (token == "mate")      is >> limits.mate;
         else if (token == "perft")     is >> limits.perft;
+        else if (token == "rootbound") is >> limits.rootBound; // internal units, see cluster.cpp
         else if (token == "infinite")  limits.infinite = 1;
         else if (token == "ponder")    ponderMode = true;
 
+    // Absorb Chess: a book hit answers without searching. Analysis-style
+    // requests (infinite, ponder, perft) always search, as does a
+    // 'searchmoves' restriction: the book knows nothing of the caller's
+    // move set, and the cluster workers rely on the restriction holding.
+    if (!limits.infinite && !ponderMode && !limits.perft && limits.searchmoves.empty())
+        if (Move bookMove = OpeningBook.probe(pos); bookMove != MOVE_NONE)
+        {
+            sync_cout << "bestmove " << UCI::move(bookMove, pos.is_chess960()) << sync_endl;
+            return;
+        }
+
     Threads.start_thinking(pos, states, limits, ponderMode);
   }
 
@@ -161,9 +183,30 @@ namespace {
             cerr << "\nPosition: " << cnt++ << '/' << num << endl;
             if (token == "go")
             {
+               // How much of this position exercises the absorb paths: the
+               // fraction of root moves played by a piece with absorbed
+               // abilities. Zero across the board means the corpus is not
+               // measuring what it should.
+               int rootMoves = 0, abilityMoves = 0;
+               for (const auto& m : MoveList<LEGAL>(pos))
+               {
+                   rootMoves++;
+                   if (pos.absorbed_abilities(from_sq(m)))
+                       abilityMoves++;
+               }
+
+               TimePoint posTime = now();
+               ABSORB_PROF_BEGIN(SEARCH);
                go(pos, is, states);
                Threads.main()->wait_for_search_finished();
-               nodes += Threads.nodes_searched();
+               ABSORB_PROF_END(SEARCH);
+               posTime = now() - posTime + 1;
+
+               uint64_t posNodes = Threads.nodes_searched();
+               nodes += posNodes;
+               cerr << "Nodes: " << posNodes
+                    << "\nNodes/second: " << 1000 * posNodes / posTime
+                    << "\nAbility moves: " << abilityMoves << '/' << rootMoves << endl;
             }
             else
                sync_cout << "\n" << Eval::trace(pos) << sync_endl;
@@ -176,6 +219,7 @@ namespace {
     elapsed = now() - elapsed + 1; // Ensure positivity to avoid a 'divide by zero'
 
     dbg_print(); // Just before exiting
+    ABSORB_PROF_PRINT();
 
     cerr << "\n==========================="
          << "\nTotal time (ms) : " << elapsed
@@ -183,6 +227,130 @@ namespace {
          << "\nNodes/second    : " << 1000 * nodes / elapsed << endl;
   }
 
+  // Multi-game server mode. A GameContext is all the per-game state there is:
+  // one Position plus its StateInfo chain, a few hundred bytes against the
+  // engine-sized cost of a process per bot game. Everything else - the magic
+  // and PSQT tables, AbsorbChess::MobilityTypes, the thread pool with its
+  // histories and the transposition table - is initialized once and shared by
+  // all contexts. TT sharing is made safe by tagging: each context salts its
+  // hash keys with a random ttTag, so games can never hit (only age out)
+  // each other's entries.
+
+  struct GameContext {
+    Position pos;
+    StateListPtr states{new std::deque<StateInfo>(1)};
+    Key ttTag;
+  };
+
+  std::map<string, std::unique_ptr<GameContext>> gameContexts;
+
+
+  // game() handles the 'game' command of the server mode:
+  //
+  //   game new <id>              create a fresh context at the start position
+  //   game delete <id>           destroy a context
+  //   game <id> <uci command>    run position/go/d/eval in that context
+  //
+  // Searches still run one at a time through the shared thread pool (go on one
+  // context while another is searching simply waits, like back-to-back go
+  // commands in plain UCI), which fits the server's move-by-move bot queue.
+
+  void game(istringstream& is) {
+
+    static PRNG rng(now());
+
+    string token;
+    is >> token;
+
+    if (token == "new")
+    {
+        is >> token;
+        auto& ctx = gameContexts[token];
+        if (ctx)
+        {
+            sync_cout << "info string game '" << token << "' already exists" << sync_endl;
+            return;
+        }
+        ctx = std::unique_ptr<GameContext>(new GameContext());
+        ctx->ttTag = rng.rand<Key>();
+        ctx->pos.set(StartFEN, false, &ctx->states->back(), Threads.main());
+        ctx->pos.set_tt_tag(ctx->ttTag);
+        return;
+    }
+
+    if (token == "delete")
+    {
+        is >> token;
+        if (gameContexts.count(token))
+        {
+            Threads.main()->wait_for_search_finished(); // The context may be searching
+            gameContexts.erase(token);
+        }
+        else
+            sync_cout << "info string no such game '" << token << "'" << sync_endl;
+        return;
+    }
+
+    auto it = gameContexts.find(token);
+    if (it == gameContexts.end())
+    {
+        sync_cout << "info string no such game '" << token << "'" << sync_endl;
+        return;
+    }
+
+    GameContext& ctx = *it->second;
+    is >> token;
+
+    if (token == "position")
+    {
+        Threads.main()->wait_for_search_finished();
+        position(ctx.pos, is, ctx.states);
+        ctx.pos.set_tt_tag(ctx.ttTag); // Position::set() resets the tag
+    }
+    else if (token == "go")   go(ctx.pos, is, ctx.states);
+    else if (token == "d")    sync_cout << ctx.pos << sync_endl;
+    else if (token == "eval") sync_cout << Eval::trace(ctx.pos) << sync_endl;
+    else
+        sync_cout << "Unknown game command: " << token << sync_endl;
+  }
+
+
+  // 'snapshot save <file> [mindepth]' persists a warm search state - the
+  // compacted transposition table plus the history tables - and 'snapshot
+  // load <file>' restores one, so an always-on bot worker restarting on
+  // deploy does not begin stone cold (see Search::save_state()). File-backed
+  // here; the WASM wrapper moves the same blob through IndexedDB via
+  // saveSnapshot()/loadSnapshot() in absorb_chess_wasm.cpp instead.
+
+  void snapshot(istringstream& is) {
+
+    string token, file;
+    is >> token >> file;
+
+    if (token == "save" && !file.empty())
+    {
+        int minDepth = 5; // Shallow entries are cheap to redo; don't haul them
+        is >> minDepth;
+
+        std::ofstream f(file, std::ios::binary);
+        if (f && Search::save_state(f, Depth(minDepth)))
+            sync_cout << "info string snapshot saved to " << file << sync_endl;
+        else
+            sync_cout << "info string snapshot save to " << file << " failed" << sync_endl;
+    }
+    else if (token == "load" && !file.empty())
+    {
+        std::ifstream f(file, std::ios::binary);
+        if (f && Search::load_state(f))
+            sync_cout << "info string snapshot loaded from " << file << sync_endl;
+        else
+            sync_cout << "info string snapshot load from " << file << " failed" << sync_endl;
+    }
+    else
+        sync_cout << "info string usage: snapshot save <file> [mindepth] | snapshot load <file>" << sync_endl;
+  }
+
+
   // The win rate model returns the probability (per mille) of winning given an eval
   // and a game-ply. The model fits rather accurately the LTC fishtest statistics.
   int win_rate_model(Value v, int ply) {
@@ -256,6 +424,8 @@ EMSCRIPTEN_KEEPALIVE extern "C" int uci_command(const char *c_cmd) {
       else if (token == "setoption")  setoption(is);
       else if (token == "go")         go(pos, is, states);
       else if (token == "position")   position(pos, is, states);
+      else if (token == "game")       game(is);
+      else if (token == "snapshot")   snapshot(is);
       else if (token == "ucinewgame") Search::clear();
       else if (token == "isready")    sync_cout << "readyok" << sync_endl;
 
@@ -273,6 +443,31 @@ EMSCRIPTEN_KEEPALIVE extern "C" int uci_command(const char *c_cmd) {
 }
 
 
+/// UCI::loop() is the native driver around uci_command(): it feeds it the
+/// command line arguments (e.g. 'bench'), then commands from stdin until
+/// 'quit' or EOF. The WASM wrapper calls uci_command() directly instead and
+/// never enters this loop. uci_command() returns non-zero while the pool's
+/// threads are still starting up, which cannot happen here because native
+/// thread creation does not need to yield anywhere (see note (A) in
+/// thread.cpp), so no retry logic is needed.
+
+void UCI::loop(int argc, char* argv[]) {
+
+  string cmd;
+
+  for (int i = 1; i < argc; ++i)
+      cmd += std::string(argv[i]) + " ";
+
+  do {
+      if (argc == 1 && !getline(cin, cmd)) // Block here waiting for input or EOF
+          cmd = "quit";
+
+      uci_command(cmd.c_str());
+
+  } while (cmd != "quit" && argc == 1); // Command line args are one-shot
+}
+
+
 /// UCI::value() converts a Value to a string suitable for use with the UCI
 /// protocol specification:
 ///
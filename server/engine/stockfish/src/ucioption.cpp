@@ -23,6 +23,7 @@
 #include <ostream>
 #include <sstream>
 
+#include "book.h"
 #include "misc.h"
 #include "search.h"
 #include "thread.h"
@@ -40,6 +41,7 @@ void on_clear_hash(const Option&) { Search::clear(); }
 void on_hash_size(const Option& o) { TT.resize(size_t(o)); }
 void on_logger(const Option& o) { start_logger(o); }
 void on_threads(const Option& o) { Threads.set(size_t(o)); }
+void on_book_file(const Option& o) { OpeningBook.load(o); }
 
 
 /// Our case insensitive less() function as required by UCI protocol
@@ -64,6 +66,7 @@ void init(OptionsMap& o) {
   o["Hash"]                  << Option(16, 1, MaxHashMB, on_hash_size);
   o["Clear Hash"]            << Option(on_clear_hash);
   o["Ponder"]                << Option(false);
+  o["Book File"]             << Option("", on_book_file);
   o["MultiPV"]               << Option(1, 1, 500);
   o["Skill Level"]           << Option(20, 0, 20);
   o["Move Overhead"]         << Option(10, 0, 5000);